@@ -19,6 +19,7 @@
 
 #include <cstddef>
 #include <string>
+#include <vector>
 
 #include "base/oram_defs.h"
 
@@ -33,6 +34,39 @@ struct OramConfig {
   size_t bucket_size;
   uint32_t id;
 
+  // For the recursive position map of Path ORAM.
+  uint32_t recursion_level;
+  size_t plb_size;
+  // The number of top levels of the tree cached on the client.
+  uint32_t treetop_level;
+  // The number of threads initializing the partitions of Partition ORAM.
+  size_t init_thread_num;
+  // The number of threads evicting from the slots of Partition ORAM.
+  size_t evict_thread_num;
+  // Whether Partition ORAM evicts in the background, and how many evictions
+  // may be queued before an access has to wait.
+  bool background_evict;
+  size_t evict_backlog;
+  // The number of blocks each eviction of Partition ORAM moves from a slot.
+  size_t evict_block_num;
+  // Whether each access of Partition ORAM also evicts from the slot of the
+  // partition it reads, in place of one of the \nu separate evictions.
+  bool piggyback_evict;
+  // The eviction policy of Partition ORAM and its rate \nu: the number of
+  // evictions per access, or their mean for sequential eviction.
+  EvictType evict_type;
+  size_t nu;
+  // Whether Partition ORAM adapts \nu to the occupancy of the slots, within
+  // [nu_min, nu_max] and once every `adapt_period` accesses.
+  bool adaptive_evict;
+  size_t nu_min;
+  size_t nu_max;
+  size_t adapt_period;
+  // The ORAM behind each partition of Partition ORAM.
+  OramType sub_oram_type;
+  // The number of channels to the server used by the asynchronous RPCs.
+  size_t channel_num;
+
   // For SSL configuration.
   std::string crt_path;
   std::string key_path;
@@ -43,6 +77,15 @@ struct OramConfig {
   bool enable_proxy;
   std::string proxy_address;
   uint32_t proxy_port;
+  // The servers that the partitions of Partition ORAM are spread over, as
+  // "address:port". If empty, the server above is the only one.
+  std::vector<std::string> server_endpoints;
+  // The directory in which the server keeps its tree storages as files.
+  // If empty, they are kept in memory only.
+  std::string storage_path;
+  // Whether the new tree storages in `storage_path` are accessed with direct
+  // I/O instead of being mapped; for trees much larger than the memory.
+  bool direct_io;
 
   // Log settings.
   uint8_t log_level;
@@ -63,6 +106,24 @@ static const OramConfig default_config = {
     4,
     0,
 
+    0,
+    kDefaultPlbSize,
+    0,
+    0,
+    0,
+    false,
+    kDefaultEvictBacklog,
+    1,
+    false,
+    EvictType::kEvictRand,
+    kDefaultNu,
+    false,
+    kDefaultNuMin,
+    kDefaultNuMax,
+    kDefaultAdaptPeriod,
+    OramType::kPathOram,
+    kDefaultChannelNum,
+
     "./key/server.crt",
     "./key/server.key",
 
@@ -71,6 +132,9 @@ static const OramConfig default_config = {
     false,
     "",
     0,
+    {},
+    "",
+    false,
 
     2,
     3,
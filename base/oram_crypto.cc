@@ -17,6 +17,7 @@
 #include "oram_crypto.h"
 
 #include <bitset>
+#include <cmath>
 #include <sstream>
 
 #include <spdlog/spdlog.h>
@@ -277,6 +278,29 @@ oram_impl::OramStatus UniformRandom(uint32_t min, uint32_t max,
   return oram_impl::OramStatus::OK;
 }
 
+oram_impl::OramStatus PoissonRandom(double mean, uint32_t* const out) {
+  // exp(-mean) underflows beyond this.
+  if (mean < 0 || mean > 700) {
+    return oram_impl::OramStatus(oram_impl::StatusCode::kInvalidArgument,
+                                 "The mean is out of range", __func__);
+  }
+
+  // Inverse transform sampling: the smallest k with P(X <= k) > u for u
+  // uniform in [0, 1).
+  const double u = randombytes_random() / 4294967296.0;
+  double probability = std::exp(-mean);
+  double cdf = probability;
+  uint32_t k = 0;
+  while (u >= cdf && probability > 0) {
+    k++;
+    probability *= mean / k;
+    cdf += probability;
+  }
+
+  *out = k;
+  return oram_impl::OramStatus::OK;
+}
+
 oram_impl::OramStatus RandomBytes(uint8_t* const out, size_t length) {
   if (length == 0) {
     return oram_impl::OramStatus(oram_impl::StatusCode::kInvalidArgument,
@@ -76,6 +76,9 @@ oram_impl::OramStatus RandomBytes(uint8_t* const out, size_t size);
 oram_impl::OramStatus UniformRandom(uint32_t min, uint32_t max,
                                     uint32_t* const out);
 
+// Samples from the Poisson distribution with the given mean.
+oram_impl::OramStatus PoissonRandom(double mean, uint32_t* const out);
+
 // Use Fisher-Yates shuffle to generate a random shuffle.
 template <typename Tp>
 oram_impl::OramStatus RandomShuffle(std::vector<Tp>& array) {
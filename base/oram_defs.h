@@ -54,6 +54,7 @@ enum class Operation {
 enum class EvictType {
   kEvictSeq = 0,
   kEvictRand = 1,
+  kInvalid = 2,
 };
 
 enum class BlockType {
@@ -69,7 +70,9 @@ enum class OramType {
   kPartitionOram = 3,
   kCuckooOram = 4,
   kOds = 5,
-  kInvalid = 6,
+  kRingOram = 6,
+  kCircuitOram = 7,
+  kInvalid = 8,
 };
 
 enum class OramStorageType {
@@ -89,6 +92,9 @@ typedef struct _oram_block_header_t {
 
   // Encrypted fields only accessible to client.
   BlockType type;
+  // The leaf the block is mapped to in tree ORAMs, so that the client does not
+  // need the position map to evict a block it has read from a path.
+  uint32_t leaf;
   size_t data_len;
 } oram_block_header_t;
 
@@ -116,6 +122,33 @@ static const std::string oram_write_err =
 static const float kPartitionAdjustmentFactor = 1.;
 
 static const uint32_t kMaximumOramStorageNum = 1e5;
+// The storages of the server are spread over this many independently locked
+// shards by their id.
+static const uint32_t kStorageShardNum = 16;
+
+// For the recursive position map of the Path ORAM, whose position blocks are
+// kept in the same tree as the data blocks.
+static const uint32_t kMaximumRecursionLevel = 4;
+static const uint32_t kPositionsPerBlock =
+    DEFAULT_ORAM_DATA_SIZE / sizeof(uint32_t);
+static const size_t kDefaultPlbSize = 64;
+
+// The payload of each chunk streamed by BulkLoad, well below the default 4 MB
+// limit of a gRPC message.
+static const size_t kBulkLoadChunkSize = 1 << 20;
+// The number of channels in the pool of the asynchronous client.
+static const size_t kDefaultChannelNum = 4;
+// The number of evictions that Partition ORAM may queue in the background.
+static const size_t kDefaultEvictBacklog = 1024;
+// The eviction rate \nu of Partition ORAM.
+static const size_t kDefaultNu = 2;
+// The bounds of the adaptive eviction rate of Partition ORAM and the number of
+// accesses between two of its changes.
+static const size_t kDefaultNuMin = 1;
+static const size_t kDefaultNuMax = 4;
+static const size_t kDefaultAdaptPeriod = 256;
+// The rate goes up once any slot holds more blocks than this.
+static const size_t kAdaptSlotLimit = 8;
 
 static const uint32_t kInvalidMask = 0xFFFFFFFF;
 
@@ -124,16 +157,8 @@ using sqrt_oram_storage_t = std::vector<oram_block_t>;
 
 // Alias for Path ORAM.
 using p_oram_bucket_t = std::vector<oram_block_t>;
-using p_oram_stash_t = std::vector<oram_block_t>;
 using p_oram_path_t = std::vector<p_oram_bucket_t>;
-using p_oram_position_t = std::unordered_map<uint32_t, uint32_t>;
-// Alias for Partition ORAM.
-using pp_oram_slot_t = std::vector<std::vector<oram_block_t>>;
 // Alias for server storage.
-using server_storage_data = std::vector<std::string>;
-using server_storage_tag_t = std::pair<uint32_t, uint32_t>;
-using server_tree_storage_t =
-    absl::flat_hash_map<server_storage_tag_t, server_storage_data>;
 using server_flat_storage_t = std::string;
 using server_sqrt_storage_t = std::vector<std::string>;
 using server_sqrt_shelter_t = std::vector<std::pair<uint32_t, std::string>>;
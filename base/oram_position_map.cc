@@ -0,0 +1,134 @@
+/*
+ Copyright (c) 2022 Haobin Chen
+
+ This program is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "oram_position_map.h"
+
+#include <algorithm>
+
+namespace oram_impl {
+static uint32_t BitWidth(uint32_t value) {
+  uint32_t width = 1;
+  while (width < 32 && (value >> width) != 0) {
+    width++;
+  }
+  return width;
+}
+
+PositionMap::PositionMap()
+    : capacity_(0), bits_(0), mask_(0), dense_size_(0) {}
+
+PositionMap::PositionMap(uint32_t capacity, uint32_t max_position)
+    : capacity_(capacity),
+      bits_(BitWidth(max_position)),
+      mask_((1ull << bits_) - 1),
+      dense_size_(0) {
+  // One extra word so that an entry straddling two words never reads past
+  // the end of the array.
+  packed_.resize(((uint64_t)capacity_ * bits_ >> 6) + 2, 0ull);
+  present_.resize((capacity_ >> 6) + 1, 0ull);
+}
+
+uint32_t PositionMap::GetPacked(uint32_t address) const {
+  const uint64_t bit = (uint64_t)address * bits_;
+  const size_t word = bit >> 6;
+  const uint32_t offset = bit & 63;
+
+  uint64_t value = packed_[word] >> offset;
+  if (offset + bits_ > 64) {
+    value |= packed_[word + 1] << (64 - offset);
+  }
+  return value & mask_;
+}
+
+void PositionMap::SetPacked(uint32_t address, uint32_t position) {
+  const uint64_t bit = (uint64_t)address * bits_;
+  const size_t word = bit >> 6;
+  const uint32_t offset = bit & 63;
+
+  packed_[word] = (packed_[word] & ~(mask_ << offset)) |
+                  ((uint64_t)position << offset);
+  if (offset + bits_ > 64) {
+    const uint32_t shift = 64 - offset;
+    packed_[word + 1] = (packed_[word + 1] & ~(mask_ >> shift)) |
+                        ((uint64_t)position >> shift);
+  }
+
+  uint64_t& present = present_[address >> 6];
+  const uint64_t flag = 1ull << (address & 63);
+  if (!(present & flag)) {
+    present |= flag;
+    dense_size_++;
+  }
+}
+
+void PositionMap::ClearPresent(uint32_t address) {
+  present_[address >> 6] &= ~(1ull << (address & 63));
+  dense_size_--;
+}
+
+size_t PositionMap::count(uint32_t address) const {
+  if (IsDense(address) && TestPresent(address)) {
+    return 1;
+  }
+  return sparse_.count(address);
+}
+
+uint32_t PositionMap::Get(uint32_t address) const {
+  if (IsDense(address) && TestPresent(address)) {
+    return GetPacked(address);
+  }
+
+  auto iter = sparse_.find(address);
+  return iter == sparse_.end() ? 0 : iter->second;
+}
+
+void PositionMap::Set(uint32_t address, uint32_t position) {
+  if (IsDense(address) && (position & ~mask_) == 0) {
+    SetPacked(address, position);
+    // The address may have been spilled before.
+    if (!sparse_.empty()) {
+      sparse_.erase(address);
+    }
+    return;
+  }
+
+  // Either the address is out of the dense range or the position is too wide.
+  if (IsDense(address) && TestPresent(address)) {
+    ClearPresent(address);
+  }
+  sparse_[address] = position;
+}
+
+size_t PositionMap::erase(uint32_t address) {
+  if (IsDense(address) && TestPresent(address)) {
+    ClearPresent(address);
+    return 1;
+  }
+  return sparse_.erase(address);
+}
+
+void PositionMap::clear(void) {
+  std::fill(present_.begin(), present_.end(), 0ull);
+  dense_size_ = 0;
+  sparse_.clear();
+}
+
+size_t PositionMap::ReportStorage(void) const {
+  return (packed_.size() + present_.size()) * sizeof(uint64_t) +
+         sparse_.capacity() *
+             (sizeof(std::pair<uint32_t, uint32_t>) + sizeof(int8_t));
+}
+}  // namespace oram_impl
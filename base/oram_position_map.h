@@ -0,0 +1,102 @@
+/*
+ Copyright (c) 2022 Haobin Chen
+
+ This program is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#ifndef ORAM_IMPL_BASE_ORAM_POSITION_MAP_H_
+#define ORAM_IMPL_BASE_ORAM_POSITION_MAP_H_
+
+#include <absl/container/flat_hash_map.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace oram_impl {
+// The client-side position map. When the addresses are known to be contiguous,
+// i.e., they lie in [0, capacity), the positions are bit-packed into an array
+// with ceil(log2(max_position + 1)) bits per entry so that a lookup is only a
+// shift and a mask. Addresses out of that range (or positions that do not fit)
+// fall back to a hash map, so a default-constructed map is purely sparse.
+class PositionMap {
+  // Addresses in [0, capacity_) are stored densely.
+  uint32_t capacity_;
+  // The width of each packed entry.
+  uint32_t bits_;
+  uint64_t mask_;
+  std::vector<uint64_t> packed_;
+  // One bit per dense address telling whether it has a position.
+  std::vector<uint64_t> present_;
+  size_t dense_size_;
+  absl::flat_hash_map<uint32_t, uint32_t> sparse_;
+
+  bool IsDense(uint32_t address) const { return address < capacity_; }
+  bool TestPresent(uint32_t address) const {
+    return (present_[address >> 6] >> (address & 63)) & 1;
+  }
+  uint32_t GetPacked(uint32_t address) const;
+  void SetPacked(uint32_t address, uint32_t position);
+  void ClearPresent(uint32_t address);
+
+ public:
+  // A proxy returned by the non-const subscript so that the map can be used
+  // like `position_map[address] = position` on packed entries.
+  class Reference {
+    friend class PositionMap;
+
+    PositionMap* const map_;
+    const uint32_t address_;
+
+    Reference(PositionMap* const map, uint32_t address)
+        : map_(map), address_(address) {}
+
+   public:
+    operator uint32_t() const { return map_->Get(address_); }
+    Reference& operator=(uint32_t position) {
+      map_->Set(address_, position);
+      return *this;
+    }
+    Reference& operator=(const Reference& rhs) {
+      return *this = static_cast<uint32_t>(rhs);
+    }
+  };
+
+  PositionMap();
+  // Stores the positions of the addresses in [0, capacity) densely. Every
+  // position is expected to be no larger than `max_position`.
+  PositionMap(uint32_t capacity, uint32_t max_position);
+
+  size_t size(void) const { return dense_size_ + sparse_.size(); }
+  bool empty(void) const { return size() == 0; }
+  size_t count(uint32_t address) const;
+
+  // Returns 0 if the address has no position, like the default value of a
+  // std::unordered_map, but without inserting anything.
+  uint32_t Get(uint32_t address) const;
+  void Set(uint32_t address, uint32_t position);
+
+  Reference operator[](uint32_t address) { return Reference(this, address); }
+  uint32_t operator[](uint32_t address) const { return Get(address); }
+
+  size_t erase(uint32_t address);
+  void clear(void);
+
+  // The number of bytes occupied by the map on the client.
+  size_t ReportStorage(void) const;
+};
+
+using p_oram_position_t = PositionMap;
+}  // namespace oram_impl
+
+#endif  // ORAM_IMPL_BASE_ORAM_POSITION_MAP_H_
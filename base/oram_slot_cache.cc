@@ -0,0 +1,76 @@
+/*
+ Copyright (c) 2022 Haobin Chen
+
+ This program is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "oram_slot_cache.h"
+
+namespace oram_impl {
+void PartitionSlotCache::SwapRemove(Slot& slot, size_t pos,
+                                    oram_block_t* const block) {
+  *block = slot.blocks[pos];
+  slot.index.erase(block->header.block_id);
+
+  if (pos + 1 != slot.blocks.size()) {
+    slot.blocks[pos] = slot.blocks.back();
+    slot.index[slot.blocks[pos].header.block_id] = pos;
+  }
+  slot.blocks.pop_back();
+  total_occupancy_--;
+}
+
+oram_block_t* PartitionSlotCache::Find(uint32_t slot_id, uint32_t address) {
+  Slot& slot = slots_[slot_id];
+  auto iter = slot.index.find(address);
+  return iter == slot.index.end() ? nullptr : &slot.blocks[iter->second];
+}
+
+bool PartitionSlotCache::Insert(uint32_t slot_id, const oram_block_t& block) {
+  Slot& slot = slots_[slot_id];
+  if (!slot.index.emplace(block.header.block_id, slot.blocks.size()).second) {
+    return false;
+  }
+
+  slot.blocks.emplace_back(block);
+  total_occupancy_++;
+  return true;
+}
+
+bool PartitionSlotCache::Take(uint32_t slot_id, uint32_t address,
+                              oram_block_t* const block) {
+  Slot& slot = slots_[slot_id];
+  auto iter = slot.index.find(address);
+  if (iter == slot.index.end()) {
+    return false;
+  }
+
+  SwapRemove(slot, iter->second, block);
+  return true;
+}
+
+bool PartitionSlotCache::PopBack(uint32_t slot_id, oram_block_t* const block) {
+  Slot& slot = slots_[slot_id];
+  if (slot.blocks.empty()) {
+    return false;
+  }
+
+  SwapRemove(slot, slot.blocks.size() - 1, block);
+  return true;
+}
+
+void PartitionSlotCache::Clear(void) {
+  slots_.clear();
+  total_occupancy_ = 0;
+}
+}  // namespace oram_impl
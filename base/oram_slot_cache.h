@@ -0,0 +1,81 @@
+/*
+ Copyright (c) 2022 Haobin Chen
+
+ This program is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#ifndef ORAM_IMPL_BASE_ORAM_SLOT_CACHE_H_
+#define ORAM_IMPL_BASE_ORAM_SLOT_CACHE_H_
+
+#include <absl/container/flat_hash_map.h>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "oram_defs.h"
+
+namespace oram_impl {
+// The slots of Partition ORAM. The blocks of each slot are stored contiguously
+// and removed by swapping with the last one, and each slot indexes its blocks
+// by address, so that lookup, insertion and removal are all O(1). The slot of
+// an address is known from the position map, so the index is kept per slot;
+// this lets the slots be modified concurrently as long as each slot is only
+// modified by one thread at a time. The occupancy of each slot and the total
+// occupancy are available in O(1) as well.
+class PartitionSlotCache {
+  struct Slot {
+    std::vector<oram_block_t> blocks;
+    // [address] -> [index in `blocks`].
+    absl::flat_hash_map<uint32_t, size_t> index;
+  };
+
+  std::vector<Slot> slots_;
+  std::atomic_size_t total_occupancy_;
+
+  void SwapRemove(Slot& slot, size_t pos, oram_block_t* const block);
+
+ public:
+  PartitionSlotCache() : total_occupancy_(0) {}
+
+  void Resize(size_t slot_num) { slots_.resize(slot_num); }
+  size_t SlotNum(void) const { return slots_.size(); }
+
+  size_t Occupancy(uint32_t slot_id) const {
+    return slots_[slot_id].blocks.size();
+  }
+  size_t TotalOccupancy(void) const { return total_occupancy_; }
+  bool Empty(uint32_t slot_id) const { return slots_[slot_id].blocks.empty(); }
+  const std::vector<oram_block_t>& Blocks(uint32_t slot_id) const {
+    return slots_[slot_id].blocks;
+  }
+
+  // Returns nullptr if the block is not in the slot.
+  oram_block_t* Find(uint32_t slot_id, uint32_t address);
+  // Returns false if the block is already in the slot.
+  bool Insert(uint32_t slot_id, const oram_block_t& block);
+  // Moves the block out of the slot. Returns false if it is not in the slot.
+  bool Take(uint32_t slot_id, uint32_t address, oram_block_t* const block);
+  // Moves the last stored block out of the slot, which is not necessarily the
+  // most recently inserted one since removals reorder the blocks. Returns
+  // false if the slot is empty.
+  bool PopBack(uint32_t slot_id, oram_block_t* const block);
+
+  void Clear(void);
+};
+
+using pp_oram_slot_t = PartitionSlotCache;
+}  // namespace oram_impl
+
+#endif  // ORAM_IMPL_BASE_ORAM_SLOT_CACHE_H_
@@ -0,0 +1,107 @@
+/*
+ Copyright (c) 2022 Haobin Chen
+
+ This program is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "oram_stash.h"
+
+namespace oram_impl {
+void PathOramStash::Unlink(Entry& entry) {
+  auto iter = leaf_index_.find(entry.leaf);
+  std::vector<uint32_t>& ids = iter->second;
+
+  // Swap-remove the block from the list of its leaf.
+  const uint32_t moved_id = ids.back();
+  ids[entry.leaf_pos] = moved_id;
+  slab_[index_[moved_id]].leaf_pos = entry.leaf_pos;
+  ids.pop_back();
+
+  if (ids.empty()) {
+    leaf_index_.erase(iter);
+  }
+}
+
+void PathOramStash::Link(Entry& entry, uint32_t leaf) {
+  std::vector<uint32_t>& ids = leaf_index_[leaf];
+
+  entry.leaf = leaf;
+  entry.block.header.leaf = leaf;
+  entry.leaf_pos = ids.size();
+  ids.emplace_back(entry.block.header.block_id);
+}
+
+oram_block_t* PathOramStash::Find(uint32_t block_id) {
+  auto iter = index_.find(block_id);
+  return iter == index_.end() ? nullptr : &slab_[iter->second].block;
+}
+
+bool PathOramStash::Insert(const oram_block_t& block, uint32_t leaf) {
+  const uint32_t block_id = block.header.block_id;
+  if (Contains(block_id)) {
+    return false;
+  }
+
+  // Reuse a free slot if there is any.
+  size_t slot;
+  if (!free_slots_.empty()) {
+    slot = free_slots_.back();
+    free_slots_.pop_back();
+  } else {
+    slot = slab_.size();
+    slab_.emplace_back();
+  }
+
+  slab_[slot].block = block;
+  index_[block_id] = slot;
+  Link(slab_[slot], leaf);
+
+  return true;
+}
+
+bool PathOramStash::Remove(uint32_t block_id) {
+  auto iter = index_.find(block_id);
+  if (iter == index_.end()) {
+    return false;
+  }
+
+  const size_t slot = iter->second;
+  Unlink(slab_[slot]);
+  index_.erase(iter);
+  free_slots_.emplace_back(slot);
+
+  return true;
+}
+
+bool PathOramStash::UpdateLeaf(uint32_t block_id, uint32_t leaf) {
+  auto iter = index_.find(block_id);
+  if (iter == index_.end()) {
+    return false;
+  }
+
+  Entry& entry = slab_[iter->second];
+  if (entry.leaf != leaf) {
+    Unlink(entry);
+    Link(entry, leaf);
+  }
+
+  return true;
+}
+
+void PathOramStash::Clear(void) {
+  slab_.clear();
+  free_slots_.clear();
+  index_.clear();
+  leaf_index_.clear();
+}
+}  // namespace oram_impl
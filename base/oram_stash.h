@@ -0,0 +1,93 @@
+/*
+ Copyright (c) 2022 Haobin Chen
+
+ This program is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#ifndef ORAM_IMPL_BASE_ORAM_STASH_H_
+#define ORAM_IMPL_BASE_ORAM_STASH_H_
+
+#include <absl/container/flat_hash_map.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "oram_defs.h"
+
+namespace oram_impl {
+// The stash of the Path ORAM. Blocks are kept in a slab whose slots never move
+// so that lookup, insertion and removal by block id are all O(1). Each block
+// is tagged with the leaf it is currently mapped to, and blocks are further
+// indexed by their leaves so that eviction only needs to visit each distinct
+// leaf once.
+class PathOramStash {
+  struct Entry {
+    oram_block_t block;
+    // The leaf tag.
+    uint32_t leaf;
+    // The position of this entry in `leaf_index_[leaf]`.
+    size_t leaf_pos;
+  };
+
+  std::vector<Entry> slab_;
+  // Free slots in the slab that can be reused.
+  std::vector<size_t> free_slots_;
+  // [block_id] -> [slot].
+  absl::flat_hash_map<uint32_t, size_t> index_;
+  // [leaf] -> [block_id_1, block_id_2, ...].
+  absl::flat_hash_map<uint32_t, std::vector<uint32_t>> leaf_index_;
+
+  void Unlink(Entry& entry);
+  void Link(Entry& entry, uint32_t leaf);
+
+ public:
+  size_t size(void) const { return index_.size(); }
+  bool empty(void) const { return index_.empty(); }
+
+  bool Contains(uint32_t block_id) const {
+    return index_.find(block_id) != index_.end();
+  }
+  // Returns nullptr if the block is not in the stash.
+  oram_block_t* Find(uint32_t block_id);
+  // Returns false if the block is already in the stash.
+  bool Insert(const oram_block_t& block, uint32_t leaf);
+  // Returns false if the block is not in the stash.
+  bool Remove(uint32_t block_id);
+  // Re-tags the block with a new leaf. The tag is mirrored in the block header
+  // so that it travels with the block to the server.
+  bool UpdateLeaf(uint32_t block_id, uint32_t leaf);
+
+  // Visits every distinct leaf and the ids of the blocks mapped to it.
+  template <typename Fn>
+  void ForEachLeaf(Fn&& fn) const {
+    for (const auto& leaf : leaf_index_) {
+      fn(leaf.first, leaf.second);
+    }
+  }
+
+  // Visits every block in the stash.
+  template <typename Fn>
+  void ForEachBlock(Fn&& fn) const {
+    for (const auto& item : index_) {
+      fn(slab_[item.second].block);
+    }
+  }
+
+  void Clear(void);
+};
+
+using p_oram_stash_t = PathOramStash;
+}  // namespace oram_impl
+
+#endif  // ORAM_IMPL_BASE_ORAM_STASH_H_
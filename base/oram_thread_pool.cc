@@ -0,0 +1,160 @@
+/*
+ Copyright (c) 2022 Haobin Chen
+
+ This program is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "oram_thread_pool.h"
+
+#include <algorithm>
+#include <chrono>
+
+namespace oram_impl {
+thread_local ThreadPool* ThreadPool::current_pool_ = nullptr;
+thread_local size_t ThreadPool::current_queue_ = 0;
+
+ThreadPool::ThreadPool(size_t thread_num)
+    : next_queue_(0), pending_(0), stopped_(false) {
+  if (thread_num == 0) {
+    thread_num = std::max(std::thread::hardware_concurrency(), 1u);
+  }
+
+  for (size_t i = 0; i < thread_num; i++) {
+    queues_.emplace_back(std::make_unique<WorkQueue>());
+  }
+  for (size_t i = 0; i < thread_num; i++) {
+    workers_.emplace_back(&ThreadPool::Work, this, i);
+  }
+}
+
+bool ThreadPool::TryPop(size_t index, task_t* const task) {
+  for (size_t i = 0; i < queues_.size(); i++) {
+    WorkQueue* const queue = queues_[(index + i) % queues_.size()].get();
+    std::unique_lock<std::mutex> lock(queue->lock);
+    if (queue->tasks.empty()) {
+      continue;
+    }
+
+    // Own tasks are taken in LIFO order, stolen ones in FIFO order.
+    if (i == 0) {
+      *task = std::move(queue->tasks.back());
+      queue->tasks.pop_back();
+    } else {
+      *task = std::move(queue->tasks.front());
+      queue->tasks.pop_front();
+    }
+    return true;
+  }
+
+  return false;
+}
+
+void ThreadPool::Work(size_t index) {
+  current_pool_ = this;
+  current_queue_ = index;
+
+  while (true) {
+    {
+      std::unique_lock<std::mutex> lock(lock_);
+      cond_.wait(lock, [this]() { return stopped_ || pending_ != 0; });
+      if (pending_ == 0) {
+        return;
+      }
+      pending_--;
+    }
+
+    // A task has been claimed, so one is left in some deque, but a scan may
+    // miss it while the other workers take theirs.
+    task_t task;
+    while (!TryPop(index, &task)) {
+      std::this_thread::yield();
+    }
+
+    task();
+  }
+}
+
+bool ThreadPool::RunPendingTask(void) {
+  {
+    std::unique_lock<std::mutex> lock(lock_);
+    if (pending_ == 0) {
+      return false;
+    }
+    pending_--;
+  }
+
+  task_t task;
+  while (!TryPop(current_queue_, &task)) {
+    std::this_thread::yield();
+  }
+
+  task();
+  return true;
+}
+
+std::future<OramStatus> ThreadPool::Submit(
+    std::function<OramStatus(void)> task) {
+  task_t packaged(std::move(task));
+  std::future<OramStatus> future = packaged.get_future();
+
+  const size_t index = current_pool_ == this
+                           ? current_queue_
+                           : next_queue_++ % queues_.size();
+  {
+    std::unique_lock<std::mutex> lock(queues_[index]->lock);
+    queues_[index]->tasks.emplace_back(std::move(packaged));
+  }
+  {
+    std::unique_lock<std::mutex> lock(lock_);
+    pending_++;
+  }
+  cond_.notify_one();
+
+  return future;
+}
+
+OramStatus ThreadPool::WaitAll(std::vector<std::future<OramStatus>>& futures) {
+  OramStatus status = OramStatus::OK;
+  for (auto& future : futures) {
+    // A waiting worker helps with the tasks instead of blocking, since the one
+    // it waits for may be in its own deque. Once there are none left, the task
+    // runs on another worker, which may still submit more.
+    while (current_pool_ != nullptr &&
+           future.wait_for(std::chrono::seconds(0)) !=
+               std::future_status::ready) {
+      if (!current_pool_->RunPendingTask()) {
+        future.wait_for(std::chrono::milliseconds(1));
+      }
+    }
+
+    OramStatus cur = future.get();
+    if (status.ok() && !cur.ok()) {
+      status = cur;
+    }
+  }
+
+  return status;
+}
+
+ThreadPool::~ThreadPool() {
+  {
+    std::unique_lock<std::mutex> lock(lock_);
+    stopped_ = true;
+  }
+  cond_.notify_all();
+
+  for (auto& worker : workers_) {
+    worker.join();
+  }
+}
+}  // namespace oram_impl
@@ -0,0 +1,86 @@
+/*
+ Copyright (c) 2022 Haobin Chen
+
+ This program is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#ifndef ORAM_IMPL_BASE_ORAM_THREAD_POOL_H_
+#define ORAM_IMPL_BASE_ORAM_THREAD_POOL_H_
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "oram_status.h"
+
+namespace oram_impl {
+// A fixed-size pool of worker threads with work stealing. Each worker owns a
+// deque of tasks: it takes its own tasks from the back and, once it runs out,
+// steals from the front of the others. Tasks submitted by a worker go to its
+// own deque; the others are spread over the deques in turn. Each task reports
+// its result through the returned future.
+//
+// A task may wait for other tasks of the pool only through WaitAll(), which
+// runs pending tasks while it waits. Blocking on a future in any other way
+// from a worker can deadlock the pool once every worker does so, as the tasks
+// left in their deques never run.
+class ThreadPool {
+  using task_t = std::packaged_task<OramStatus(void)>;
+
+  struct WorkQueue {
+    std::mutex lock;
+    std::deque<task_t> tasks;
+  };
+
+  std::vector<std::unique_ptr<WorkQueue>> queues_;
+  std::vector<std::thread> workers_;
+  std::atomic_size_t next_queue_;
+  // The number of tasks in the deques that no worker has claimed yet.
+  size_t pending_;
+  std::mutex lock_;
+  std::condition_variable cond_;
+  bool stopped_;
+
+  // The pool and the deque of the calling thread if it is a worker.
+  static thread_local ThreadPool* current_pool_;
+  static thread_local size_t current_queue_;
+
+  bool TryPop(size_t index, task_t* const task);
+  void Work(size_t index);
+  // Claims and runs one pending task on the calling worker. Returns false if
+  // there is none.
+  bool RunPendingTask(void);
+
+ public:
+  // If `thread_num` is 0, one thread per hardware thread is started.
+  explicit ThreadPool(size_t thread_num);
+
+  std::future<OramStatus> Submit(std::function<OramStatus(void)> task);
+  size_t Size(void) const { return workers_.size(); }
+
+  // Waits for all the futures and returns the first error, if any. Called
+  // from a worker, it runs the pending tasks of the pool in the meantime.
+  static OramStatus WaitAll(std::vector<std::future<OramStatus>>& futures);
+
+  // Pending tasks are still run before the workers are joined.
+  ~ThreadPool();
+};
+}  // namespace oram_impl
+
+#endif  // ORAM_IMPL_BASE_ORAM_THREAD_POOL_H_
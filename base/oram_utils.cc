@@ -102,7 +102,27 @@ void CheckStatus(const oram_impl::OramStatus& status,
   }
 }
 
-void PadStash(oram_impl::p_oram_stash_t* const stash,
+uint32_t ReverseBits(uint32_t value, uint32_t bits) {
+  uint32_t ans = 0;
+  for (uint32_t i = 0; i < bits; i++) {
+    ans = (ans << 1) | ((value >> i) & 1);
+  }
+  return ans;
+}
+
+uint32_t DeepestCommonLevel(uint32_t lhs, uint32_t rhs, uint32_t tree_level) {
+  uint32_t diff = lhs ^ rhs;
+  uint32_t level = tree_level;
+
+  while (diff != 0) {
+    diff >>= 1;
+    level--;
+  }
+
+  return level;
+}
+
+void PadStash(oram_impl::p_oram_bucket_t* const stash,
               const size_t bucket_size) {
   const size_t stash_size = stash->size();
   if (stash_size < bucket_size) {
@@ -114,6 +134,7 @@ void PadStash(oram_impl::p_oram_stash_t* const stash,
         abort();
       }
 
+      dummy.header.type = oram_impl::BlockType::kDummy;
       stash->emplace_back(dummy);
     }
   }
@@ -172,7 +193,7 @@ oram_impl::p_oram_bucket_t DeserializeFromStringVector(
   return ans;
 }
 
-void PrintStash(const oram_impl::p_oram_stash_t& stash) {
+void PrintStash(const oram_impl::p_oram_bucket_t& stash) {
   DBG(logger, "Stash:");
 
   for (size_t i = 0; i < stash.size(); ++i) {
@@ -181,28 +202,13 @@ void PrintStash(const oram_impl::p_oram_stash_t& stash) {
   }
 }
 
-void PrintOramTree(const oram_impl::server_tree_storage_t& storage) {
-  DBG(logger, "The size of the ORAM tree is {}", storage.size());
-
-  for (auto iter = storage.begin(); iter != storage.end(); ++iter) {
-    DBG(logger, "Tag {}, {}: ", iter->first.first, iter->first.second);
-
-    for (const auto& block : iter->second) {
-      // Decompress the storage.
-      size_t size;
-      oram_impl::oram_block_t decompressed_block;
-      oram_impl::OramStatus status = DataDecompress(
-          reinterpret_cast<const uint8_t*>(block.data()), block.size(),
-          reinterpret_cast<uint8_t*>(&decompressed_block), &size);
-
-      if (!status.ok()) {
-        ERRS(logger, status.EmitString());
-      } else {
-        DBG(logger, "id: {}, type: {}", decompressed_block.header.block_id,
-            (int)decompressed_block.header.type);
-      }
-    }
-  }
+void PrintStash(const oram_impl::p_oram_stash_t& stash) {
+  DBG(logger, "Stash:");
+
+  stash.ForEachBlock([](const oram_impl::oram_block_t& block) {
+    DBG(logger, "Block {}: type : {}, data: {}", block.header.block_id,
+        (int)block.header.type, block.data[0]);
+  });
 }
 
 oram_impl::OramStatus EncryptBlock(oram_impl::oram_block_t* const block,
@@ -327,6 +333,10 @@ std::string TypeToName(oram_impl::OramType oram_type) {
       return "PartitionOram";
     case oram_impl::OramType::kCuckooOram:
       return "CuckooOram";
+    case oram_impl::OramType::kRingOram:
+      return "RingOram";
+    case oram_impl::OramType::kCircuitOram:
+      return "CircuitOram";
 
     default:
       return "InvalidOram";
@@ -356,10 +366,24 @@ oram_impl::OramType StrToType(const std::string& type) {
     return oram_impl::OramType::kPartitionOram;
   } else if (type == "CuckooOram") {
     return oram_impl::OramType::kCuckooOram;
+  } else if (type == "RingOram") {
+    return oram_impl::OramType::kRingOram;
+  } else if (type == "CircuitOram") {
+    return oram_impl::OramType::kCircuitOram;
   } else if (type == "ODS") {
     return oram_impl::OramType::kOds;
   } else {
     return oram_impl::OramType::kInvalid;
   }
 }
+
+oram_impl::EvictType StrToEvictType(const std::string& type) {
+  if (type == "Sequential") {
+    return oram_impl::EvictType::kEvictSeq;
+  } else if (type == "Random") {
+    return oram_impl::EvictType::kEvictRand;
+  } else {
+    return oram_impl::EvictType::kInvalid;
+  }
+}
 }  // namespace oram_utils
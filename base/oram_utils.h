@@ -23,6 +23,8 @@
 
 #include "oram_crypto.h"
 #include "oram_defs.h"
+#include "oram_position_map.h"
+#include "oram_stash.h"
 #include "oram_status.h"
 #include "ods_objects.h"
 
@@ -124,11 +126,21 @@ void ConvertToString(const oram_impl::oram_block_t* const block,
 void CheckStatus(const oram_impl::OramStatus& status,
                  const std::string& reason);
 
-void PadStash(oram_impl::p_oram_stash_t* const stash, const size_t bucket_size);
+// Reverses the lowest `bits` bits of `value`. Applied to a counter, this walks
+// the leaves of a tree in reverse-lexicographic order.
+uint32_t ReverseBits(uint32_t value, uint32_t bits);
 
-void PrintStash(const oram_impl::p_oram_stash_t& stash);
+// Returns the deepest level at which P(lhs) and P(rhs) intersect. Two paths
+// always share the root, and they share level l iff their leaf labels agree on
+// the first l bits (counting from the most significant one).
+uint32_t DeepestCommonLevel(uint32_t lhs, uint32_t rhs, uint32_t tree_level);
+
+void PadStash(oram_impl::p_oram_bucket_t* const stash,
+              const size_t bucket_size);
 
-void PrintOramTree(const oram_impl::server_tree_storage_t& storage);
+void PrintStash(const oram_impl::p_oram_bucket_t& stash);
+
+void PrintStash(const oram_impl::p_oram_stash_t& stash);
 
 oram_impl::OramStatus EncryptBlock(oram_impl::oram_block_t* const block,
                                    oram_crypto::Cryptor* const cryptor);
@@ -149,6 +161,8 @@ std::string TypeToName(oram_impl::OramType oram_type);
 std::vector<std::string> split(const std::string& str, char delim);
 
 oram_impl::OramType StrToType(const std::string& type);
+
+oram_impl::EvictType StrToEvictType(const std::string& type);
 }  // namespace oram_utils
 
 #endif  // ORAM_IMPL_BASE_ORAM_UTILS_H_
\ No newline at end of file
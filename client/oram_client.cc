@@ -22,10 +22,9 @@ extern std::shared_ptr<spdlog::logger> logger;
 
 namespace oram_impl {
 
-static std::shared_ptr<oram_server::Stub> CreateStub(
-    const std::string& address, uint32_t port, const std::string& crt_path) {
-  const std::string full_address = oram_utils::StrCat(address, ":", port);
-
+static std::vector<std::shared_ptr<grpc::Channel>> CreateChannels(
+    const std::string& full_address, const std::string& crt_path,
+    size_t channel_num) {
   // Configure the SSL connection.
   const std::string crt_file = oram_utils::ReadKeyCrtFile(crt_path);
   grpc::SslCredentialsOptions ssl_opts;
@@ -33,25 +32,49 @@ static std::shared_ptr<oram_server::Stub> CreateStub(
   std::shared_ptr<grpc::ChannelCredentials> ssl_creds =
       grpc::SslCredentials(ssl_opts);
 
-  // Make this stub shared among all.
-  return oram_server::NewStub(grpc::CreateChannel(full_address, ssl_creds));
+  // Channels would otherwise share one connection through the global
+  // subchannel pool, so each one gets a pool (and a connection) of its own.
+  std::vector<std::shared_ptr<grpc::Channel>> channels;
+  for (size_t i = 0; i < std::max(channel_num, (size_t)1); i++) {
+    grpc::ChannelArguments args;
+    args.SetInt(GRPC_ARG_USE_LOCAL_SUBCHANNEL_POOL, 1);
+    channels.emplace_back(
+        grpc::CreateCustomChannel(full_address, ssl_creds, args));
+  }
+
+  return channels;
 }
 
 OramClient::OramClient(const OramConfig& config) : config_(config) {
-  std::shared_ptr<oram_server::Stub> stub;
+  std::vector<std::string> endpoints;
 
   // Check if the proxy should be enabled.
   // If the `enable_proxy` is set to `true`, then the user may need to manaully
   // configure the envoy proxy server in `envoy.yaml`.
   if (!config.enable_proxy) {
-    stub = std::move(
-        CreateStub(config.server_address, config.server_port, config.crt_path));
+    endpoints = config.server_endpoints;
+    if (endpoints.empty()) {
+      endpoints.emplace_back(
+          oram_utils::StrCat(config.server_address, ":", config.server_port));
+    }
 
     // Unset it.
     unsetenv("https_proxy");
   } else {
-    stub = std::move(
-        CreateStub(config.proxy_address, config.proxy_port, config.crt_path));
+    endpoints.emplace_back(
+        oram_utils::StrCat(config.proxy_address, ":", config.proxy_port));
+  }
+
+  // Each server gets a pool of channels of its own. The stubs are shared among
+  // all; the asynchronous RPCs use the whole pool. The first server is the
+  // main one.
+  std::vector<std::shared_ptr<oram_server::Stub>> stubs;
+  std::vector<std::shared_ptr<AsyncOramStub>> async_stubs;
+  for (const std::string& endpoint : endpoints) {
+    const std::vector<std::shared_ptr<grpc::Channel>> channels =
+        CreateChannels(endpoint, config.crt_path, config.channel_num);
+    stubs.emplace_back(oram_server::NewStub(channels.front()));
+    async_stubs.emplace_back(std::make_shared<AsyncOramStub>(channels));
   }
 
   // Initialize the cryptor.
@@ -66,11 +89,50 @@ OramClient::OramClient(const OramConfig& config) : config_(config) {
     }
     case OramType::kPathOram: {
       oram_controller_ = std::make_unique<PathOramController>(
-          config.id, config.block_num, config.bucket_size, true);
+          config.id, config.block_num, config.bucket_size, true,
+          config.recursion_level, config.plb_size, config.treetop_level);
+      break;
+    }
+    case OramType::kCircuitOram: {
+      oram_controller_ = std::make_unique<CircuitOramController>(
+          config.id, config.block_num, config.bucket_size,
+          config.recursion_level, config.plb_size, config.treetop_level);
+      break;
+    }
+    case OramType::kRingOram: {
+      oram_controller_ = std::make_unique<RingOramController>(
+          config.id, config.block_num, config.bucket_size);
       break;
     }
     case OramType::kPartitionOram: {
-      oram_controller_ = std::move(PartitionOramController::GetInstance());
+      std::unique_ptr<PartitionOramController> partition_oram_controller =
+          PartitionOramController::GetInstance();
+      PANIC_IF(config.evict_type == EvictType::kInvalid,
+               "Unknown eviction type.");
+      PANIC_IF(config.adaptive_evict &&
+                   (config.nu_min == 0 || config.nu_min > config.nu_max),
+               "The bounds of the eviction rate are invalid.");
+      partition_oram_controller->Setup(config.block_num, config.bucket_size);
+      partition_oram_controller->SetNu(config.nu);
+      partition_oram_controller->SetEvictType(config.evict_type);
+      if (config.adaptive_evict) {
+        logger->warn(
+            "[!] The adaptive eviction rate leaks up to log2(3) bits about the "
+            "temporal locality of every {} accesses.",
+            config.adapt_period);
+      }
+      partition_oram_controller->SetAdaptiveEvict(
+          config.adaptive_evict, config.nu_min, config.nu_max,
+          config.adapt_period);
+      partition_oram_controller->SetSubOramType(config.sub_oram_type);
+      partition_oram_controller->SetServers(stubs, async_stubs);
+      partition_oram_controller->SetInitThreadNum(config.init_thread_num);
+      partition_oram_controller->SetEvictThreadNum(config.evict_thread_num);
+      partition_oram_controller->SetBackgroundEvict(config.background_evict,
+                                                    config.evict_backlog);
+      partition_oram_controller->SetEvictBlockNum(config.evict_block_num);
+      partition_oram_controller->SetPiggybackEvict(config.piggyback_evict);
+      oram_controller_ = std::move(partition_oram_controller);
       break;
     }
     case OramType::kSquareOram: {
@@ -83,8 +145,14 @@ OramClient::OramClient(const OramConfig& config) : config_(config) {
     }
   }
 
+  if (endpoints.size() > 1 &&
+      config.oram_type != OramType::kPartitionOram) {
+    logger->warn("[!] Only Partition ORAM uses more than one server.");
+  }
+
   // Set the stub.
-  oram_controller_->SetStub(stub);
+  oram_controller_->SetStub(stubs.front());
+  oram_controller_->SetAsyncStub(async_stubs.front());
 
   // Initialize this oram controller.
   OramStatus status = OramStatus::OK;
@@ -120,6 +188,17 @@ OramStatus OramClient::Write(uint32_t address, oram_block_t* const block) {
   return status;
 }
 
+OramStatus OramClient::BenchmarkEviction(size_t access_num) {
+  if (oram_controller_->GetOramType() != OramType::kPartitionOram) {
+    return OramStatus(StatusCode::kInvalidOperation,
+                      "Only Partition ORAM has eviction policies.", __func__);
+  }
+
+  return oram_utils::TryCast<OramController, PartitionOramController>(
+             oram_controller_.get())
+      ->BenchmarkEviction(access_num);
+}
+
 OramStatus OramClient::Ready(void) {
   auto cryptor_ = oram_crypto::Cryptor::GetInstance();
 
@@ -146,7 +225,8 @@ OramStatus OramClient::FillWithData(void) {
     std::vector<oram_block_t> blocks;
 
     // Should check if the current one is TreeOram.
-    if (oram_controller_->GetOramType() == OramType::kPathOram) {
+    if (oram_controller_->GetOramType() == OramType::kPathOram ||
+        oram_controller_->GetOramType() == OramType::kCircuitOram) {
       PathOramController* const path_oram_controller =
           oram_utils::TryCast<OramController, PathOramController>(
               oram_controller_.get());
@@ -156,6 +236,36 @@ OramStatus OramClient::FillWithData(void) {
 
       blocks =
           std::move(oram_utils::SampleRandomBucket(block_num, tree_size, 0ul));
+    } else if (oram_controller_->GetOramType() == OramType::kRingOram) {
+      RingOramController* const ring_oram_controller =
+          oram_utils::TryCast<OramController, RingOramController>(
+              oram_controller_.get());
+
+      const size_t level = ring_oram_controller->GetTreeLevel();
+      const size_t tree_size = (POW2(level + 1) - 1) * config_.bucket_size;
+
+      blocks =
+          std::move(oram_utils::SampleRandomBucket(block_num, tree_size, 0ul));
+    } else if (oram_controller_->GetOramType() == OramType::kPartitionOram) {
+      PartitionOramController* const partition_oram_controller =
+          oram_utils::TryCast<OramController, PartitionOramController>(
+              oram_controller_.get());
+
+      const size_t tree_size =
+          partition_oram_controller->GetPartitionDataSize();
+      const size_t partition_size =
+          partition_oram_controller->GetPartitionSize();
+
+      // Each partition starts with a contiguous range of the addresses. Note
+      // that only half of the sampled blocks are real.
+      for (size_t i = 0; i < partition_oram_controller->GetPartitionNum();
+           i++) {
+        const size_t begin = std::min(i * partition_size, block_num);
+        const size_t end = std::min(begin + partition_size, block_num);
+        const p_oram_bucket_t partition = oram_utils::SampleRandomBucket(
+            (end - begin) << 1, tree_size, begin);
+        blocks.insert(blocks.end(), partition.begin(), partition.end());
+      }
     } else {
       blocks =
           std::move(oram_utils::SampleRandomBucket(block_num, block_num, 0ul));
@@ -34,6 +34,8 @@ class OramClient {
   OramStatus Write(uint32_t address, oram_block_t* const block);
   OramStatus FillWithData(void);
   OramStatus Ready(void);
+  // Compares the eviction policies of Partition ORAM.
+  OramStatus BenchmarkEviction(size_t access_num);
 
   OramConfig GetConfig(void) const { return config_; }
 
@@ -0,0 +1,270 @@
+/*
+ Copyright (c) 2022 Haobin Chen
+
+ This program is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "circuit_oram_controller.h"
+
+#include <spdlog/spdlog.h>
+
+#include <algorithm>
+
+#include "base/oram_utils.h"
+
+extern std::shared_ptr<spdlog::logger> logger;
+
+namespace oram_impl {
+// The stash is treated as the level above the root. Arrays indexed by level
+// are therefore shifted by one.
+static const int kStashLevel = -1;
+static const int kNoLevel = -2;
+
+CircuitOramController::CircuitOramController(uint32_t id, uint32_t block_num,
+                                             uint32_t bucket_size,
+                                             uint32_t recursion_level,
+                                             size_t plb_size,
+                                             uint32_t treetop_level)
+    : PathOramController(id, block_num, bucket_size, true, recursion_level,
+                         plb_size, treetop_level, OramType::kCircuitOram),
+      evict_counter_(0) {}
+
+int CircuitOramController::DeepestLevelOf(uint32_t leaf, uint32_t path) const {
+  return oram_utils::DeepestCommonLevel(leaf, path, tree_level_);
+}
+
+std::vector<int> CircuitOramController::PrepareDeepest(
+    uint32_t path, const p_oram_path_t& buckets) {
+  std::vector<int> deepest(tree_level_ + 2, kNoLevel);
+  int src = kNoLevel;
+  int goal = -1;
+
+  stash_.ForEachLeaf([&](uint32_t leaf, const std::vector<uint32_t>& ids) {
+    const int level = DeepestLevelOf(leaf, path);
+    if (level > goal) {
+      goal = level;
+      src = kStashLevel;
+    }
+  });
+
+  for (int i = 0; i <= (int)tree_level_; i++) {
+    if (goal >= i) {
+      deepest[i + 1] = src;
+    }
+
+    int level = -1;
+    for (const auto& block : buckets[i]) {
+      level = std::max(level, DeepestLevelOf(block.header.leaf, path));
+    }
+
+    if (level > goal) {
+      goal = level;
+      src = i;
+    }
+  }
+
+  return deepest;
+}
+
+std::vector<int> CircuitOramController::PrepareTarget(
+    const p_oram_path_t& buckets, const std::vector<int>& deepest) {
+  std::vector<int> target(tree_level_ + 2, kNoLevel);
+  int dest = kNoLevel;
+  int src = kNoLevel;
+
+  for (int i = tree_level_; i >= kStashLevel; i--) {
+    if (i == src) {
+      target[i + 1] = dest;
+      dest = kNoLevel;
+      src = kNoLevel;
+    }
+
+    // A block is pulled down to level i if there is room for it, or if the
+    // block currently at level i is itself going to be moved further down.
+    if (i != kStashLevel && deepest[i + 1] != kNoLevel &&
+        ((dest == kNoLevel && buckets[i].size() < bucket_size_) ||
+         target[i + 1] != kNoLevel)) {
+      src = deepest[i + 1];
+      dest = i;
+    }
+  }
+
+  return target;
+}
+
+oram_block_t CircuitOramController::TakeDeepestFromStash(uint32_t path) {
+  int deepest_level = -1;
+  uint32_t block_id = 0;
+  stash_.ForEachLeaf([&](uint32_t leaf, const std::vector<uint32_t>& ids) {
+    const int level = DeepestLevelOf(leaf, path);
+    if (level > deepest_level) {
+      deepest_level = level;
+      block_id = ids.back();
+    }
+  });
+
+  const oram_block_t block = *stash_.Find(block_id);
+  stash_.Remove(block_id);
+  return block;
+}
+
+oram_block_t CircuitOramController::TakeDeepestFromBucket(
+    uint32_t path, p_oram_bucket_t* bucket) {
+  auto iter = std::max_element(
+      bucket->begin(), bucket->end(),
+      [&](const oram_block_t& lhs, const oram_block_t& rhs) {
+        return DeepestLevelOf(lhs.header.leaf, path) <
+               DeepestLevelOf(rhs.header.leaf, path);
+      });
+
+  const oram_block_t block = *iter;
+  bucket->erase(iter);
+  return block;
+}
+
+OramStatus CircuitOramController::EvictOnceFast(uint32_t path) {
+  p_oram_path_t buckets;
+  OramStatus status = ReadFullPath(path, &buckets);
+  if (!status.ok()) {
+    return status;
+  }
+
+  for (auto& bucket : buckets) {
+    bucket.erase(std::remove_if(bucket.begin(), bucket.end(),
+                                [](const oram_block_t& block) {
+                                  return block.header.type !=
+                                         BlockType::kNormal;
+                                }),
+                 bucket.end());
+  }
+
+  // The metadata pre-scan.
+  const std::vector<int> deepest = PrepareDeepest(path, buckets);
+  const std::vector<int> target = PrepareTarget(buckets, deepest);
+
+  // A single pass from the stash down to the leaf, holding at most one block.
+  oram_block_t hold;
+  bool holding = false;
+  int dest = kNoLevel;
+  for (int i = kStashLevel; i <= (int)tree_level_; i++) {
+    oram_block_t to_write;
+    bool writing = false;
+
+    if (holding && i == dest) {
+      to_write = hold;
+      writing = true;
+      holding = false;
+      dest = kNoLevel;
+    }
+
+    if (target[i + 1] != kNoLevel) {
+      hold = i == kStashLevel ? TakeDeepestFromStash(path)
+                              : TakeDeepestFromBucket(path, &buckets[i]);
+      holding = true;
+      dest = target[i + 1];
+    }
+
+    if (writing) {
+      buckets[i].emplace_back(to_write);
+    }
+  }
+
+  for (auto& bucket : buckets) {
+    oram_utils::PadStash(&bucket, bucket_size_);
+  }
+
+  return WriteFullPath(path, buckets);
+}
+
+OramStatus CircuitOramController::InternalAccessDirect(Operation op_type,
+                                                       uint32_t address,
+                                                       uint32_t x,
+                                                       oram_block_t* const data,
+                                                       bool dummy) {
+  // Read P(x) and remove the requested block from it; the rest of the path is
+  // written back unchanged.
+  p_oram_path_t buckets;
+  OramStatus status = ReadFullPath(x, &buckets);
+  if (!status.ok()) {
+    return status.Append(
+        OramStatus(StatusCode::kInvalidOperation,
+                   oram_utils::StrCat("Failed to read path ", x), __func__));
+  }
+
+  for (auto& bucket : buckets) {
+    auto iter = std::find_if(
+        bucket.begin(), bucket.end(), [&](const oram_block_t& block) {
+          return !dummy && block.header.type == BlockType::kNormal &&
+                 block.header.block_id == address;
+        });
+
+    if (iter != bucket.end()) {
+      stash_.Insert(*iter, iter->header.leaf);
+      *iter = bucket.back();
+      bucket.pop_back();
+      oram_utils::PadStash(&bucket, bucket_size_);
+    }
+  }
+
+  status = WriteFullPath(x, buckets);
+  if (!status.ok()) {
+    return status;
+  }
+
+  // Update the block in the stash and give it its new leaf.
+  if (!dummy) {
+    uint32_t position;
+    status = GetPosition(address, &position);
+    if (!status.ok()) {
+      return status;
+    }
+
+    oram_block_t* const block = stash_.Find(address);
+    if (block == nullptr) {
+      return OramStatus(StatusCode::kObjectNotFound,
+                        oram_utils::StrCat("Failed to find the block ", address,
+                                           " in the stash!"),
+                        __func__);
+    }
+
+    if (op_type == Operation::kWrite) {
+      memcpy(block->data, data->data, DEFAULT_ORAM_DATA_SIZE);
+      block->header.data_len = data->header.data_len;
+    } else {
+      memcpy(data, block, ORAM_BLOCK_SIZE);
+    }
+
+    if (op_type == Operation::kRead && IsPositionBlock(address)) {
+      // The position block is checked out into the PLB.
+      stash_.Remove(address);
+    } else {
+      stash_.UpdateLeaf(address, position);
+    }
+  }
+
+  // Two evictions per access on paths in reverse-lexicographic order; two
+  // consecutive ones always fall into different halves of the tree.
+  for (size_t i = 0; i < 2; i++) {
+    const uint32_t path =
+        oram_utils::ReverseBits(evict_counter_++ % number_of_leafs_,
+                                tree_level_);
+    status = EvictOnceFast(path);
+    if (!status.ok()) {
+      return status;
+    }
+  }
+  stash_size_ = std::max(stash_size_, stash_.size());
+
+  return OramStatus::OK;
+}
+}  // namespace oram_impl
@@ -0,0 +1,64 @@
+/*
+ Copyright (c) 2022 Haobin Chen
+
+ This program is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#ifndef ORAM_IMPL_CORE_CIRCUIT_ORAM_CONTROLLER_H_
+#define ORAM_IMPL_CORE_CIRCUIT_ORAM_CONTROLLER_H_
+
+#include "path_oram_controller.h"
+
+namespace oram_impl {
+// This class is the implementation of the ORAM controller for Circuit ORAM
+// (Wang et al., CCS '15). It shares the tree layout, the stash, the position
+// map and the RPCs with Path ORAM, but an access only reads and removes the
+// requested block from its path, and then evicts two paths chosen in
+// reverse-lexicographic order. Each eviction moves at most one block per
+// level in a single pass from the root to the leaf, as directed by a metadata
+// pre-scan, which keeps the stash at a small constant size.
+class CircuitOramController : public PathOramController {
+  // The number of paths evicted so far.
+  uint32_t evict_counter_;
+
+  // ==================== Begin private methods ==================== //
+  // The deepest level on P(path) that a block with leaf `leaf` can reach.
+  int DeepestLevelOf(uint32_t leaf, uint32_t path) const;
+  // For each level i, the level (or the stash) holding the block that can go
+  // deepest among all blocks above i, if that block can reach level i.
+  std::vector<int> PrepareDeepest(uint32_t path, const p_oram_path_t& buckets);
+  // For each level i (and the stash), the level that the block taken from i
+  // should be dropped to during the eviction.
+  std::vector<int> PrepareTarget(const p_oram_path_t& buckets,
+                                 const std::vector<int>& deepest);
+  // Takes the block that can go deepest on P(path) out of the stash.
+  oram_block_t TakeDeepestFromStash(uint32_t path);
+  // Takes the block that can go deepest on P(path) out of the bucket.
+  oram_block_t TakeDeepestFromBucket(uint32_t path, p_oram_bucket_t* bucket);
+  OramStatus EvictOnceFast(uint32_t path);
+  // ==================== End private methods ==================== //
+ protected:
+  virtual OramStatus InternalAccessDirect(Operation op_type, uint32_t address,
+                                          uint32_t position,
+                                          oram_block_t* const data,
+                                          bool dummy = false) override;
+
+ public:
+  CircuitOramController(uint32_t id, uint32_t block_num, uint32_t bucket_size,
+                        uint32_t recursion_level = 0,
+                        size_t plb_size = kDefaultPlbSize,
+                        uint32_t treetop_level = 0);
+};
+}  // namespace oram_impl
+
+#endif  // ORAM_IMPL_CORE_CIRCUIT_ORAM_CONTROLLER_H_
@@ -128,28 +128,27 @@ OramStatus LinearOramController::InitOram(void) {
 OramStatus LinearOramController::FillWithData(
     const std::vector<oram_block_t>& data) {
   // We always assume that `data` is properly permuted in a secure way.
-  grpc::ClientContext context;
-  FlatVectorMessage request;
-  google::protobuf::Empty empty;
+  size_t p_data = 0;
+  OramStatus status = BulkLoad([&](BulkLoadRequest* const chunk,
+                                   bool* const done) {
+    for (size_t chunk_size = 0;
+         p_data < data.size() && chunk_size < kBulkLoadChunkSize; p_data++) {
+      chunk_size += AppendToChunk(data[p_data], chunk);
+    }
 
-  ASSEMBLE_HEADER(request, id_, instance_hash_, GetVersion());
+    *done = p_data == data.size();
+    return OramStatus::OK;
+  });
 
-  std::string content;
-  for (size_t i = 0; i < data.size(); i++) {
-    oram_block_t block = data[i];
-    oram_utils::EncryptBlock(&block, cryptor_.get());
-    content.append(
-        std::string(reinterpret_cast<char*>(&block), ORAM_BLOCK_SIZE));
+  if (!status.ok()) {
+    return status.Append(OramStatus(StatusCode::kServerError,
+                                    "Cannot load the data to the server side",
+                                    __func__));
   }
-  request.set_content(content);
 
   // Set initialized.
   is_initialized_ = true;
 
-  return stub_->WriteFlatMemory(&context, request, &empty).ok()
-             ? OramStatus::OK
-             : OramStatus(StatusCode::kServerError,
-                          "Cannot invoke WriteFlatMemory on the server side",
-                          __func__);
+  return OramStatus::OK;
 }
 }  // namespace oram_impl
\ No newline at end of file
@@ -24,7 +24,9 @@
 #include "ods_cache.h"
 #include "oram_controller.h"
 #include "partition_oram_controller.h"
+#include "circuit_oram_controller.h"
 #include "path_oram_controller.h"
+#include "ring_oram_controller.h"
 #include "square_root_oram_controller.h"
 
 namespace oram_impl {
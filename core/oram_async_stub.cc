@@ -0,0 +1,79 @@
+/*
+ Copyright (c) 2022 Haobin Chen
+
+ This program is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "oram_async_stub.h"
+
+#include "base/oram_utils.h"
+
+namespace oram_impl {
+AsyncOramStub::AsyncOramStub(
+    const std::vector<std::shared_ptr<grpc::Channel>>& channels)
+    : next_stub_(0ul) {
+  PANIC_IF(channels.empty(), "The channel pool cannot be empty.");
+
+  for (const auto& channel : channels) {
+    stubs_.emplace_back(oram_server::NewStub(channel));
+  }
+  poller_ = std::thread(&AsyncOramStub::Poll, this);
+}
+
+void AsyncOramStub::Poll(void) {
+  void* tag;
+  bool ok;
+  while (cq_.Next(&tag, &ok)) {
+    std::unique_ptr<AsyncCall> call(static_cast<AsyncCall*>(tag));
+    call->promise.set_value(
+        ok ? call->status
+           : grpc::Status(grpc::StatusCode::CANCELLED,
+                          "The call was not completed."));
+  }
+}
+
+template <typename Request, typename Response>
+std::future<grpc::Status> AsyncOramStub::Call(
+    std::unique_ptr<grpc::ClientAsyncResponseReader<Response>> (
+        oram_server::Stub::*prepare)(grpc::ClientContext*, const Request&,
+                                     grpc::CompletionQueue*),
+    const Request& request, Response* const response) {
+  AsyncResponseCall<Response>* const call = new AsyncResponseCall<Response>();
+  std::future<grpc::Status> future = call->promise.get_future();
+
+  oram_server::Stub* const stub = stubs_[next_stub_++ % stubs_.size()].get();
+  call->reader = (stub->*prepare)(&call->context, request, &cq_);
+  call->reader->StartCall();
+  // The call is freed by the poller.
+  call->reader->Finish(response, &call->status, call);
+
+  return future;
+}
+
+std::future<grpc::Status> AsyncOramStub::ReadFullPath(
+    const ReadFullPathRequest& request, ReadFullPathResponse* const response) {
+  return Call(&oram_server::Stub::PrepareAsyncReadFullPath, request, response);
+}
+
+std::future<grpc::Status> AsyncOramStub::WriteFullPath(
+    const WriteFullPathRequest& request, WritePathResponse* const response) {
+  return Call(&oram_server::Stub::PrepareAsyncWriteFullPath, request,
+              response);
+}
+
+AsyncOramStub::~AsyncOramStub() {
+  // Pending calls are still delivered before Next() returns false.
+  cq_.Shutdown();
+  poller_.join();
+}
+}  // namespace oram_impl
@@ -0,0 +1,85 @@
+/*
+ Copyright (c) 2022 Haobin Chen
+
+ This program is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#ifndef ORAM_IMPL_CORE_ORAM_ASYNC_STUB_H_
+#define ORAM_IMPL_CORE_ORAM_ASYNC_STUB_H_
+
+#include <grpc++/grpc++.h>
+
+#include <atomic>
+#include <future>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "protos/messages.grpc.pb.h"
+
+namespace oram_impl {
+// The asynchronous client layer for the ORAM server. Calls are spread
+// round-robin over a pool of channels so that independent sub-ORAMs do not
+// queue up behind a single connection, and they are all completed on one
+// gRPC CompletionQueue drained by a background thread. Each call returns a
+// future that becomes ready once the response has arrived, so a caller can
+// keep many calls in flight and wait for them together.
+class AsyncOramStub {
+  // The tag of a call on the CompletionQueue; it owns everything the call
+  // needs until it is completed.
+  struct AsyncCall {
+    grpc::ClientContext context;
+    grpc::Status status;
+    std::promise<grpc::Status> promise;
+
+    virtual ~AsyncCall() {}
+  };
+
+  template <typename Response>
+  struct AsyncResponseCall : public AsyncCall {
+    std::unique_ptr<grpc::ClientAsyncResponseReader<Response>> reader;
+  };
+
+  std::vector<std::unique_ptr<oram_server::Stub>> stubs_;
+  std::atomic_size_t next_stub_;
+  grpc::CompletionQueue cq_;
+  std::thread poller_;
+
+  // ==================== Begin private methods ==================== //
+  void Poll(void);
+
+  template <typename Request, typename Response>
+  std::future<grpc::Status> Call(
+      std::unique_ptr<grpc::ClientAsyncResponseReader<Response>> (
+          oram_server::Stub::*prepare)(grpc::ClientContext*, const Request&,
+                                       grpc::CompletionQueue*),
+      const Request& request, Response* const response);
+  // ==================== End private methods ==================== //
+
+ public:
+  explicit AsyncOramStub(
+      const std::vector<std::shared_ptr<grpc::Channel>>& channels);
+
+  // `response` must stay alive until the returned future is ready.
+  std::future<grpc::Status> ReadFullPath(const ReadFullPathRequest& request,
+                                         ReadFullPathResponse* const response);
+  std::future<grpc::Status> WriteFullPath(const WriteFullPathRequest& request,
+                                          WritePathResponse* const response);
+
+  size_t GetChannelNum(void) const { return stubs_.size(); }
+
+  ~AsyncOramStub();
+};
+}  // namespace oram_impl
+
+#endif  // ORAM_IMPL_CORE_ORAM_ASYNC_STUB_H_
@@ -19,6 +19,10 @@
 #include <spdlog/logger.h>
 #include <spdlog/fmt/bin_to_hex.h>
 
+#include <future>
+
+#include "oram.h"
+
 extern std::shared_ptr<spdlog::logger> logger;
 
 namespace oram_impl {
@@ -80,4 +84,97 @@ OramStatus OramController::KeyNegotiate(void) {
   return OramStatus::OK;
 }
 
+OramStatus OramController::InternalEvict(std::vector<oram_block_t>& blocks) {
+  for (oram_block_t& block : blocks) {
+    OramStatus status = InternalAccess(Operation::kWrite,
+                                       block.header.block_id, &block, false);
+    if (!status.ok()) {
+      return status;
+    }
+  }
+
+  return OramStatus::OK;
+}
+
+OramStatus OramController::BulkLoad(const bulk_load_producer_t& producer) {
+  grpc::ClientContext context;
+  google::protobuf::Empty empty;
+  std::unique_ptr<grpc::ClientWriterInterface<BulkLoadRequest>> writer =
+      stub_->BulkLoad(&context, &empty);
+
+  bool done = false;
+  auto prepare = [&](BulkLoadRequest* const chunk) {
+    ASSEMBLE_HEADER((*chunk), id_, instance_hash_, GetVersion());
+    return producer(chunk, &done);
+  };
+
+  // Double buffering: `chunk` is on the wire while `next` is being prepared.
+  // The writer blocks when the transport is full, which is the flow control.
+  BulkLoadRequest chunk;
+  BulkLoadRequest next;
+  OramStatus status = prepare(&chunk);
+  while (status.ok()) {
+    const bool last = done;
+    std::future<OramStatus> pending;
+    if (!last) {
+      next.Clear();
+      pending = std::async(std::launch::async, prepare, &next);
+    }
+
+    const bool sent = writer->Write(chunk);
+    if (last) {
+      break;
+    }
+
+    status = pending.get();
+    if (!sent) {
+      break;
+    }
+    chunk.Swap(&next);
+  }
+
+  if (!status.ok()) {
+    context.TryCancel();
+  } else {
+    writer->WritesDone();
+  }
+
+  grpc::Status grpc_status = writer->Finish();
+  if (!status.ok()) {
+    return status.Append(OramStatus(StatusCode::kInvalidOperation,
+                                    "Failed to prepare the data", __func__));
+  } else if (!grpc_status.ok()) {
+    return OramStatus(StatusCode::kServerError, grpc_status.error_message(),
+                      __func__);
+  }
+
+  return OramStatus::OK;
+}
+
+size_t OramController::AppendToChunk(uint32_t level, uint32_t offset,
+                                     const p_oram_bucket_t& bucket,
+                                     BulkLoadRequest* const chunk) {
+  BulkLoadBucketMessage* const message = chunk->add_buckets();
+  message->set_level(level);
+  message->set_offset(offset);
+
+  for (auto block : bucket) {
+    oram_utils::EncryptBlock(&block, cryptor_.get());
+    std::string block_str;
+    oram_utils::ConvertToString(&block, &block_str);
+    message->add_bucket(block_str);
+  }
+
+  return bucket.size() * ORAM_BLOCK_SIZE;
+}
+
+size_t OramController::AppendToChunk(oram_block_t block,
+                                     BulkLoadRequest* const chunk) {
+  oram_utils::EncryptBlock(&block, cryptor_.get());
+  std::string block_str;
+  oram_utils::ConvertToString(&block, &block_str);
+  chunk->add_blocks(block_str);
+
+  return ORAM_BLOCK_SIZE;
+}
 }  // namespace oram_impl
@@ -20,6 +20,7 @@
 #include <grpc++/grpc++.h>
 
 #include <chrono>
+#include <functional>
 #include <memory>
 #include <string>
 #include <unordered_map>
@@ -30,10 +31,14 @@
 #include "base/oram_utils.h"
 #include "base/oram_defs.h"
 #include "base/oram_status.h"
+#include "oram_async_stub.h"
 #include "protos/messages.grpc.pb.h"
 
 namespace oram_impl {
 class OramController {
+  // The partitions of Partition ORAM are accessed through InternalAccess().
+  friend class PartitionOramController;
+
  protected:
   const uint32_t id_;
   // Whether this pathoram conroller is a standalone controller
@@ -48,6 +53,9 @@ class OramController {
 
   // An object used to call some methods of ORAM storage on the cloud.
   std::shared_ptr<oram_server::Stub> stub_;
+  // The optional asynchronous layer over a pool of channels. Controllers that
+  // support it keep several RPCs in flight; the others only use `stub_`.
+  std::shared_ptr<AsyncOramStub> async_stub_;
   // Cryptography manager.
   std::shared_ptr<oram_crypto::Cryptor> cryptor_;
 
@@ -58,9 +66,39 @@ class OramController {
   // This interface is reserved for other ORAMs that use this ORAM controller as
   // its backbone; sometimes the high-level ORAM will need to perform some fake
   // operations (e.g., the Partition ORAM).
+  //
+  // A controller that is not standalone can be a partition of Partition ORAM:
+  // a read removes the block from the ORAM, and a write of a block that is not
+  // in the ORAM inserts it.
   virtual OramStatus InternalAccess(Operation op_type, uint32_t address,
                                     oram_block_t* const data,
                                     bool dummy = false) = 0;
+  // Moves the blocks that Partition ORAM evicts from a slot into this ORAM. By
+  // default each of them takes one write, which shows the server how many
+  // blocks there are, so every sub-ORAM of Partition ORAM overrides this with
+  // a single access.
+  virtual OramStatus InternalEvict(std::vector<oram_block_t>& blocks);
+  // Hands the blocks to this ORAM so that its next access writes them back
+  // along with its own path, for the piggybacked eviction of Partition ORAM.
+  virtual OramStatus InternalPiggyback(std::vector<oram_block_t>& blocks) {
+    return OramStatus(StatusCode::kUnimplemented,
+                      oram_utils::StrCat(GetName(),
+                                         " cannot piggyback evicted blocks."),
+                      __func__);
+  }
+
+  // Fills `chunk` with the next part of the initial data and sets `done` once
+  // nothing is left.
+  using bulk_load_producer_t =
+      std::function<OramStatus(BulkLoadRequest* const chunk, bool* const done)>;
+  // Streams the chunks made by `producer` to the server by BulkLoad. The next
+  // chunk is prepared (and encrypted) while the current one is being sent.
+  OramStatus BulkLoad(const bulk_load_producer_t& producer);
+  // Encrypts the bucket / block into the chunk and returns its size in bytes.
+  size_t AppendToChunk(uint32_t level, uint32_t offset,
+                       const p_oram_bucket_t& bucket,
+                       BulkLoadRequest* const chunk);
+  size_t AppendToChunk(oram_block_t block, BulkLoadRequest* const chunk);
 
  public:
   OramController(uint32_t id, bool standalone, size_t block_num,
@@ -84,10 +122,21 @@ class OramController {
   virtual size_t GetBlockNum(void) const { return block_num_; }
   virtual bool IsStandAlone(void) const { return standalone_; }
   virtual bool IsInitialized(void) const { return is_initialized_; }
+  // The number of blocks, dummies included, that FillWithData() expects.
+  virtual size_t GetDataSize(void) const { return block_num_; }
+
+  virtual size_t ReportClientStorage(void) const { return 0ul; }
+  virtual size_t ReportNetworkCommunication(void) const { return 0ul; }
+  virtual std::chrono::microseconds ReportNetworkingTime(void) const {
+    return std::chrono::microseconds(0);
+  }
 
   virtual void SetStub(std::shared_ptr<oram_server::Stub> stub) {
     stub_ = stub;
   }
+  virtual void SetAsyncStub(std::shared_ptr<AsyncOramStub> async_stub) {
+    async_stub_ = async_stub;
+  }
 
   virtual std::string GetName(void) const {
     return oram_utils::TypeToName(oram_type_);
@@ -96,6 +145,7 @@ class OramController {
   virtual ~OramController() {
     // Because they are shared pointers, we cannot directly drop them.
     stub_.reset();
+    async_stub_.reset();
     cryptor_.reset();
   }
 };
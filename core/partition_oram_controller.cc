@@ -19,6 +19,9 @@
 #include <spdlog/fmt/bin_to_hex.h>
 #include <spdlog/spdlog.h>
 
+#include "path_oram_controller.h"
+#include "ring_oram_controller.h"
+
 extern std::shared_ptr<spdlog::logger> logger;
 
 using std::chrono_literals::operator""us;
@@ -46,12 +49,10 @@ PartitionOramController::GetInstance() {
 OramStatus PartitionOramController::Access(Operation op_type, uint32_t address,
                                            oram_block_t* const data) {
   auto begin_access = std::chrono::high_resolution_clock::now();
-  // A temporary buffer that holds the data.
-  oram_block_t block;
   // Sample a new random slot id for this block.
   uint32_t new_slot_id;
   OramStatus status = oram_crypto::UniformRandom(
-      0, path_oram_controllers_.size() - 1, &new_slot_id);
+      0, sub_oram_controllers_.size() - 1, &new_slot_id);
   oram_utils::CheckStatus(status, "Failed to sample a new slot id.");
 
   // Get the position (i.e., the slot id) from the position map.
@@ -62,26 +63,32 @@ OramStatus PartitionOramController::Access(Operation op_type, uint32_t address,
 
   DBG(logger, "New slot id: {} for address: {}", new_slot_id, address);
 
-  // Get the PathOram controller.
-  PathOramController* const controller = path_oram_controllers_[slot_id].get();
-  // Check if the block is already in the slot.
-  // If there is no such block, we read it from the server and then
-  // add it to the slot.
-  auto iter = std::find_if(slots_[slot_id].begin(), slots_[slot_id].end(),
-                           BlockEqual(address));
-  if (iter == slots_[slot_id].end()) {
-    // Read the block from the PathORAM controller.
-    status = controller->InternalAccess(op_type, address, &block, false);
-  } else {
-    // Invoke a dummy read.
-    OramStatus status =
-        controller->InternalAccess(Operation::kRead, address, nullptr, true);
-    oram_utils::CheckStatus(status, "Cannot perform fake read!");
-    // Read the block directly from the slot.
-    block = *iter;
-    // Expire the iterator.
-    slots_[slot_id].erase(iter);
+  // A temporary buffer that holds the data.
+  oram_block_t block;
+  {
+    std::unique_lock<std::mutex> lock(*partition_locks_[slot_id]);
+    // Get the PathOram controller.
+    OramController* const controller =
+        sub_oram_controllers_[slot_id].get();
+    // Check if the block is already in the slot.
+    // If there is no such block, we read it from the server and then
+    // add it to the slot; otherwise we take it out of the slot directly.
+    const bool in_slot = slots_.Take(slot_id, address, &block);
+    // Call piggy-backed eviction. (optional) The blocks handed over are
+    // written back by the access below.
+    status = piggyback_evict_ ? Piggyback(slot_id) : OramStatus::OK;
+    if (status.ok() && !in_slot) {
+      // Read and remove the block from the sub-ORAM whatever the operation;
+      // a write only updates the block once it is in the slot.
+      status = controller->InternalAccess(Operation::kRead, address, &block,
+                                          false);
+    } else if (status.ok()) {
+      // Invoke a dummy read.
+      status =
+          controller->InternalAccess(Operation::kRead, address, nullptr, true);
+    }
   }
+  oram_utils::CheckStatus(status, "Failed to access the sub-ORAM!");
 
   // Update the block if the operation is write.
   if (op_type == Operation::kWrite) {
@@ -91,7 +98,13 @@ OramStatus PartitionOramController::Access(Operation op_type, uint32_t address,
   }
 
   // Add the block to the slot.
-  slots_[new_slot_id].emplace_back(block);
+  size_t slot_occupancy;
+  {
+    std::unique_lock<std::mutex> lock(*partition_locks_[new_slot_id]);
+    slots_.Insert(new_slot_id, block);
+    slot_occupancy = slots_.Occupancy(new_slot_id);
+  }
+  RecordOccupancy(slot_occupancy);
 
   auto end_access = std::chrono::high_resolution_clock::now();
 
@@ -100,12 +113,16 @@ OramStatus PartitionOramController::Access(Operation op_type, uint32_t address,
                                                              begin_access)
            .count());
 
-  // Call piggy-backed eviction. (optional)
-  // NO piggyback-ed eviction is implemented for PathORAM.
-
-  // status = SequentialEvict();
+  // All the evictions are submitted at the same point once the block is in its
+  // new slot, so when they happen does not depend on the slots touched by
+  // this access. The partition locks keep those of the same slot in order.
   auto begin_evict = std::chrono::high_resolution_clock::now();
-  status = RandomEvict();
+  std::vector<std::future<OramStatus>> futures;
+  for (const uint32_t id : SampleEvictSlots()) {
+    futures.emplace_back(SubmitEvict(id));
+  }
+  AdaptEvictRate();
+  status = FinishEvictions(futures);
   oram_utils::CheckStatus(status, "Failed to perform eviction!");
   auto end_evict = std::chrono::high_resolution_clock::now();
 
@@ -117,67 +134,342 @@ OramStatus PartitionOramController::Access(Operation op_type, uint32_t address,
   return OramStatus::OK;
 }
 
+// The batch is served in three steps: every address is fetched once from its
+// partition, with the partitions served concurrently; the requests are then
+// applied in order to the fetched blocks; and finally the blocks are moved to
+// new random slots, followed by \nu evictions per request.
+OramStatus PartitionOramController::AccessBatch(std::vector<BatchOp>& ops) {
+  auto begin_access = std::chrono::high_resolution_clock::now();
+  // Each address is fetched once, in the order of its first request.
+  absl::flat_hash_map<uint32_t, size_t> index;
+  std::vector<BatchEntry> entries;
+  for (const BatchOp& op : ops) {
+    if (index.emplace(op.address, entries.size()).second) {
+      entries.push_back({position_map_[op.address], op.address, false});
+    }
+  }
+
+  // Pad with dummy reads of random slots to one access per request. As the
+  // slot of a block is sampled afresh on every access, the server then sees
+  // as many accesses as requests, each to a uniformly random partition.
+  while (entries.size() < ops.size()) {
+    uint32_t slot_id;
+    oram_utils::CheckStatus(
+        oram_crypto::UniformRandom(0, sub_oram_controllers_.size() - 1,
+                                   &slot_id),
+        "Failed to sample a slot id.");
+    entries.push_back({slot_id, 0, true});
+  }
+
+  std::vector<std::vector<BatchEntry*>> groups(sub_oram_controllers_.size());
+  for (BatchEntry& entry : entries) {
+    groups[entry.slot_id].emplace_back(&entry);
+  }
+  std::vector<std::future<OramStatus>> futures;
+  for (size_t i = 0; i < groups.size(); i++) {
+    if (!groups[i].empty()) {
+      const std::vector<BatchEntry*>* const group = &groups[i];
+      futures.emplace_back(
+          evict_pool_->Submit([=]() { return FetchBatch(i, *group); }));
+    }
+  }
+  OramStatus status = ThreadPool::WaitAll(futures);
+  oram_utils::CheckStatus(status, "Failed to access the sub-ORAMs!");
+
+  for (BatchOp& op : ops) {
+    oram_block_t& block = entries[index[op.address]].block;
+    // Update the block if the operation is write.
+    if (op.op_type == Operation::kWrite) {
+      block = *op.data;
+    } else {
+      *op.data = block;
+    }
+  }
+
+  // Add the blocks to their new slots.
+  size_t max_slot_occupancy = 0;
+  for (const BatchEntry& entry : entries) {
+    if (entry.dummy) {
+      continue;
+    }
+
+    uint32_t new_slot_id;
+    oram_utils::CheckStatus(
+        oram_crypto::UniformRandom(0, sub_oram_controllers_.size() - 1,
+                                   &new_slot_id),
+        "Failed to sample a new slot id.");
+    position_map_[entry.address] = new_slot_id;
+
+    std::unique_lock<std::mutex> lock(*partition_locks_[new_slot_id]);
+    slots_.Insert(new_slot_id, entry.block);
+    max_slot_occupancy =
+        std::max(max_slot_occupancy, slots_.Occupancy(new_slot_id));
+  }
+  RecordOccupancy(max_slot_occupancy);
+
+  auto end_access = std::chrono::high_resolution_clock::now();
+
+  INFO(logger, "[+] Batch access time: {} us for {} requests.",
+       std::chrono::duration_cast<std::chrono::microseconds>(end_access -
+                                                             begin_access)
+           .count(),
+       ops.size());
+
+  auto begin_evict = std::chrono::high_resolution_clock::now();
+  futures.clear();
+  for (size_t i = 0; i < entries.size(); i++) {
+    for (const uint32_t id : SampleEvictSlots()) {
+      futures.emplace_back(SubmitEvict(id));
+    }
+    // The rate changes after the same access as without batching.
+    AdaptEvictRate();
+  }
+  status = FinishEvictions(futures);
+  oram_utils::CheckStatus(status, "Failed to perform eviction!");
+  auto end_evict = std::chrono::high_resolution_clock::now();
+
+  INFO(logger, "[+] Batch eviction time: {} us.",
+       std::chrono::duration_cast<std::chrono::microseconds>(end_evict -
+                                                             begin_evict)
+           .count());
+
+  return OramStatus::OK;
+}
+
+OramStatus PartitionOramController::FetchBatch(
+    uint32_t slot_id, const std::vector<BatchEntry*>& group) {
+  std::unique_lock<std::mutex> lock(*partition_locks_[slot_id]);
+  OramController* const controller = sub_oram_controllers_[slot_id].get();
+  for (BatchEntry* const entry : group) {
+    OramStatus status = piggyback_evict_ ? Piggyback(slot_id) : OramStatus::OK;
+    if (!status.ok()) {
+      return status;
+    }
+
+    if (entry->dummy ||
+        !slots_.Take(slot_id, entry->address, &entry->block)) {
+      status = controller->InternalAccess(Operation::kRead, entry->address,
+                                          &entry->block, entry->dummy);
+    } else {
+      // The block is taken from the slot; invoke a dummy read.
+      status = controller->InternalAccess(Operation::kRead, entry->address,
+                                          nullptr, true);
+    }
+
+    if (!status.ok()) {
+      return status;
+    }
+  }
+
+  return OramStatus::OK;
+}
+
 OramStatus PartitionOramController::Evict(uint32_t id) {
   DBG(logger, "Evicting slot {}", id);
-  PathOramController* const controller = path_oram_controllers_[id].get();
-  if (slots_[id].empty()) {
+  std::unique_lock<std::mutex> lock(*partition_locks_[id]);
+  OramController* const controller = sub_oram_controllers_[id].get();
+  if (slots_.Empty(id)) {
     // Perform a fake write.
     return controller->InternalAccess(Operation::kWrite, 0, nullptr, true);
   } else {
     DBG(logger, "---------------EVICT------------------");
-    oram_utils::PrintStash(slots_[id]);
+    oram_utils::PrintStash(slots_.Blocks(id));
     DBG(logger, "---------------EVICT------------------");
-    oram_block_t block = slots_[id].back();
-    slots_[id].pop_back();
-    return controller->InternalAccess(Operation::kWrite, block.header.block_id,
-                                      &block, false);
+    // Drain up to `evict_block_num_` blocks into the sub-ORAM at once.
+    std::vector<oram_block_t> blocks = DrainSlot(id);
+    return controller->InternalEvict(blocks);
+  }
+}
+
+std::vector<oram_block_t> PartitionOramController::DrainSlot(uint32_t id) {
+  std::vector<oram_block_t> blocks;
+  oram_block_t block;
+  while (blocks.size() < evict_block_num_ && slots_.PopBack(id, &block)) {
+    blocks.emplace_back(block);
+  }
+
+  return blocks;
+}
+
+// The piggybacked blocks are written back by the access that follows, which
+// reads a path whether the slot had any block or not.
+OramStatus PartitionOramController::Piggyback(uint32_t id) {
+  std::vector<oram_block_t> blocks = DrainSlot(id);
+  return blocks.empty()
+             ? OramStatus::OK
+             : sub_oram_controllers_[id]->InternalPiggyback(blocks);
+}
+
+std::future<OramStatus> PartitionOramController::SubmitEvict(uint32_t id) {
+  {
+    // Backpressure: wait for a place in the backlog.
+    std::unique_lock<std::mutex> lock(evict_lock_);
+    evict_cond_.wait(lock,
+                     [this]() { return evict_pending_ < evict_backlog_; });
+    evict_pending_++;
+  }
+
+  return evict_pool_->Submit([=]() {
+    OramStatus status = Evict(id);
+    {
+      std::unique_lock<std::mutex> lock(evict_lock_);
+      evict_pending_--;
+      if (!status.ok() && evict_status_.ok()) {
+        evict_status_ = status;
+      }
+    }
+    evict_cond_.notify_all();
+
+    return status;
+  });
+}
+
+OramStatus PartitionOramController::FinishEvictions(
+    std::vector<std::future<OramStatus>>& futures) {
+  if (background_evict_) {
+    // The evictions are left to the pool; earlier failures are reported here.
+    std::unique_lock<std::mutex> lock(evict_lock_);
+    return TakeEvictStatus();
+  }
+
+  return ThreadPool::WaitAll(futures);
+}
+
+OramStatus PartitionOramController::WaitForEvictions(void) {
+  std::unique_lock<std::mutex> lock(evict_lock_);
+  evict_cond_.wait(lock, [this]() { return evict_pending_ == 0; });
+  return TakeEvictStatus();
+}
+
+OramStatus PartitionOramController::TakeEvictStatus(void) {
+  OramStatus status = evict_status_;
+  evict_status_ = OramStatus::OK;
+  return status;
+}
+
+OramStatus PartitionOramController::EvictSlots(
+    const std::vector<uint32_t>& ids) {
+  std::vector<std::future<OramStatus>> futures;
+  for (const uint32_t id : ids) {
+    futures.emplace_back(SubmitEvict(id));
   }
+
+  return ThreadPool::WaitAll(futures);
 }
 
 // RandomEvict samples \nu \in \mathbb{N} random slots (with replacement) to
 // evict from.
-OramStatus PartitionOramController::RandomEvict(void) {
+std::vector<uint32_t> PartitionOramController::RandomEvictSlots(void) {
   // For simplicity, we use uniform random sampling.
-  for (size_t i = 0; i < nu_; i++) {
-    uint32_t id;
+  std::vector<uint32_t> ids(SeparateEvictRate());
+  for (size_t i = 0; i < ids.size(); i++) {
     oram_utils::CheckStatus(
-        oram_crypto::UniformRandom(0, path_oram_controllers_.size() - 1, &id),
+        oram_crypto::UniformRandom(0, sub_oram_controllers_.size() - 1,
+                                   &ids[i]),
         "Failed to sample a new slot id.");
-
-    OramStatus status;
-    if (!(status = Evict(id)).ok()) {
-      return status;
-    }
   }
 
-  return OramStatus::OK;
+  return ids;
+}
+
+OramStatus PartitionOramController::RandomEvict(void) {
+  return EvictSlots(RandomEvictSlots());
 }
 
 // SequentialEvict determines the number of blocks to evict num based on a
-// prescribed dis- tribution D(ν) and sequentially scans num slots to evict
+// prescribed distribution D(ν) and sequentially scans num slots to evict
 // from. RandomEvict samples ν ∈ N random slots (with replacement) to evict
-// from.
-OramStatus PartitionOramController::SequentialEvict(void) {
-  size_t evict_num;
+// from. Here D(ν) is the Poisson distribution with mean ν, so both policies
+// evict ν blocks per access on average.
+std::vector<uint32_t> PartitionOramController::SequentialEvictSlots(void) {
+  uint32_t evict_num;
   oram_utils::CheckStatus(
-      oram_crypto::UniformRandom(0, path_oram_controllers_.size() - 1,
-                                 (uint32_t*)&evict_num),
+      oram_crypto::PoissonRandom(SeparateEvictRate(), &evict_num),
       "Failed to sample eviction number.");
+  std::vector<uint32_t> ids;
   for (size_t i = 0; i < evict_num; i++) {
-    // cnt is a global counter for the sequential scan.
-    counter_ = (counter_ + 1) % partition_size_;
+    // cnt is a global counter for the sequential scan over the slots.
+    counter_ = (counter_ + 1) % sub_oram_controllers_.size();
+    ids.emplace_back(counter_);
+  }
 
-    OramStatus status;
-    if (!(status = Evict(counter_)).ok()) {
-      return status;
+  return ids;
+}
+
+OramStatus PartitionOramController::SequentialEvict(void) {
+  return EvictSlots(SequentialEvictSlots());
+}
+
+std::vector<uint32_t> PartitionOramController::SampleEvictSlots(void) {
+  return evict_type_ == EvictType::kEvictSeq ? SequentialEvictSlots()
+                                             : RandomEvictSlots();
+}
+
+void PartitionOramController::RecordOccupancy(size_t slot_occupancy) {
+  period_max_occupancy_ =
+      std::max(period_max_occupancy_, slots_.TotalOccupancy());
+  period_max_slot_occupancy_ =
+      std::max(period_max_slot_occupancy_, slot_occupancy);
+}
+
+// The slots are meant to hold about one block per partition in total, which
+// keeps the client storage at O(\sqrt{N}) blocks. The rate goes up if they held
+// more than that during the period, or if a single slot filled up, and goes
+// down if they never held more than half of it. Only this three-way outcome
+// reaches the server, and only at the end of a period.
+void PartitionOramController::AdaptEvictRate(void) {
+  if (++period_access_num_ < adapt_period_) {
+    return;
+  }
+
+  if (peak_histogram_.size() <= period_max_slot_occupancy_) {
+    peak_histogram_.resize(period_max_slot_occupancy_ + 1, 0);
+  }
+  peak_histogram_[period_max_slot_occupancy_]++;
+
+  if (adaptive_evict_) {
+    const size_t target = slots_.SlotNum();
+    if ((period_max_occupancy_ > target ||
+         period_max_slot_occupancy_ > kAdaptSlotLimit) &&
+        nu_ < nu_max_) {
+      nu_++;
+    } else if (period_max_occupancy_ <= target / 2 &&
+               period_max_slot_occupancy_ <= kAdaptSlotLimit / 2 &&
+               nu_ > nu_min_) {
+      nu_--;
     }
+    DBG(logger, "The eviction rate is {} after a period with {} blocks.", nu_,
+        period_max_occupancy_);
   }
 
-  return OramStatus::OK;
+  period_access_num_ = 0;
+  period_max_occupancy_ = 0;
+  period_max_slot_occupancy_ = 0;
+}
+
+OramStatus PartitionOramController::FlushSlots(void) {
+  OramStatus status = WaitForEvictions();
+  if (!status.ok()) {
+    return status;
+  }
+
+  std::vector<uint32_t> ids;
+  for (size_t i = 0; i < slots_.SlotNum(); i++) {
+    const size_t occupancy = slots_.Occupancy(i);
+    ids.insert(ids.end(),
+               (occupancy + evict_block_num_ - 1) / evict_block_num_, i);
+  }
+
+  return EvictSlots(ids);
 }
 
 OramStatus PartitionOramController::Run(uint32_t block_num,
                                         uint32_t bucket_size) {
+  Setup(block_num, bucket_size);
+  return InitOram();
+}
+
+void PartitionOramController::Setup(uint32_t block_num, uint32_t bucket_size) {
   INFO(logger, "[+] The Partition Oram Controller is running...");
   // Determine the size of each sub-ORAM and the number of slot number.
   const size_t squared = std::ceil(std::sqrt(block_num));
@@ -188,26 +480,73 @@ OramStatus PartitionOramController::Run(uint32_t block_num,
   DBG(logger, "The Partition ORAM's config: partition_size = {} ",
       partition_size_);
   // Initialize all the slots.
-  slots_.resize(squared);
+  slots_.Resize(squared);
+  // Addresses are contiguous, so each slot id is packed into a few bits.
+  position_map_ = p_oram_position_t(block_num, squared - 1);
+}
 
-  return InitOram();
+OramStatus PartitionOramController::CreateSubOram(
+    uint32_t id, std::unique_ptr<OramController>* const controller) {
+  switch (sub_oram_type_) {
+    case OramType::kPathOram: {
+      *controller = std::make_unique<PathOramController>(
+          id, partition_size_, bucket_size_, false);
+      return OramStatus::OK;
+    }
+    case OramType::kRingOram: {
+      *controller = std::make_unique<RingOramController>(
+          id, partition_size_, bucket_size_, false);
+      return OramStatus::OK;
+    }
+    default: {
+      // The other ORAMs cannot take in the blocks that move between the
+      // partitions.
+      return OramStatus(
+          StatusCode::kInvalidArgument,
+          oram_utils::StrCat(oram_utils::TypeToName(sub_oram_type_),
+                             " cannot be a partition of Partition ORAM."),
+          __func__);
+    }
+  }
 }
 
 OramStatus PartitionOramController::InitOram(void) {
-  for (size_t i = 0; i < slots_.size(); i++) {
-    // We create the PathORAM controller for each slot.
-    path_oram_controllers_.emplace_back(std::make_unique<PathOramController>(
-        i, partition_size_, bucket_size_, false));
-    path_oram_controllers_.back()->SetStub(stub_);
-
-    // Then invoke the intialization procedure.
-    OramStatus status = path_oram_controllers_.back()->InitOram();
+  if (piggyback_evict_ && sub_oram_type_ != OramType::kPathOram) {
+    return OramStatus(StatusCode::kInvalidArgument,
+                      "Only Path ORAM partitions support piggybacked eviction.",
+                      __func__);
+  }
+
+  for (size_t i = 0; i < slots_.SlotNum(); i++) {
+    // We create the sub-ORAM controller for each slot.
+    std::unique_ptr<OramController> controller;
+    OramStatus status = CreateSubOram(i, &controller);
     if (!status.ok()) {
       return status;
     }
+    sub_oram_controllers_.emplace_back(std::move(controller));
+    if (server_stubs_.empty()) {
+      sub_oram_controllers_.back()->SetStub(stub_);
+      sub_oram_controllers_.back()->SetAsyncStub(async_stub_);
+    } else {
+      const size_t server = i % server_stubs_.size();
+      sub_oram_controllers_.back()->SetStub(server_stubs_[server]);
+      sub_oram_controllers_.back()->SetAsyncStub(server_async_stubs_[server]);
+    }
+    partition_locks_.emplace_back(std::make_unique<std::mutex>());
+  }
+  evict_pool_ = std::make_unique<ThreadPool>(evict_thread_num_);
+
+  // Then invoke the intialization procedure of the sub-ORAMs concurrently.
+  ThreadPool pool(init_thread_num_);
+  std::vector<std::future<OramStatus>> futures;
+  for (auto& controller : sub_oram_controllers_) {
+    OramController* const sub_oram_controller = controller.get();
+    futures.emplace_back(
+        pool.Submit([=]() { return sub_oram_controller->InitOram(); }));
   }
 
-  return OramStatus::OK;
+  return ThreadPool::WaitAll(futures);
 }
 
 OramStatus PartitionOramController::ProcessSlot(
@@ -224,31 +563,41 @@ OramStatus PartitionOramController::ProcessSlot(
 
 OramStatus PartitionOramController::FillWithData(
     const std::vector<oram_block_t>& data) {
-  const size_t level = path_oram_controllers_.front()->GetTreeLevel();
-  const size_t tree_size = (POW2(level + 1) - 1) * bucket_size_;
+  const size_t tree_size = GetPartitionDataSize();
   // Check if the data size is consistent with the block number (note that this
   // includes dummy blocks).
-  if (data.size() != tree_size * path_oram_controllers_.size()) {
+  if (data.size() != tree_size * sub_oram_controllers_.size()) {
     return OramStatus(StatusCode::kInvalidArgument, "Data size is wrong",
                       __func__);
   }
 
-  // Send the data vector to each PathORAM controller.
+  // Send the data vector to each PathORAM controller. The position map is
+  // shared, so it is filled here; the sub-ORAMs are filled concurrently.
   auto begin = std::chrono::high_resolution_clock::now();
-  for (size_t i = 0; i < path_oram_controllers_.size(); i++) {
-    // Slice the data vector.
-    const std::vector<oram_block_t> cur_data(
-        data.begin() + i * tree_size, data.begin() + (i + 1) * tree_size);
-    OramStatus status = ProcessSlot(cur_data, i);
+  ThreadPool pool(init_thread_num_);
+  INFO(logger, "[+] Filling {} partitions with {} threads.",
+       sub_oram_controllers_.size(), pool.Size());
+  std::vector<std::future<OramStatus>> futures;
+  for (size_t i = 0; i < sub_oram_controllers_.size(); i++) {
+    const auto cur_begin = data.begin() + i * tree_size;
+    const auto cur_end = cur_begin + tree_size;
+    OramStatus status =
+        ProcessSlot(std::vector<oram_block_t>(cur_begin, cur_end), i);
     oram_utils::CheckStatus(status, "Failed to process slot!");
 
     // Initialize the Path Oram.
-    status = path_oram_controllers_[i]->FillWithData(cur_data);
-    oram_utils::CheckStatus(status,
-                            "Failed to fill the data into the Path ORAM.");
+    OramController* const controller = sub_oram_controllers_[i].get();
+    futures.emplace_back(pool.Submit([=]() {
+      // Slice the data vector.
+      return controller->FillWithData(
+          std::vector<oram_block_t>(cur_begin, cur_end));
+    }));
   }
+  oram_utils::CheckStatus(ThreadPool::WaitAll(futures),
+                          "Failed to fill the data into the Path ORAM.");
   auto end = std::chrono::high_resolution_clock::now();
 
+  // test.sh parses this line.
   INFO(logger,
        "[+] The Partition Oram Controller is initialized. Elapsed time is {} "
        "us.",
@@ -262,16 +611,15 @@ OramStatus PartitionOramController::FillWithData(
 }
 
 OramStatus PartitionOramController::TestPathOram(uint32_t controller_id) {
-  if (controller_id >= path_oram_controllers_.size()) {
+  if (controller_id >= sub_oram_controllers_.size()) {
     return OramStatus(StatusCode::kOutOfRange,
                       "The controller id is out of range.", __func__);
   }
 
-  PathOramController* const controller =
-      path_oram_controllers_[controller_id].get();
+  OramController* const controller =
+      sub_oram_controllers_[controller_id].get();
 
-  const size_t level = controller->GetTreeLevel();
-  const size_t tree_size = (POW2(level + 1) - 1) * bucket_size_;
+  const size_t tree_size = controller->GetDataSize();
   const p_oram_bucket_t raw_data = std::move(
       oram_utils::SampleRandomBucket(partition_size_, tree_size, 0ul));
 
@@ -318,11 +666,10 @@ OramStatus PartitionOramController::TestPathOram(uint32_t controller_id) {
 
 OramStatus PartitionOramController::TestPartitionOram(void) {
   std::vector<oram_block_t> blocks;
-  const size_t level = path_oram_controllers_.front()->GetTreeLevel();
-  const size_t tree_size = (POW2(level + 1) - 1) * bucket_size_;
+  const size_t tree_size = GetPartitionDataSize();
 
   // Sample random data.
-  for (size_t i = 0; i < path_oram_controllers_.size(); i++) {
+  for (size_t i = 0; i < sub_oram_controllers_.size(); i++) {
     const std::vector<oram_block_t> block =
         std::move(oram_utils::SampleRandomBucket(partition_size_, tree_size,
                                                  i * partition_size_ / 2));
@@ -352,6 +699,7 @@ OramStatus PartitionOramController::TestPartitionOram(void) {
     PANIC_IF((block.data[0] != i), "Failed to read the correct block.");
     DBG(logger, "[+] Read block {}: {}", block.header.block_id, block.data[0]);
   }
+  oram_utils::CheckStatus(WaitForEvictions(), "Failed to perform eviction!");
   auto end = std::chrono::high_resolution_clock::now();
 
   // Report the storage.
@@ -376,17 +724,107 @@ OramStatus PartitionOramController::TestPartitionOram(void) {
   return OramStatus::OK;
 }
 
+OramStatus PartitionOramController::BenchmarkEviction(size_t access_num) {
+  if (access_num == 0) {
+    return OramStatus(StatusCode::kInvalidArgument,
+                      "The number of accesses cannot be zero.", __func__);
+  }
+
+  const EvictType evict_type = evict_type_;
+  for (const EvictType cur_type :
+       {EvictType::kEvictSeq, EvictType::kEvictRand}) {
+    const std::string name =
+        cur_type == EvictType::kEvictSeq ? "Sequential" : "Random";
+    evict_type_ = cur_type;
+
+    // Each policy starts with empty slots.
+    OramStatus status = FlushSlots();
+    if (!status.ok()) {
+      return status;
+    }
+
+    INFO(logger, "[+] Begin benchmarking {} eviction with nu = {}...", name,
+         nu_);
+    const size_t begin_communication = ReportNetworkCommunication();
+    size_t max_occupancy = 0;
+    double total_occupancy = 0;
+    auto begin = std::chrono::high_resolution_clock::now();
+    for (size_t i = 0; i < access_num; i++) {
+      uint32_t address;
+      oram_utils::CheckStatus(
+          oram_crypto::UniformRandom(0, block_num_ - 1, &address),
+          "Failed to sample an address.");
+
+      oram_block_t block;
+      if (!(status = Access(Operation::kRead, address, &block)).ok()) {
+        return status;
+      }
+
+      const size_t occupancy = slots_.TotalOccupancy();
+      max_occupancy = std::max(max_occupancy, occupancy);
+      total_occupancy += occupancy;
+    }
+    if (!(status = WaitForEvictions()).ok()) {
+      return status;
+    }
+    auto end = std::chrono::high_resolution_clock::now();
+
+    const double communication =
+        ReportNetworkCommunication() - begin_communication;
+    INFO(logger,
+         "[-] {} eviction: the slots hold {} blocks at most and {} blocks on "
+         "average.",
+         name, max_occupancy, total_occupancy / access_num);
+    std::string histogram;
+    const std::vector<size_t> slot_histogram = ReportSlotHistogram();
+    for (size_t k = 0; k < slot_histogram.size(); k++) {
+      histogram += oram_utils::StrCat(k == 0 ? "" : ", ", k, ": ",
+                                      slot_histogram[k]);
+    }
+    INFO(logger,
+         "[-] {} eviction: the rate is {} at the end, and the number of slots "
+         "by their blocks is {{{}}}.",
+         name, nu_, histogram);
+    INFO(logger,
+         "[-] {} eviction: the communication is {} KB per access. Time "
+         "elapsed per access: {} us.",
+         name, communication / 1024 / access_num,
+         (std::chrono::duration_cast<std::chrono::microseconds>(end - begin) /
+          access_num)
+             .count());
+  }
+  evict_type_ = evict_type;
+
+  return OramStatus::OK;
+}
+
+std::vector<size_t> PartitionOramController::ReportSlotHistogram(
+    void) const {
+  std::vector<size_t> histogram;
+  for (size_t i = 0; i < partition_locks_.size(); i++) {
+    std::unique_lock<std::mutex> lock(*partition_locks_[i]);
+    const size_t occupancy = slots_.Occupancy(i);
+    if (histogram.size() <= occupancy) {
+      histogram.resize(occupancy + 1, 0);
+    }
+    histogram[occupancy]++;
+  }
+
+  return histogram;
+}
+
 size_t PartitionOramController::ReportClientStorage(void) const {
   size_t client_storage = 0;
 
   std::for_each(
-      path_oram_controllers_.begin(), path_oram_controllers_.end(),
+      sub_oram_controllers_.begin(), sub_oram_controllers_.end(),
       [&client_storage](
-          const std::unique_ptr<PathOramController>& path_oram_controller) {
-        client_storage += path_oram_controller->ReportClientStorage();
+          const std::unique_ptr<OramController>& sub_oram_controller) {
+        client_storage += sub_oram_controller->ReportClientStorage();
       });
 
-  client_storage += slots_.size() * ORAM_BLOCK_SIZE;
+  client_storage += slots_.TotalOccupancy() * ORAM_BLOCK_SIZE;
+  client_storage += position_map_.ReportStorage();
   return client_storage;
 }
 
@@ -394,7 +832,7 @@ std::chrono::microseconds PartitionOramController::ReportNetworkingTime(
     void) const {
   std::chrono::microseconds ans = 0us;
 
-  for (const auto& controller : path_oram_controllers_) {
+  for (const auto& controller : sub_oram_controllers_) {
     ans += controller->ReportNetworkingTime();
   }
 
@@ -404,7 +842,7 @@ std::chrono::microseconds PartitionOramController::ReportNetworkingTime(
 size_t PartitionOramController::ReportNetworkCommunication(void) const {
   size_t ans = 0;
 
-  for (const auto& controller : path_oram_controllers_) {
+  for (const auto& controller : sub_oram_controllers_) {
     ans += controller->ReportNetworkCommunication();
   }
 
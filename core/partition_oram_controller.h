@@ -17,8 +17,13 @@
 #ifndef ORAM_IMPL_CORE_PARTITION_ORAM_CONTROLLER_H_
 #define ORAM_IMPL_CORE_PARTITION_ORAM_CONTROLLER_H_
 
+#include <condition_variable>
+#include <mutex>
+
 #include "oram_controller.h"
-#include "path_oram_controller.h"
+
+#include "base/oram_slot_cache.h"
+#include "base/oram_thread_pool.h"
 
 namespace oram_impl {
 // This class is the implementation of the ORAM controller for Partition ORAM.
@@ -26,6 +31,42 @@ class PartitionOramController final : public OramController {
   size_t partition_size_;
   size_t bucket_size_;
   size_t nu_;
+  EvictType evict_type_;
+  // If `adaptive_evict_` is set, \nu moves within [nu_min_, nu_max_] by at
+  // most one right after every `adapt_period_`-th access, which is a public
+  // schedule, and stays fixed in between. The step only depends on which of
+  // three bands the peak occupancy of the slots fell into during the period:
+  // up if they grew too full, down if they stayed nearly empty, and unchanged
+  // otherwise. The slots fill up more slowly when the same blocks are
+  // accessed again, so the server, which counts the evictions, learns at most
+  // log2(3) bits about the temporal locality of each period and nothing else.
+  bool adaptive_evict_;
+  size_t nu_min_;
+  size_t nu_max_;
+  size_t adapt_period_;
+  // The accesses so far in the current period, and the largest total and
+  // per-slot occupancy seen after any of them.
+  size_t period_access_num_;
+  size_t period_max_occupancy_;
+  size_t period_max_slot_occupancy_;
+  // [k] -> the number of periods in which the fullest slot held k blocks.
+  std::vector<size_t> peak_histogram_;
+  // The ORAM behind each partition: Path ORAM or Ring ORAM.
+  OramType sub_oram_type_;
+  // The number of threads that initialize the sub-ORAMs; 0 means one per
+  // hardware thread.
+  size_t init_thread_num_;
+  // The number of threads that evict from the slots; 0 means one per hardware
+  // thread.
+  size_t evict_thread_num_;
+  // The number of blocks that each eviction moves from a slot into its
+  // sub-ORAM, all with the same single sub-ORAM access.
+  size_t evict_block_num_;
+  // If `piggyback_evict_` is set, the access to a partition also evicts from
+  // its slot, as its sub-ORAM writes a path back anyway, and one of the \nu
+  // separate evictions is dropped. Both happen on every access whether the
+  // slot is empty or not, so the server sees the same accesses as before.
+  bool piggyback_evict_;
   static size_t counter_;
   // Position map: [key] -> [slot_id].
   p_oram_position_t position_map_;
@@ -33,15 +74,100 @@ class PartitionOramController final : public OramController {
   pp_oram_slot_t slots_;
   // Controllers for each slot: [slot_id] -> [controller_1, controller_2, ...,
   //                                          controller_n].
-  std::vector<std::unique_ptr<PathOramController>> path_oram_controllers_;
+  std::vector<std::unique_ptr<OramController>> sub_oram_controllers_;
+  // The partitions share no state, so the evictions run on a pool; the lock of
+  // a partition guards its slot and its sub-ORAM, which serializes two
+  // evictions of the same slot.
+  std::unique_ptr<ThreadPool> evict_pool_;
+  // The servers that the partitions are placed on: partition i is always on
+  // server i mod n. If none is given, all of them are on the server of
+  // `stub_`.
+  std::vector<std::shared_ptr<oram_server::Stub>> server_stubs_;
+  std::vector<std::shared_ptr<AsyncOramStub>> server_async_stubs_;
+  std::vector<std::unique_ptr<std::mutex>> partition_locks_;
+  // If `background_evict_` is set, Access() returns as soon as the block is in
+  // hand and leaves the evictions to the pool. At most `evict_backlog_`
+  // evictions may be queued; beyond that, Access() waits for the backlog to
+  // drain, which bounds the number of blocks in the slots. The first failure
+  // of a background eviction is kept in `evict_status_` until it is reported.
+  bool background_evict_;
+  size_t evict_backlog_;
+  size_t evict_pending_;
+  OramStatus evict_status_;
+  std::mutex evict_lock_;
+  std::condition_variable evict_cond_;
 
   PartitionOramController(uint32_t id = 0ul)
-      : OramController(id, true, 0ul, OramType::kPartitionOram) {}
+      : OramController(id, true, 0ul, OramType::kPartitionOram),
+        nu_(kDefaultNu),
+        evict_type_(EvictType::kEvictRand),
+        adaptive_evict_(false),
+        nu_min_(kDefaultNuMin),
+        nu_max_(kDefaultNuMax),
+        adapt_period_(kDefaultAdaptPeriod),
+        period_access_num_(0ul),
+        period_max_occupancy_(0ul),
+        period_max_slot_occupancy_(0ul),
+        sub_oram_type_(OramType::kPathOram),
+        init_thread_num_(0ul),
+        evict_thread_num_(0ul),
+        evict_block_num_(1ul),
+        piggyback_evict_(false),
+        background_evict_(false),
+        evict_backlog_(kDefaultEvictBacklog),
+        evict_pending_(0ul),
+        evict_status_(OramStatus::OK) {}
+
+  // A sub-ORAM access of AccessBatch(): a distinct address of the batch, or a
+  // dummy read that pads the batch.
+  struct BatchEntry {
+    uint32_t slot_id;
+    uint32_t address;
+    bool dummy;
+    oram_block_t block;
+  };
 
   // ==================== Begin private methods ==================== //
+  // Creates the controller of a partition, which must not be standalone.
+  OramStatus CreateSubOram(uint32_t id,
+                           std::unique_ptr<OramController>* const controller);
+  // Fetches the blocks of the batch that are in the same partition.
+  OramStatus FetchBatch(uint32_t slot_id,
+                        const std::vector<BatchEntry*>& group);
+  // Moves up to `evict_block_num_` blocks out of the slot. The lock of the
+  // partition must be held.
+  std::vector<oram_block_t> DrainSlot(uint32_t id);
+  // Hands blocks of the slot to the sub-ORAM so that its next access writes
+  // them back. The lock of the partition must be held.
+  OramStatus Piggyback(uint32_t id);
   OramStatus Evict(uint32_t id);
+  std::future<OramStatus> SubmitEvict(uint32_t id);
+  // Evicts from the slots concurrently and waits for all of them.
+  OramStatus EvictSlots(const std::vector<uint32_t>& ids);
+  // Waits for the evictions, or only collects the failures of earlier ones if
+  // they run in the background.
+  OramStatus FinishEvictions(std::vector<std::future<OramStatus>>& futures);
+  // Returns the kept failure, if any, and clears it. `evict_lock_` must be
+  // held.
+  OramStatus TakeEvictStatus(void);
+  std::vector<uint32_t> SequentialEvictSlots(void);
+  std::vector<uint32_t> RandomEvictSlots(void);
   OramStatus SequentialEvict(void);
   OramStatus RandomEvict(void);
+  // The rate of the evictions that are not piggybacked.
+  size_t SeparateEvictRate(void) const {
+    return piggyback_evict_ && nu_ > 0 ? nu_ - 1 : nu_;
+  }
+  // The slots to evict from after an access under the current policy.
+  std::vector<uint32_t> SampleEvictSlots(void);
+  // Records the occupancy of the slots once the fullest slot touched by the
+  // latest accesses holds `slot_occupancy` blocks.
+  void RecordOccupancy(size_t slot_occupancy);
+  // Counts an access whose evictions have been sampled, and adapts \nu if it
+  // ends the period.
+  void AdaptEvictRate(void);
+  // Evicts every block in the slots back to its sub-ORAM.
+  OramStatus FlushSlots(void);
 
   OramStatus ProcessSlot(const std::vector<oram_block_t>& data,
                          uint32_t slot_id);
@@ -58,31 +184,116 @@ class PartitionOramController final : public OramController {
 
   void SetBucketSize(size_t bucket_size) { bucket_size_ = bucket_size; }
   void SetNu(size_t nu) { nu_ = nu; }
+  void SetEvictType(EvictType evict_type) { evict_type_ = evict_type; }
+  void SetAdaptiveEvict(bool adaptive_evict, size_t nu_min, size_t nu_max,
+                        size_t adapt_period) {
+    adaptive_evict_ = adaptive_evict;
+    nu_min_ = nu_min;
+    nu_max_ = nu_max;
+    adapt_period_ = std::max(adapt_period, (size_t)1);
+    if (adaptive_evict_) {
+      nu_ = std::min(std::max(nu_, nu_min_), nu_max_);
+    }
+  }
+  void SetSubOramType(OramType sub_oram_type) {
+    sub_oram_type_ = sub_oram_type;
+  }
+  // The i-th stubs of both lists talk to the same server.
+  void SetServers(
+      const std::vector<std::shared_ptr<oram_server::Stub>>& stubs,
+      const std::vector<std::shared_ptr<AsyncOramStub>>& async_stubs) {
+    server_stubs_ = stubs;
+    server_async_stubs_ = async_stubs;
+  }
+  void SetInitThreadNum(size_t init_thread_num) {
+    init_thread_num_ = init_thread_num;
+  }
+  void SetEvictThreadNum(size_t evict_thread_num) {
+    evict_thread_num_ = evict_thread_num;
+  }
+  void SetEvictBlockNum(size_t evict_block_num) {
+    evict_block_num_ = std::max(evict_block_num, (size_t)1);
+  }
+  void SetPiggybackEvict(bool piggyback_evict) {
+    piggyback_evict_ = piggyback_evict;
+  }
+  void SetBackgroundEvict(bool background_evict, size_t evict_backlog) {
+    background_evict_ = background_evict;
+    evict_backlog_ = std::max(evict_backlog, (size_t)1);
+  }
+  // Waits until no eviction is queued and reports the first failure not yet
+  // reported, if any.
+  OramStatus WaitForEvictions(void);
 
   virtual OramStatus Access(Operation op_type, uint32_t address,
                             oram_block_t* const data) override;
 
+  // One request of a batch.
+  struct BatchOp {
+    Operation op_type;
+    uint32_t address;
+    oram_block_t* data;
+  };
+
+  // Serves a batch of requests with the same semantics as calling Access() on
+  // each of them in order, but fetches each distinct address once and serves
+  // the partitions concurrently. The batch is padded with dummy reads so that
+  // the server only learns the number of requests.
+  OramStatus AccessBatch(std::vector<BatchOp>& ops);
+
   virtual OramStatus FillWithData(
       const std::vector<oram_block_t>& data) override;
   virtual OramStatus InitOram(void) override;
 
+  // Determines the number and the size of the partitions; InitOram() then
+  // creates the sub-ORAMs.
+  void Setup(uint32_t block_num, uint32_t bucket_size);
   OramStatus Run(uint32_t block_num, uint32_t bucket_size);
-  // A reserved interface for testing one of the PathORAM controllers.
+  // A reserved interface for testing one of the sub-ORAM controllers.
   OramStatus TestPathOram(uint32_t controller_id);
   OramStatus TestPartitionOram(void);
+  // Runs `access_num` random reads under each eviction policy and reports the
+  // occupancy of the slots and the communication per access.
+  OramStatus BenchmarkEviction(size_t access_num);
 
-  size_t ReportClientStorage(void) const;
-  size_t ReportNetworkCommunication(void) const;
-  std::chrono::microseconds ReportNetworkingTime(void) const;
+  size_t GetPartitionNum(void) const { return sub_oram_controllers_.size(); }
+  size_t GetPartitionSize(void) const { return partition_size_; }
+  // The number of blocks, dummies included, of each partition.
+  size_t GetPartitionDataSize(void) const {
+    return sub_oram_controllers_.front()->GetDataSize();
+  }
+  virtual size_t GetDataSize(void) const override {
+    return GetPartitionDataSize() * GetPartitionNum();
+  }
+
+  virtual size_t ReportClientStorage(void) const override;
+  virtual size_t ReportNetworkCommunication(void) const override;
+  virtual std::chrono::microseconds ReportNetworkingTime(
+      void) const override;
+  // The current eviction rate \nu.
+  size_t ReportEvictRate(void) const { return nu_; }
+  // [k] -> the number of slots holding k blocks now.
+  std::vector<size_t> ReportSlotHistogram(void) const;
+  // [k] -> the number of periods of `adapt_period_` accesses in which the
+  // fullest slot held k blocks.
+  std::vector<size_t> ReportPeakHistogram(void) const {
+    return peak_histogram_;
+  }
 
   void Reset(uint32_t block_num) {
+    WaitForEvictions();
     block_num_ = block_num;
     position_map_.clear();
-    slots_.clear();
-    path_oram_controllers_.clear();
+    slots_.Clear();
+    sub_oram_controllers_.clear();
+    partition_locks_.clear();
+    period_access_num_ = period_max_occupancy_ = 0;
+    period_max_slot_occupancy_ = 0;
+    peak_histogram_.clear();
   }
 
-  virtual ~PartitionOramController() {}
+  // The queued evictions still refer to the slots and the sub-ORAMs.
+  virtual ~PartitionOramController() { evict_pool_.reset(); }
 };
 }  // namespace oram_impl
 
@@ -43,34 +43,90 @@ uint32_t PathOramController::RandomPosition(void) {
 }
 
 PathOramController::PathOramController(uint32_t id, uint32_t block_num,
-                                       uint32_t bucket_size, bool standalone)
-    : OramController(id, standalone, block_num, OramType::kPathOram),
+                                       uint32_t bucket_size, bool standalone,
+                                       uint32_t recursion_level,
+                                       size_t plb_size, uint32_t treetop_level)
+    : PathOramController(id, block_num, bucket_size, standalone,
+                         recursion_level, plb_size, treetop_level,
+                         OramType::kPathOram) {}
+
+PathOramController::PathOramController(uint32_t id, uint32_t block_num,
+                                       uint32_t bucket_size, bool standalone,
+                                       uint32_t recursion_level,
+                                       size_t plb_size, uint32_t treetop_level,
+                                       OramType oram_type)
+    : OramController(id, standalone, block_num, oram_type),
       bucket_size_(bucket_size),
       stash_size_(0ul),
+      recursion_level_(0),
+      plb_size_(std::max(plb_size, 1ul)),
+      treetop_communication_(0ul),
       network_time_(0us),
       network_communication_(0ul) {
-  const size_t bucket_num = std::ceil(block_num * 1.0 / bucket_size);
+  // A standalone Path ORAM owns the contiguous addresses [0, block_num), so
+  // the position map can be packed or stored recursively; sub-ORAMs of the
+  // Partition ORAM only hold a scattered subset of the addresses and stay
+  // sparse. There is no point in recursing once the map fits in one block.
+  level_base_ = {0, block_num};
+  if (standalone) {
+    PANIC_IF(recursion_level > kMaximumRecursionLevel,
+             "The recursion level is too large.");
+
+    for (uint32_t count = block_num;
+         recursion_level_ < recursion_level && count > kPositionsPerBlock;
+         recursion_level_++) {
+      count = std::ceil(count * 1.0 / kPositionsPerBlock);
+      level_base_.emplace_back(level_base_.back() + count);
+    }
+  }
+
+  // The tree holds the position blocks as well.
+  const size_t bucket_num = std::ceil(level_base_.back() * 1.0 / bucket_size);
   // Note that the level starts from 0.
   tree_level_ = std::ceil(LOG_BASE(bucket_num + 1, 2)) - 1;
   number_of_leafs_ = POW2(tree_level_);
 
+  // Caching more levels than the tree has means the whole tree is local.
+  treetop_level_ = std::min(treetop_level, tree_level_ + 1);
+  treetop_.resize(POW2(treetop_level_) - 1);
+
+  if (standalone) {
+    position_map_ = p_oram_position_t(
+        level_base_[recursion_level_ + 1] - level_base_[recursion_level_],
+        number_of_leafs_ - 1);
+  }
+
   DBG(logger,
       "PathORAM Config:\n"
-      "id: {}, number_of_leafs: {}, bucket_size: {}, tree_height: {}\n",
-      id_, number_of_leafs_, bucket_size_, tree_level_);
+      "id: {}, number_of_leafs: {}, bucket_size: {}, tree_height: {}, "
+      "treetop_level: {}\n",
+      id_, number_of_leafs_, bucket_size_, tree_level_, treetop_level_);
 }
 
 size_t PathOramController::ReportClientStorage(void) const {
-  // For the client storage of the Path ORAM, we need to report the number of
-  // blocks in the client storage. We exclude the storage of position map for
-  // a more straightforward comparison.
-  return stash_.size() * ORAM_BLOCK_SIZE;
+  // For the client storage of the Path ORAM, we report the blocks in the stash
+  // together with the position map. If the position map is recursive, only the
+  // top level of it and the PLB are kept locally. The treetop cache is counted
+  // in full since its buckets are always resident.
+  return (stash_.size() + plb_.size()) * ORAM_BLOCK_SIZE +
+         position_map_.ReportStorage() + ReportTreetopStorage();
+}
+
+size_t PathOramController::ReportTreetopStorage(void) const {
+  return treetop_.size() * bucket_size_ * ORAM_BLOCK_SIZE;
 }
 
 size_t PathOramController::ReportNetworkCommunication(void) const {
+  // Blocks served by the treetop cache never reach the network; see
+  // ReportTreetopCommunication() for the bandwidth saved.
   return network_communication_ * ORAM_BLOCK_SIZE;
 }
 
+std::chrono::microseconds PathOramController::ReportNetworkingTime(
+    void) const {
+  return network_time_;
+}
+
 OramStatus PathOramController::PrintOramTree(void) {
   grpc::ClientContext context;
   PrintOramTreeRequest request;
@@ -87,8 +143,22 @@ OramStatus PathOramController::PrintOramTree(void) {
   return OramStatus::OK;
 }
 
+p_oram_bucket_t* PathOramController::TreetopBucket(uint32_t path,
+                                                   uint32_t level) {
+  if (level >= treetop_level_) {
+    return nullptr;
+  }
+
+  return &treetop_[POW2(level) - 1 + (path >> (tree_level_ - level))];
+}
+
 OramStatus PathOramController::AccurateWriteBucket(
     uint32_t level, uint32_t offset, const p_oram_bucket_t& bucket) {
+  if (level < treetop_level_) {
+    treetop_[POW2(level) - 1 + offset] = bucket;
+    return OramStatus::OK;
+  }
+
   grpc::ClientContext context;
   WritePathRequest request;
   WritePathResponse response;
@@ -158,53 +228,144 @@ OramStatus OramController::FromFile(const std::string& file_path) {
 // The input vector of blocks should be sorted by their path id.
 OramStatus PathOramController::FillWithData(
     const std::vector<oram_block_t>& data) {
-  // We organize all the data into buckets and then directly write them to the
-  // server by invoking the WritePath method provided by the gRPC framework.
+  // We organize all the data into buckets and then stream them to the server
+  // by invoking the BulkLoad method provided by the gRPC framework.
   // The data are organized level by level, and for best performance, we
   // initialize the ORAM tree from the leaf to the root. In other words, we
   // **GREEDILY** fill the buckets from the leaf to the root.
   oram_utils::PrintStash(data);
 
+  for (const oram_block_t& block : data) {
+    if (recursion_level_ > 0 && block.header.type == BlockType::kNormal &&
+        block.header.block_id >= level_base_[1]) {
+      return OramStatus(StatusCode::kInvalidArgument,
+                        "The block id exceeds the position map", __func__);
+    }
+  }
+
+  // With a recursive position map, the position blocks take the places of the
+  // dummies, which are shuffled in by the client, and the rest go after the
+  // data. [address - level_base_[1]] -> the index of the position block.
+  std::vector<oram_block_t> blocks(data);
+  std::vector<size_t> position_block_index(level_base_.back() -
+                                           level_base_[1]);
   size_t p_data = 0;
-  for (int i = tree_level_; i >= 0; i--) {
-    // We pick bucket_size blocks from the data and organize them into a bucket.
-    // The bucket is then sent to the server.
-    const uint32_t level_size = POW2(i);
-    const uint32_t span = POW2(tree_level_ - i);
+  for (size_t i = 0; i < position_block_index.size(); i++) {
+    while (p_data < blocks.size() &&
+           blocks[p_data].header.type != BlockType::kDummy) {
+      p_data++;
+    }
 
-    for (uint32_t j = 0; j < level_size; j++) {
-      p_oram_bucket_t bucket_this_level;
+    if (p_data == blocks.size()) {
+      blocks.emplace_back();
+    }
 
+    oram_block_t& position_block = blocks[p_data];
+    memset(&position_block, 0, ORAM_BLOCK_SIZE);
+    position_block.header.block_id = level_base_[1] + i;
+    position_block.header.type = BlockType::kNormal;
+    position_block_index[i] = p_data++;
+  }
+
+  // Now sample the leaves in the same order as the buckets are filled below,
+  // so that every position block is complete before it is sent.
+  p_data = 0;
+  for (int level = tree_level_; level >= 0; level--) {
+    const uint32_t level_size = POW2(level);
+    const uint32_t span = POW2(tree_level_ - level);
+
+    for (uint32_t offset = 0; offset < level_size; offset++) {
       // This determined the range of the current bucket in terms of path.
-      const uint32_t begin = j * span;
+      const uint32_t begin = offset * span;
       const uint32_t end = begin + span - 1;
 
-      // Organize into a bucket.
-      for (size_t k = 0; k < bucket_size_; k++) {
-        if (p_data >= data.size()) {
-          break;
+      for (size_t k = 0; k < bucket_size_ && p_data < blocks.size();
+           k++, p_data++) {
+        oram_block_t& block = blocks[p_data];
+        if (block.header.type != BlockType::kNormal) {
+          continue;
         }
 
         // Sample a random path for the block.
-        if (data[p_data].header.type == BlockType::kNormal) {
-          uint32_t path;
-          oram_utils::CheckStatus(oram_crypto::UniformRandom(begin, end, &path),
-                                  "UniformRandom error");
-          bucket_this_level.emplace_back(data[p_data]);
-          // Update the position map.
-          position_map_[data[p_data].header.block_id] = path;
+        uint32_t path;
+        oram_utils::CheckStatus(oram_crypto::UniformRandom(begin, end, &path),
+                                "UniformRandom error");
+        block.header.leaf = path;
+
+        // Update the position map.
+        const uint32_t address = block.header.block_id;
+        const uint32_t block_level = LevelOf(address);
+        if (block_level == recursion_level_) {
+          position_map_[address - level_base_[block_level]] = path;
+        } else {
+          oram_block_t& position_block = blocks[position_block_index
+              [PositionBlockOf(address) - level_base_[1]]];
+          reinterpret_cast<uint32_t*>(position_block.data)
+              [(address - level_base_[block_level]) % kPositionsPerBlock] = path;
         }
-
-        p_data++;
       }
+    }
+  }
+
+  for (; p_data < blocks.size(); p_data++) {
+    if (blocks[p_data].header.type == BlockType::kNormal) {
+      return OramStatus(StatusCode::kInvalidArgument,
+                        "The blocks do not fit into the tree", __func__);
+    }
+  }
+
+  // The buckets are streamed to the server in chunks, each producer call
+  // resuming at (level, offset). Buckets in the treetop cache stay local.
+  p_data = 0;
+  int level = tree_level_;
+  uint32_t offset = 0;
+  OramStatus status = BulkLoad([&](BulkLoadRequest* const chunk,
+                                   bool* const done) {
+    size_t chunk_size = 0;
+    for (; level >= 0; level--, offset = 0) {
+      // We pick bucket_size blocks from the data and organize them into a
+      // bucket.
+      const uint32_t level_size = POW2(level);
+
+      for (; offset < level_size; offset++) {
+        if (chunk_size >= kBulkLoadChunkSize) {
+          return OramStatus::OK;
+        }
+
+        p_oram_bucket_t bucket_this_level;
+
+        // Organize into a bucket.
+        for (size_t k = 0; k < bucket_size_; k++) {
+          if (p_data >= blocks.size()) {
+            break;
+          }
+
+          if (blocks[p_data].header.type == BlockType::kNormal) {
+            bucket_this_level.emplace_back(blocks[p_data]);
+          }
+
+          p_data++;
+        }
 
-      oram_utils::PadStash(&bucket_this_level, bucket_size_);
+        oram_utils::PadStash(&bucket_this_level, bucket_size_);
 
-      // Write the bucket to the server.
-      oram_utils::CheckStatus(
-          AccurateWriteBucket(i, j, bucket_this_level),
-          "Failed to write bucket accurately when intializing the ORAM!");
+        if ((uint32_t)level < treetop_level_) {
+          treetop_[POW2(level) - 1 + offset] = std::move(bucket_this_level);
+        } else {
+          chunk_size +=
+              AppendToChunk(level, offset, bucket_this_level, chunk);
+        }
+      }
     }
+
+    *done = true;
+    return OramStatus::OK;
+  });
+
+  if (!status.ok()) {
+    return status.Append(OramStatus(
+        StatusCode::kInvalidOperation,
+        "Failed to load the buckets when intializing the ORAM!", __func__));
   }
 
   // Set initialized.
@@ -220,6 +381,15 @@ OramStatus PathOramController::ReadBucket(uint32_t path, uint32_t level,
                       "The path or the level given is not correct", __func__);
   }
 
+  // The server clears a bucket once it is read, and so does the cache.
+  p_oram_bucket_t* const cached = TreetopBucket(path, level);
+  if (cached != nullptr) {
+    treetop_communication_ += cached->size();
+    bucket->insert(bucket->end(), cached->begin(), cached->end());
+    cached->clear();
+    return OramStatus::OK;
+  }
+
   grpc::ClientContext context;
 
   // Then prepare for RPC call.
@@ -263,6 +433,13 @@ OramStatus PathOramController::WriteBucket(uint32_t path, uint32_t level,
                                            const p_oram_bucket_t& bucket) {
   DBG(logger, "[+] Writing bucket at path {}, level {}", path, level);
 
+  p_oram_bucket_t* const cached = TreetopBucket(path, level);
+  if (cached != nullptr) {
+    treetop_communication_ += bucket.size();
+    *cached = bucket;
+    return OramStatus::OK;
+  }
+
   grpc::ClientContext context;
   WritePathRequest request;
   WritePathResponse response;
@@ -299,28 +476,329 @@ OramStatus PathOramController::WriteBucket(uint32_t path, uint32_t level,
   return OramStatus::OK;
 }
 
-p_oram_stash_t PathOramController::FindSubsetOf(uint32_t current_path) {
-  p_oram_stash_t subset;
+OramStatus PathOramController::ReadFullPath(uint32_t path,
+                                            p_oram_path_t* const out_path) {
+  OramStatus status = SendReadFullPath(path);
+  return status.ok() ? ReceiveReadFullPath(out_path) : status;
+}
 
-  auto iter = stash_.begin();
-  while (iter != stash_.end()) {
-    const uint32_t block_path = position_map_[iter->header.block_id];
+OramStatus PathOramController::WriteFullPath(uint32_t path,
+                                             const p_oram_path_t& in_path) {
+  OramStatus status = SendWriteFullPath(path, in_path);
+  return status.ok() ? ReceiveWriteFullPath() : status;
+}
 
-    if (subset.size() < bucket_size_) {
-      if (block_path == current_path) {
-        subset.emplace_back(*iter);
-        // Delete the current block and re-adjust the iterator.
-        iter = stash_.erase(iter);
-      } else {
-        iter++;
-      }
-    } else {
+OramStatus PathOramController::SendReadFullPath(uint32_t path) {
+  if (path >= number_of_leafs_) {
+    return OramStatus(StatusCode::kInvalidArgument,
+                      "The path given is not correct", __func__);
+  }
+
+  // The server must have applied the last write-back before the next read.
+  if (pending_write_.valid()) {
+    OramStatus status = ReceiveWriteFullPath();
+    if (!status.ok()) {
+      return status;
+    }
+  }
+
+  // The cached levels are taken locally; the server only sends the rest.
+  pending_path_.clear();
+  for (uint32_t i = 0; i < treetop_level_; i++) {
+    p_oram_bucket_t* const cached = TreetopBucket(path, i);
+    treetop_communication_ += cached->size();
+    pending_path_.emplace_back(std::move(*cached));
+    cached->clear();
+  }
+
+  if (treetop_level_ > tree_level_) {
+    return OramStatus::OK;
+  }
+
+  ReadFullPathRequest request;
+  ASSEMBLE_HEADER(request, id_, instance_hash_, GetVersion());
+  request.set_path(path);
+  request.set_start_level(treetop_level_);
+
+  read_response_.Clear();
+  read_begin_ = std::chrono::high_resolution_clock::now();
+  if (async_stub_ != nullptr) {
+    pending_read_ = async_stub_->ReadFullPath(request, &read_response_);
+  } else {
+    grpc::ClientContext context;
+    std::promise<grpc::Status> promise;
+    promise.set_value(stub_->ReadFullPath(&context, request, &read_response_));
+    pending_read_ = promise.get_future();
+  }
+
+  return OramStatus::OK;
+}
+
+OramStatus PathOramController::ReceiveReadFullPath(
+    p_oram_path_t* const out_path) {
+  *out_path = std::move(pending_path_);
+  pending_path_.clear();
+  if (!pending_read_.valid()) {
+    return OramStatus::OK;
+  }
+
+  grpc::Status status = pending_read_.get();
+  auto end = std::chrono::high_resolution_clock::now();
+
+  network_time_ +=
+      std::chrono::duration_cast<std::chrono::microseconds>(end - read_begin_);
+
+  if (!status.ok()) {
+    return OramStatus(StatusCode::kServerError, status.error_message(),
+                      __func__);
+  }
+
+  // Then copy the buckets to the path level by level.
+  for (const auto& message : read_response_.buckets()) {
+    p_oram_bucket_t bucket;
+
+    for (const auto& block_str : message.bucket()) {
+      oram_block_t block;
+      oram_utils::ConvertToBlock(block_str, &block);
+
+      // Decrypt the block.
+      oram_utils::DecryptBlock(&block, cryptor_.get());
+
+      bucket.emplace_back(block);
+    }
+
+    network_communication_ += bucket.size();
+    out_path->emplace_back(std::move(bucket));
+  }
+
+  return OramStatus::OK;
+}
+
+OramStatus PathOramController::SendWriteFullPath(uint32_t path,
+                                                 const p_oram_path_t& in_path) {
+  DBG(logger, "[+] Writing full path {}", path);
+
+  if (in_path.size() != tree_level_ + 1) {
+    return OramStatus(StatusCode::kInvalidArgument,
+                      "The path given does not match the tree", __func__);
+  }
+
+  for (uint32_t i = 0; i < treetop_level_; i++) {
+    treetop_communication_ += in_path[i].size();
+    *TreetopBucket(path, i) = in_path[i];
+  }
+
+  if (treetop_level_ > tree_level_) {
+    return OramStatus::OK;
+  }
+
+  WriteFullPathRequest request;
+  ASSEMBLE_HEADER(request, id_, instance_hash_, GetVersion());
+  request.set_path(path);
+  request.set_start_level(treetop_level_);
+
+  // Copy the buckets into the buffer of WriteFullPathRequest.
+  for (size_t i = treetop_level_; i < in_path.size(); i++) {
+    const p_oram_bucket_t& bucket = in_path[i];
+    BucketMessage* const message = request.add_buckets();
+
+    for (auto block : bucket) {
+      // Encrypt the block.
+      oram_utils::EncryptBlock(&block, cryptor_.get());
+
+      std::string block_str;
+      oram_utils::ConvertToString(&block, &block_str);
+      message->add_bucket(block_str);
+    }
+
+    network_communication_ += bucket.size();
+  }
+
+  write_begin_ = std::chrono::high_resolution_clock::now();
+  if (async_stub_ != nullptr) {
+    pending_write_ = async_stub_->WriteFullPath(request, &write_response_);
+  } else {
+    grpc::ClientContext context;
+    std::promise<grpc::Status> promise;
+    promise.set_value(
+        stub_->WriteFullPath(&context, request, &write_response_));
+    pending_write_ = promise.get_future();
+  }
+
+  return OramStatus::OK;
+}
+
+OramStatus PathOramController::ReceiveWriteFullPath(void) {
+  if (!pending_write_.valid()) {
+    return OramStatus::OK;
+  }
+
+  grpc::Status status = pending_write_.get();
+  auto end = std::chrono::high_resolution_clock::now();
+
+  network_time_ +=
+      std::chrono::duration_cast<std::chrono::microseconds>(end - write_begin_);
+
+  if (!status.ok()) {
+    return OramStatus(StatusCode::kServerError, status.error_message(),
+                      __func__);
+  }
+
+  return OramStatus::OK;
+}
+
+p_oram_path_t PathOramController::FindSubsetOf(uint32_t current_path) {
+  // One pass over the leaves in the stash: a block can be placed at any level
+  // on P(x) that is not deeper than the deepest level where its own path meets
+  // P(x).
+  std::vector<std::vector<uint32_t>> candidates(tree_level_ + 1);
+  stash_.ForEachLeaf([&](uint32_t leaf, const std::vector<uint32_t>& ids) {
+    std::vector<uint32_t>& level_candidates =
+        candidates[oram_utils::DeepestCommonLevel(leaf, current_path,
+                                                  tree_level_)];
+    level_candidates.insert(level_candidates.end(), ids.begin(), ids.end());
+  });
+
+  // Then fill the buckets from the leaf to the root. Blocks that do not fit
+  // into their deepest legal bucket are carried over to the levels above.
+  p_oram_path_t path(tree_level_ + 1);
+  std::vector<uint32_t> pending;
+  for (size_t i = tree_level_ + 1; i >= 1; i--) {
+    const size_t level = i - 1;
+    pending.insert(pending.end(), candidates[level].begin(),
+                   candidates[level].end());
+
+    while (path[level].size() < bucket_size_ && !pending.empty()) {
+      // Expire the block in S that is written to the path.
+      path[level].emplace_back(*stash_.Find(pending.back()));
+      stash_.Remove(pending.back());
+      pending.pop_back();
+    }
+
+    oram_utils::PadStash(&path[level], bucket_size_);
+  }
+
+  return path;
+}
+
+uint32_t PathOramController::LevelOf(uint32_t address) const {
+  uint32_t level = recursion_level_;
+  while (level > 0 && address < level_base_[level]) {
+    level--;
+  }
+  return level;
+}
+
+uint32_t PathOramController::PositionBlockOf(uint32_t address) const {
+  const uint32_t level = LevelOf(address);
+  return level_base_[level + 1] +
+         (address - level_base_[level]) / kPositionsPerBlock;
+}
+
+OramStatus PathOramController::PositionEntry(uint32_t address,
+                                             uint32_t** const entry) {
+  const uint32_t level = LevelOf(address);
+  if (level == recursion_level_) {
+    *entry = nullptr;
+    return OramStatus::OK;
+  }
+
+  auto iter = plb_index_.find(PositionBlockOf(address));
+  if (iter == plb_index_.end()) {
+    return OramStatus(StatusCode::kObjectNotFound,
+                      oram_utils::StrCat("The position block of ", address,
+                                         " is not in the PLB"),
+                      __func__);
+  }
+
+  // Move the block to the front.
+  plb_.splice(plb_.begin(), plb_, iter->second);
+  *entry = reinterpret_cast<uint32_t*>(plb_.front().data) +
+           (address - level_base_[level]) % kPositionsPerBlock;
+  return OramStatus::OK;
+}
+
+OramStatus PathOramController::SwapPosition(uint32_t address,
+                                            uint32_t new_position,
+                                            uint32_t* const old_position) {
+  uint32_t* entry;
+  OramStatus status = PositionEntry(address, &entry);
+  if (!status.ok()) {
+    return status;
+  }
+
+  if (entry == nullptr) {
+    const uint32_t index = address - level_base_[recursion_level_];
+    *old_position = position_map_[index];
+    position_map_[index] = new_position;
+  } else {
+    *old_position = *entry;
+    *entry = new_position;
+  }
+
+  return OramStatus::OK;
+}
+
+OramStatus PathOramController::GetPosition(uint32_t address,
+                                           uint32_t* const position) {
+  uint32_t* entry;
+  OramStatus status = PositionEntry(address, &entry);
+  if (!status.ok()) {
+    return status;
+  }
+
+  *position = entry == nullptr
+                  ? position_map_[address - level_base_[recursion_level_]]
+                  : *entry;
+  return OramStatus::OK;
+}
+
+OramStatus PathOramController::CheckOutPositionBlocks(uint32_t address) {
+  std::vector<uint32_t> missing;
+  for (uint32_t level = LevelOf(address); level < recursion_level_; level++) {
+    address = PositionBlockOf(address);
+    if (plb_index_.contains(address)) {
       break;
     }
+    missing.emplace_back(address);
+  }
+
+  // From the top down, the position block of each block is in the PLB or it
+  // is the top level. Each one is an ordinary access to the tree on the path
+  // the block was mapped to, which the server cannot tell from a data access.
+  for (auto iter = missing.rbegin(); iter != missing.rend(); iter++) {
+    const uint32_t x = RandomPosition();
+    uint32_t prev;
+    OramStatus status = SwapPosition(*iter, x, &prev);
+    if (!status.ok()) {
+      return status;
+    }
+
+    oram_block_t block;
+    status = InternalAccessDirect(Operation::kRead, *iter, prev, &block, false);
+    if (!status.ok()) {
+      return status;
+    }
+
+    block.header.leaf = x;
+    PutIntoPlb(block);
   }
 
-  oram_utils::PadStash(&subset, bucket_size_);
-  return subset;
+  return OramStatus::OK;
+}
+
+void PathOramController::PutIntoPlb(const oram_block_t& block) {
+  plb_.emplace_front(block);
+  plb_index_[block.header.block_id] = plb_.begin();
+
+  // The least recently used block goes back into the stash on the leaf its
+  // parent holds, and is written back by the next accesses.
+  if (plb_.size() > plb_size_) {
+    const oram_block_t& victim = plb_.back();
+    stash_.Insert(victim, victim.header.leaf);
+    plb_index_.erase(victim.header.block_id);
+    plb_.pop_back();
+  }
 }
 
 // If we want to use Path ORAM as the underlying black-box ORAM, we need to
@@ -343,6 +821,10 @@ OramStatus PathOramController::InternalAccess(Operation op_type,
       address, (int)op_type, dummy);
   // First we do a sanity check.
   PANIC_IF(op_type == Operation::kInvalid, "Invalid operation.");
+  if (!dummy && recursion_level_ > 0 && address >= level_base_[1]) {
+    return OramStatus(StatusCode::kInvalidArgument,
+                      "The address exceeds the ORAM", __func__);
+  }
 
   // Next, we shall the get the real path of the current block.
   // @ref Stefanov's paper for full details.
@@ -351,43 +833,94 @@ OramStatus PathOramController::InternalAccess(Operation op_type,
   // Let x denote the block’s old position.
   uint32_t x = RandomPosition();
 
+  //
+  // With a recursive position map, the position blocks missing from the PLB
+  // are checked out first. A dummy access is a single access, the same as a
+  // real one whose position block is in the PLB.
   if (!dummy) {
-    uint32_t prev = position_map_[address];
+    OramStatus status = CheckOutPositionBlocks(address);
+    if (!status.ok()) {
+      return status;
+    }
+
+    uint32_t prev;
     // Use x as the block's path.
-    position_map_[address] = x;
+    status = SwapPosition(address, x, &prev);
+    if (!status.ok()) {
+      return status;
+    }
     x = prev;
   }
 
   return InternalAccessDirect(op_type, address, x, data, dummy);
 }
 
+// The blocks evicted from a slot of Partition ORAM are not in this ORAM, so
+// they are given fresh random leaves and put straight into the stash. The
+// write-back of a dummy access then places as many stash blocks as fit on a
+// random path, which holds up to Z * (L + 1) blocks. The server sees a single
+// path access whatever the number of blocks.
+OramStatus PathOramController::InternalEvict(
+    std::vector<oram_block_t>& blocks) {
+  OramStatus status = InternalPiggyback(blocks);
+  if (!status.ok()) {
+    return status;
+  }
+
+  return InternalAccessDirect(Operation::kWrite, 0, RandomPosition(), nullptr,
+                              true);
+}
+
+OramStatus PathOramController::InternalPiggyback(
+    std::vector<oram_block_t>& blocks) {
+  if (!is_initialized_ || standalone_) {
+    return OramStatus(StatusCode::kInvalidOperation,
+                      "Only an initialized partition of Partition ORAM can "
+                      "take in evicted blocks.",
+                      __func__);
+  }
+
+  for (oram_block_t& block : blocks) {
+    const uint32_t x = RandomPosition();
+    position_map_[block.header.block_id] = x;
+    block.header.type = BlockType::kNormal;
+    stash_.Insert(block, x);
+  }
+
+  return OramStatus::OK;
+}
+
 OramStatus PathOramController::InternalAccessDirect(Operation op_type,
                                                     uint32_t address,
                                                     uint32_t x,
                                                     oram_block_t* const data,
                                                     bool dummy) {
-  // Step 3-5: Read the whole path from the server into the stash.
-  p_oram_path_t bucket_this_path;
-
-  for (size_t i = 0; i <= tree_level_; i++) {
-    p_oram_bucket_t bucket_this_level;
-    OramStatus status = ReadBucket(x, i, &bucket_this_level);
+  OramStatus status = SendReadFullPath(x);
+  if (!status.ok()) {
+    return status;
+  }
 
-    if (!status.ok()) {
-      return status.Append(OramStatus(
-          StatusCode::kInvalidOperation,
-          oram_utils::StrCat("Failed to write bucket ", x), __func__));
-    }
+  status = ServeAccess(op_type, address, x, data, dummy);
+  return status.ok() ? ReceiveWriteFullPath() : status;
+}
 
-    bucket_this_path.emplace_back(bucket_this_level);
-  }
+OramStatus PathOramController::ServeAccess(Operation op_type,
+                                           uint32_t address, uint32_t x,
+                                           oram_block_t* const data,
+                                           bool dummy) {
+  // Step 3-5: Read the whole path from the server into the stash.
+  p_oram_path_t bucket_this_path;
+  OramStatus status = ReceiveReadFullPath(&bucket_this_path);
 
-  if (dummy) {
-    // Invoke a dummy read operation and everything is done here.
-    return OramStatus::OK;
+  if (!status.ok()) {
+    return status.Append(
+        OramStatus(StatusCode::kInvalidOperation,
+                   oram_utils::StrCat("Failed to read path ", x), __func__));
   }
 
-  // Read all the blocks into the stash.
+  // Read all the blocks into the stash. This is also done for dummy accesses
+  // so that the path can be written back with the blocks it holds; otherwise
+  // they would be lost because the server clears a bucket once it is read.
   for (size_t i = 0; i <= tree_level_; i++) {
     for (size_t j = 0; j < bucket_this_path[i].size(); j++) {
       oram_block_t block = bucket_this_path[i][j];
@@ -396,43 +929,61 @@ OramStatus PathOramController::InternalAccessDirect(Operation op_type,
       // If there is no such block, we add it to the stash.
       //
       // <=> S = S ∪ ReadBucket(P(x, l))
-      auto iter = std::find_if(stash_.begin(), stash_.end(),
-                               BlockEqual(block.header.block_id));
-      if (iter == stash_.end() && block.header.type == BlockType::kNormal) {
-        stash_.emplace_back(block);
+      if (block.header.type == BlockType::kNormal) {
+        stash_.Insert(block, block.header.leaf);
       }
     }
   }
 
   // Step 6-9: Update block, if any.
   // If the access is a write, update the data stored for block a.
-  auto iter = std::find_if(stash_.begin(), stash_.end(), BlockEqual(address));
-  DBG(logger, "------------------------------------------------------");
-  oram_utils::PrintStash(stash_);
-  DBG(logger, "------------------------------------------------------");
-
-  if (iter == stash_.end()) {
-    return OramStatus(StatusCode::kObjectNotFound,
-                      oram_utils::StrCat("Failed to find the block ", address,
-                                         " in the stash!"),
-                      __func__);
-  }
-
-  // HACK: This may be incorrect.
-  stash_size_ = std::max(stash_size_, stash_.size());
+  if (!dummy) {
+    // The position has already been remapped by the caller.
+    uint32_t position;
+    status = GetPosition(address, &position);
+    if (!status.ok()) {
+      return status;
+    }
 
-  // Update the block.
-  if (op_type == Operation::kWrite) {
-    memcpy(iter->data, data->data, DEFAULT_ORAM_DATA_SIZE);
-    // Write the data length as well.
-    iter->header.data_len = data->header.data_len;
-  } else {
-    memcpy(data, &(*iter), ORAM_BLOCK_SIZE);
+    oram_block_t* const block = stash_.Find(address);
+    DBG(logger, "------------------------------------------------------");
+    oram_utils::PrintStash(stash_);
+    DBG(logger, "------------------------------------------------------");
+
+    if (block == nullptr) {
+      if (standalone_ || op_type != Operation::kWrite) {
+        return OramStatus(StatusCode::kObjectNotFound,
+                          oram_utils::StrCat("Failed to find the block ",
+                                             address, " in the stash!"),
+                          __func__);
+      }
 
-    if (!standalone_) {
-      // For Partition ORAM. => READ AND REMOVE.
-      stash_.erase(iter);
-      position_map_.erase(address);
+      // For Partition ORAM. => A block evicted from the slot was removed from
+      // this ORAM when it was read, so we insert it back into the stash.
+      oram_block_t evicted = *data;
+      evicted.header.block_id = address;
+      evicted.header.type = BlockType::kNormal;
+      stash_.Insert(evicted, position);
+    } else if (op_type == Operation::kWrite) {
+      // Update the block.
+      memcpy(block->data, data->data, DEFAULT_ORAM_DATA_SIZE);
+      // Write the data length as well.
+      block->header.data_len = data->header.data_len;
+      // The block may have been remapped to a new position.
+      stash_.UpdateLeaf(address, position);
+    } else {
+      memcpy(data, block, ORAM_BLOCK_SIZE);
+
+      if (IsPositionBlock(address)) {
+        // The position block is checked out into the PLB.
+        stash_.Remove(address);
+      } else if (!standalone_) {
+        // For Partition ORAM. => READ AND REMOVE.
+        stash_.Remove(address);
+        position_map_.erase(address);
+      } else {
+        stash_.UpdateLeaf(address, position);
+      }
     }
   }
 
@@ -446,20 +997,20 @@ OramStatus PathOramController::InternalAccessDirect(Operation op_type,
   // the leaf of block a' intersects the path accessed P(x) at level l. In
   // other words, if P(x, l) = P(position[a'], l).
 
-  // Prevent overflow for unsigned variable...
-  for (size_t i = tree_level_ + 1; i >= 1; i--) {
-    // Find a subset S' of stash such that the element in S' intersects with
-    // the current old path of x. I.e., S' ← {(a', data') \in S : P(x, l) =
-    // P(position[a'], l)} Select min(|S'|, Z) blocks. If |S'| < Z, then we
-    // pad S' with dummy blocks. Expire all blocks in S that are in S'. Write
-    // them back.
-    p_oram_stash_t subset = std::move(FindSubsetOf(x));
-    OramStatus status = WriteBucket(x, i - 1, subset);
+  // Find, for every level l on P(x), a subset S' of the stash such that the
+  // elements in S' intersect with the current old path of x. I.e., S' ←
+  // {(a', data') \in S : P(x, l) = P(position[a'], l)}. Select min(|S'|, Z)
+  // blocks. If |S'| < Z, then we pad S' with dummy blocks. Expire all blocks
+  // in S that are in S'. The whole path is written back in a single round
+  // trip.
+  p_oram_path_t path_to_write = std::move(FindSubsetOf(x));
+  stash_size_ = std::max(stash_size_, stash_.size());
 
-    if (!status.ok()) {
-      return status.Append(OramStatus(StatusCode::kInvalidOperation,
-                                      "Failed to write bucket", __func__));
-    }
+  // Write them back; the caller waits for the write-back.
+  status = SendWriteFullPath(x, path_to_write);
+  if (!status.ok()) {
+    return status.Append(OramStatus(StatusCode::kInvalidOperation,
+                                    "Failed to write path", __func__));
   }
 
   return OramStatus::OK;
@@ -17,6 +17,10 @@
 #ifndef ORAM_IMPL_CORE_PATH_ORAM_CONTROLLER_H_
 #define ORAM_IMPL_CORE_PATH_ORAM_CONTROLLER_H_
 
+#include <future>
+#include <list>
+#include <memory>
+
 #include "oram_controller.h"
 
 #include "base/oram_config.h"
@@ -25,16 +29,42 @@ namespace oram_impl {
 
 // This class is the implementation of the ORAM controller for Path ORAM.
 class PathOramController : public OramController {
-  friend class PartitionOramController;
-
+ protected:
+  // The tree layout, the stash and the RPCs are shared with Circuit ORAM.
   // ORAM parameters.
   uint32_t tree_level_;
   uint8_t bucket_size_;
   uint32_t number_of_leafs_;
-  // stash size.
+  // The largest stash left after the eviction of an access. The position
+  // blocks checked out into the PLB are not in the stash.
   size_t stash_size_;
 
+  // If the position map is stored recursively, the position blocks live in
+  // the same tree as the data blocks, as in the unified tree of Freecursive
+  // ORAM. The blocks of level 0 are the data blocks, and each block of level
+  // i > 0 holds `kPositionsPerBlock` leaves of the blocks of level i - 1. Only
+  // the leaves of the top level are kept in `position_map_`.
+  uint32_t recursion_level_;
+  // [level] -> the address of the first block of the level, followed by the
+  // number of blocks of all the levels.
+  std::vector<uint32_t> level_base_;
   p_oram_position_t position_map_;
+  // The position-map lookaside buffer (PLB): a small LRU cache of position
+  // blocks that are checked out of the tree. An evicted block goes back into
+  // the stash with the leaf it was given when it was checked out. Every
+  // access looks like an access to the one tree whatever the level, but the
+  // number of accesses per request grows with the PLB misses; Freecursive
+  // ORAM has the same leakage.
+  size_t plb_size_;
+  std::list<oram_block_t> plb_;
+  absl::flat_hash_map<uint32_t, std::list<oram_block_t>::iterator> plb_index_;
+  // The treetop cache: the top `treetop_level_` levels of the tree are kept on
+  // the client in heap order (the bucket at (level, offset) is at index
+  // 2^level - 1 + offset), and only the levels below are sent to the server.
+  uint32_t treetop_level_;
+  std::vector<p_oram_bucket_t> treetop_;
+  // The number of blocks served by the treetop cache instead of the server.
+  size_t treetop_communication_;
   // The stash should be tied to the slots of Partition ORAM, so we use
   // pointers to manipulate the stash.
   p_oram_stash_t stash_;
@@ -43,18 +73,62 @@ class PathOramController : public OramController {
   // Networking communication.
   size_t network_communication_;
 
-  // ==================== Begin private methods ==================== //
+  // The RPCs in flight: at most one path read and one path write-back.
+  p_oram_path_t pending_path_;
+  ReadFullPathResponse read_response_;
+  std::future<grpc::Status> pending_read_;
+  std::chrono::high_resolution_clock::time_point read_begin_;
+  WritePathResponse write_response_;
+  std::future<grpc::Status> pending_write_;
+  std::chrono::high_resolution_clock::time_point write_begin_;
+
+  // ==================== Begin protected methods ==================== //
   OramStatus ReadBucket(uint32_t path, uint32_t level,
                         p_oram_bucket_t* const bucket);
   OramStatus WriteBucket(uint32_t path, uint32_t level,
                          const p_oram_bucket_t& bucket);
   OramStatus AccurateWriteBucket(uint32_t level, uint32_t offset,
                                  const p_oram_bucket_t& bucket);
+  // Moves the whole path in a single round trip instead of one per level.
+  OramStatus ReadFullPath(uint32_t path, p_oram_path_t* const out_path);
+  OramStatus WriteFullPath(uint32_t path, const p_oram_path_t& in_path);
+  // The two halves of the calls above. A read waits for the last write-back,
+  // so that the server never sees them out of order.
+  OramStatus SendReadFullPath(uint32_t path);
+  OramStatus ReceiveReadFullPath(p_oram_path_t* const out_path);
+  OramStatus SendWriteFullPath(uint32_t path, const p_oram_path_t& in_path);
+  OramStatus ReceiveWriteFullPath(void);
   OramStatus PrintOramTree(void);
+  // Returns the cached bucket on P(path) at `level`, or nullptr if the level is
+  // not covered by the treetop cache.
+  p_oram_bucket_t* TreetopBucket(uint32_t path, uint32_t level);
+
+  // Greedily assigns stash blocks to the buckets on P(current_path) from the
+  // leaf to the root and removes them from the stash.
+  p_oram_path_t FindSubsetOf(uint32_t current_path);
+
+  uint32_t LevelOf(uint32_t address) const;
+  bool IsPositionBlock(uint32_t address) const { return LevelOf(address) > 0; }
+  // The address of the position block that holds the leaf of `address`.
+  uint32_t PositionBlockOf(uint32_t address) const;
+  // Returns the entry for the leaf of `address` in its position block, which
+  // must be in the PLB, or nullptr if the leaf is kept in `position_map_`.
+  OramStatus PositionEntry(uint32_t address, uint32_t** const entry);
+  // Fetches the position of `address` and replaces it by `new_position`.
+  OramStatus SwapPosition(uint32_t address, uint32_t new_position,
+                          uint32_t* const old_position);
+  OramStatus GetPosition(uint32_t address, uint32_t* const position);
+  // Checks the position blocks on the way from `address` to the first one in
+  // the PLB out of the tree, from the top down, with one access each.
+  OramStatus CheckOutPositionBlocks(uint32_t address);
+  void PutIntoPlb(const oram_block_t& block);
+  // ==================== End protected methods ==================== //
+
+  PathOramController(uint32_t id, uint32_t block_num, uint32_t bucket_size,
+                     bool standalone, uint32_t recursion_level,
+                     size_t plb_size, uint32_t treetop_level,
+                     OramType oram_type);
 
-  p_oram_stash_t FindSubsetOf(uint32_t current_path);
-  // ==================== End private methods ==================== //
- protected:
   virtual OramStatus InternalAccess(Operation op_type, uint32_t address,
                                     oram_block_t* const data,
                                     bool dummy = false);
@@ -64,10 +138,25 @@ class PathOramController : public OramController {
                                           uint32_t position,
                                           oram_block_t* const data,
                                           bool dummy = false);
+  // Puts all the blocks into the stash and writes them back together with one
+  // dummy access to a random path.
+  virtual OramStatus InternalEvict(std::vector<oram_block_t>& blocks) override;
+  // Only puts the blocks into the stash.
+  virtual OramStatus InternalPiggyback(
+      std::vector<oram_block_t>& blocks) override;
+  // Steps 3-15 of the access once the read of P(x) has been sent: receives
+  // the path, serves the request from the stash and sends the write-back.
+  OramStatus ServeAccess(Operation op_type, uint32_t address, uint32_t x,
+                         oram_block_t* const data, bool dummy);
 
  public:
+  // If `recursion_level` > 0, the position map is stored in that many levels
+  // of position blocks in the tree, fronted by a PLB of `plb_size` blocks. The
+  // top `treetop_level` levels of the tree are cached on the client.
   PathOramController(uint32_t id, uint32_t block_num, uint32_t bucket_size,
-                     bool standalone = true);
+                     bool standalone = true, uint32_t recursion_level = 0,
+                     size_t plb_size = kDefaultPlbSize,
+                     uint32_t treetop_level = 0);
 
   virtual OramStatus InitOram(void) override;
   virtual OramStatus FillWithData(
@@ -84,12 +173,22 @@ class PathOramController : public OramController {
 
   p_oram_position_t GetPositionMap(void) const { return position_map_; }
   uint32_t GetTreeLevel(void) const { return tree_level_; }
-  size_t ReportClientStorage(void) const;
+  virtual size_t GetDataSize(void) const override {
+    return (POW2(tree_level_ + 1) - 1) * bucket_size_;
+  }
+  uint32_t GetRecursionLevel(void) const { return recursion_level_; }
+  virtual size_t ReportClientStorage(void) const override;
   size_t ReportStashSize(void) const { return stash_size_; }
-  size_t ReportNetworkCommunication(void) const;
-  std::chrono::microseconds ReportNetworkingTime(void) const {
-    return network_time_;
+  virtual size_t ReportNetworkCommunication(void) const override;
+  // The memory / bandwidth trade-off of the treetop cache: the bytes held on
+  // the client for the cached levels and the bytes that would otherwise have
+  // been sent over the network.
+  size_t ReportTreetopStorage(void) const;
+  size_t ReportTreetopCommunication(void) const {
+    return treetop_communication_ * ORAM_BLOCK_SIZE;
   }
+  virtual std::chrono::microseconds ReportNetworkingTime(
+      void) const override;
 };
 }  // namespace oram_impl
 
@@ -0,0 +1,689 @@
+/*
+ Copyright (c) 2022 Haobin Chen
+
+ This program is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "ring_oram_controller.h"
+
+#include <spdlog/spdlog.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+
+#include "oram.h"
+#include "base/oram_crypto.h"
+#include "base/oram_utils.h"
+
+extern std::shared_ptr<spdlog::logger> logger;
+
+using std::chrono_literals::operator""us;
+
+namespace oram_impl {
+static void ToMetadata(const oram_block_t& block,
+                       ring_oram_metadata_t* const metadata) {
+  memcpy(metadata, block.data, sizeof(ring_oram_metadata_t));
+}
+
+static oram_block_t FromMetadata(const ring_oram_metadata_t& metadata) {
+  oram_block_t block;
+  memset(&block, 0, ORAM_BLOCK_SIZE);
+  block.header.block_id = kInvalidMask;
+  block.header.type = BlockType::kNormal;
+  memcpy(block.data, &metadata, sizeof(ring_oram_metadata_t));
+  return block;
+}
+
+RingOramController::RingOramController(uint32_t id, uint32_t block_num,
+                                       uint32_t bucket_size, bool standalone,
+                                       uint32_t dummy_num, uint32_t evict_rate)
+    : OramController(id, standalone, block_num, OramType::kRingOram),
+      bucket_size_(bucket_size),
+      dummy_num_(dummy_num),
+      evict_rate_(std::max(evict_rate, 1u)),
+      access_counter_(0),
+      evict_counter_(0),
+      stash_size_(0ul),
+      network_time_(0us),
+      network_communication_(0ul) {
+  PANIC_IF(bucket_size_ + dummy_num_ > kMaximumRingSlotNum,
+           "Too many slots in a bucket of Ring ORAM.");
+
+  const size_t bucket_num = std::ceil(block_num * 1.0 / bucket_size);
+  // Note that the level starts from 0.
+  tree_level_ = std::ceil(LOG_BASE(bucket_num + 1, 2)) - 1;
+  number_of_leafs_ = POW2(tree_level_);
+  position_map_ = p_oram_position_t(block_num, number_of_leafs_ - 1);
+
+  DBG(logger,
+      "RingORAM Config:\n"
+      "id: {}, number_of_leafs: {}, Z: {}, S: {}, A: {}, tree_height: {}\n",
+      id_, number_of_leafs_, bucket_size_, dummy_num_, evict_rate_,
+      tree_level_);
+}
+
+uint32_t RingOramController::RandomPosition(void) {
+  uint32_t x;
+  oram_utils::CheckStatus(
+      oram_crypto::UniformRandom(0, number_of_leafs_ - 1, &x),
+      "UniformRandom error");
+  return x;
+}
+
+size_t RingOramController::ReportClientStorage(void) const {
+  return stash_.size() * ORAM_BLOCK_SIZE + position_map_.ReportStorage();
+}
+
+size_t RingOramController::ReportNetworkCommunication(void) const {
+  return network_communication_ * ORAM_BLOCK_SIZE;
+}
+
+OramStatus RingOramController::InitOram(void) {
+  grpc::ClientContext context;
+  InitTreeOramRequest request;
+  google::protobuf::Empty empty;
+
+  ASSEMBLE_HEADER(request, id_, instance_hash_, GetVersion());
+  // Z + S data slots plus the metadata slot.
+  request.set_bucket_size(SlotNum() + 1);
+  request.set_bucket_num(number_of_leafs_);
+  request.set_block_size(ORAM_BLOCK_SIZE);
+
+  grpc::Status status = stub_->InitTreeOram(&context, request, &empty);
+  if (!status.ok()) {
+    return OramStatus(StatusCode::kServerError, status.error_message(),
+                      __func__);
+  }
+
+  return OramStatus::OK;
+}
+
+p_oram_bucket_t RingOramController::BuildBucket(
+    const p_oram_bucket_t& real_blocks) {
+  p_oram_bucket_t bucket = real_blocks;
+  oram_utils::PadStash(&bucket, SlotNum());
+
+  // Randomly permute the slots so that the server cannot tell which slot is
+  // real when one of them is read.
+  oram_utils::CheckStatus(oram_crypto::RandomShuffle<oram_block_t>(bucket),
+                          "Random shuffle failed due to internal error.");
+
+  ring_oram_metadata_t metadata;
+  memset(&metadata, 0, sizeof(ring_oram_metadata_t));
+  for (size_t i = 0; i < bucket.size(); i++) {
+    metadata.block_ids[i] = bucket[i].header.type == BlockType::kNormal
+                                ? bucket[i].header.block_id
+                                : kInvalidMask;
+    metadata.valid[i] = 1;
+  }
+
+  bucket.emplace_back(FromMetadata(metadata));
+  return bucket;
+}
+
+// The input vector of blocks is laid out as for the Path ORAM, i.e., it is
+// greedily placed into the buckets from the leaf to the root.
+OramStatus RingOramController::FillWithData(
+    const std::vector<oram_block_t>& data) {
+  // The blocks are laid out Z per bucket, so any real block beyond the Z real
+  // slots of every bucket would be lost.
+  const size_t real_slot_num = (POW2(tree_level_ + 1) - 1) * bucket_size_;
+  for (size_t i = real_slot_num; i < data.size(); i++) {
+    if (data[i].header.type == BlockType::kNormal) {
+      return OramStatus(StatusCode::kInvalidArgument,
+                        "The blocks do not fit into the real slots of the tree",
+                        __func__);
+    }
+  }
+
+  // The buckets are streamed to the server in chunks, each producer call
+  // resuming at (level, offset).
+  size_t p_data = 0;
+  int level = tree_level_;
+  uint32_t offset = 0;
+  OramStatus status = BulkLoad([&](BulkLoadRequest* const chunk,
+                                   bool* const done) {
+    size_t chunk_size = 0;
+    for (; level >= 0; level--, offset = 0) {
+      const uint32_t level_size = POW2(level);
+      const uint32_t span = POW2(tree_level_ - level);
+
+      for (; offset < level_size; offset++) {
+        if (chunk_size >= kBulkLoadChunkSize) {
+          return OramStatus::OK;
+        }
+
+        p_oram_bucket_t real_blocks;
+
+        // This determined the range of the current bucket in terms of path.
+        const uint32_t begin = offset * span;
+        const uint32_t end = begin + span - 1;
+
+        for (size_t k = 0; k < bucket_size_ && p_data < data.size(); k++) {
+          if (data[p_data].header.type == BlockType::kNormal) {
+            uint32_t path;
+            oram_utils::CheckStatus(
+                oram_crypto::UniformRandom(begin, end, &path),
+                "UniformRandom error");
+            real_blocks.emplace_back(data[p_data]);
+            position_map_[data[p_data].header.block_id] = path;
+          }
+
+          p_data++;
+        }
+
+        chunk_size +=
+            AppendToChunk(level, offset, BuildBucket(real_blocks), chunk);
+      }
+    }
+
+    *done = true;
+    return OramStatus::OK;
+  });
+
+  if (!status.ok()) {
+    return status.Append(OramStatus(
+        StatusCode::kInvalidOperation,
+        "Failed to load the buckets when intializing the ORAM!", __func__));
+  }
+
+  is_initialized_ = true;
+
+  return OramStatus::OK;
+}
+
+OramStatus RingOramController::ReadSlots(
+    uint32_t path, const std::vector<std::vector<uint32_t>>& slots,
+    p_oram_path_t* const out_path) {
+  grpc::ClientContext context;
+  ReadSlotsRequest request;
+  ReadFullPathResponse response;
+
+  ASSEMBLE_HEADER(request, id_, instance_hash_, GetVersion());
+  request.set_path(path);
+  for (const auto& slot_list : slots) {
+    SlotListMessage* const message = request.add_slots();
+    for (const uint32_t slot : slot_list) {
+      message->add_slot(slot);
+    }
+  }
+
+  auto begin = std::chrono::high_resolution_clock::now();
+  grpc::Status status = stub_->ReadSlots(&context, request, &response);
+  auto end = std::chrono::high_resolution_clock::now();
+
+  network_time_ +=
+      std::chrono::duration_cast<std::chrono::microseconds>(end - begin);
+
+  if (!status.ok()) {
+    return OramStatus(StatusCode::kServerError, status.error_message(),
+                      __func__);
+  }
+
+  for (const auto& message : response.buckets()) {
+    p_oram_bucket_t bucket;
+
+    for (const auto& block_str : message.bucket()) {
+      oram_block_t block;
+      oram_utils::ConvertToBlock(block_str, &block);
+      oram_utils::DecryptBlock(&block, cryptor_.get());
+      bucket.emplace_back(block);
+    }
+
+    network_communication_ += bucket.size();
+    out_path->emplace_back(std::move(bucket));
+  }
+
+  return OramStatus::OK;
+}
+
+OramStatus RingOramController::WriteSlots(
+    uint32_t path, const std::vector<std::vector<uint32_t>>& slots,
+    const p_oram_path_t& in_path) {
+  grpc::ClientContext context;
+  WriteSlotsRequest request;
+  WritePathResponse response;
+
+  ASSEMBLE_HEADER(request, id_, instance_hash_, GetVersion());
+  request.set_path(path);
+  for (size_t i = 0; i < slots.size(); i++) {
+    SlotListMessage* const slot_message = request.add_slots();
+    BucketMessage* const bucket_message = request.add_buckets();
+
+    for (size_t j = 0; j < slots[i].size(); j++) {
+      slot_message->add_slot(slots[i][j]);
+
+      oram_block_t block = in_path[i][j];
+      oram_utils::EncryptBlock(&block, cryptor_.get());
+      std::string block_str;
+      oram_utils::ConvertToString(&block, &block_str);
+      bucket_message->add_bucket(block_str);
+    }
+
+    network_communication_ += slots[i].size();
+  }
+
+  auto begin = std::chrono::high_resolution_clock::now();
+  grpc::Status status = stub_->WriteSlots(&context, request, &response);
+  auto end = std::chrono::high_resolution_clock::now();
+
+  network_time_ +=
+      std::chrono::duration_cast<std::chrono::microseconds>(end - begin);
+
+  if (!status.ok()) {
+    return OramStatus(StatusCode::kServerError, status.error_message(),
+                      __func__);
+  }
+
+  return OramStatus::OK;
+}
+
+OramStatus RingOramController::WriteFullPath(uint32_t path,
+                                             const p_oram_path_t& in_path) {
+  grpc::ClientContext context;
+  WriteFullPathRequest request;
+  WritePathResponse response;
+
+  ASSEMBLE_HEADER(request, id_, instance_hash_, GetVersion());
+  request.set_path(path);
+
+  for (const auto& bucket : in_path) {
+    BucketMessage* const message = request.add_buckets();
+
+    for (auto block : bucket) {
+      oram_utils::EncryptBlock(&block, cryptor_.get());
+      std::string block_str;
+      oram_utils::ConvertToString(&block, &block_str);
+      message->add_bucket(block_str);
+    }
+
+    network_communication_ += bucket.size();
+  }
+
+  auto begin = std::chrono::high_resolution_clock::now();
+  grpc::Status status = stub_->WriteFullPath(&context, request, &response);
+  auto end = std::chrono::high_resolution_clock::now();
+
+  network_time_ +=
+      std::chrono::duration_cast<std::chrono::microseconds>(end - begin);
+
+  if (!status.ok()) {
+    return OramStatus(StatusCode::kServerError, status.error_message(),
+                      __func__);
+  }
+
+  return OramStatus::OK;
+}
+
+OramStatus RingOramController::ReadMetadata(
+    uint32_t path, std::vector<ring_oram_metadata_t>* const metadata) {
+  const std::vector<std::vector<uint32_t>> slots(
+      tree_level_ + 1, std::vector<uint32_t>{SlotNum()});
+  p_oram_path_t blocks;
+  OramStatus status = ReadSlots(path, slots, &blocks);
+  if (!status.ok()) {
+    return status;
+  }
+
+  metadata->resize(tree_level_ + 1);
+  for (size_t i = 0; i <= tree_level_; i++) {
+    ToMetadata(blocks[i].front(), &(*metadata)[i]);
+  }
+
+  return OramStatus::OK;
+}
+
+OramStatus RingOramController::ReadValidSlots(
+    uint32_t path, const std::vector<ring_oram_metadata_t>& metadata,
+    const std::vector<bool>& levels) {
+  std::vector<std::vector<uint32_t>> slots(tree_level_ + 1);
+  for (size_t i = 0; i <= tree_level_; i++) {
+    if (!levels[i]) {
+      continue;
+    }
+
+    // Valid real blocks first, then valid dummies until there are Z slots.
+    // Since a bucket is reshuffled once it has been read S times, at least Z
+    // of its Z + S slots are always valid.
+    std::vector<uint32_t> dummies;
+    for (uint32_t j = 0; j < SlotNum(); j++) {
+      if (!metadata[i].valid[j]) {
+        continue;
+      }
+
+      if (metadata[i].block_ids[j] != kInvalidMask) {
+        slots[i].emplace_back(j);
+      } else {
+        dummies.emplace_back(j);
+      }
+    }
+
+    for (size_t j = 0; j < dummies.size() && slots[i].size() < bucket_size_;
+         j++) {
+      slots[i].emplace_back(dummies[j]);
+    }
+
+    // Reading fewer slots would show the server that the invariant is broken.
+    if (slots[i].size() < bucket_size_) {
+      return OramStatus(
+          StatusCode::kInvalidOperation,
+          oram_utils::StrCat("Only ", slots[i].size(),
+                             " valid slots are left in the bucket at level ",
+                             i),
+          __func__);
+    }
+  }
+
+  p_oram_path_t blocks;
+  OramStatus status = ReadSlots(path, slots, &blocks);
+  if (!status.ok()) {
+    return status;
+  }
+
+  for (const auto& bucket : blocks) {
+    for (const auto& block : bucket) {
+      if (block.header.type == BlockType::kNormal) {
+        stash_.Insert(block, position_map_[block.header.block_id]);
+      }
+    }
+  }
+
+  return OramStatus::OK;
+}
+
+p_oram_path_t RingOramController::FindSubsetOf(uint32_t current_path) {
+  std::vector<std::vector<uint32_t>> candidates(tree_level_ + 1);
+  stash_.ForEachLeaf([&](uint32_t leaf, const std::vector<uint32_t>& ids) {
+    std::vector<uint32_t>& level_candidates =
+        candidates[oram_utils::DeepestCommonLevel(leaf, current_path,
+                                                  tree_level_)];
+    level_candidates.insert(level_candidates.end(), ids.begin(), ids.end());
+  });
+
+  p_oram_path_t path(tree_level_ + 1);
+  std::vector<uint32_t> pending;
+  for (size_t i = tree_level_ + 1; i >= 1; i--) {
+    const size_t level = i - 1;
+    pending.insert(pending.end(), candidates[level].begin(),
+                   candidates[level].end());
+
+    while (path[level].size() < bucket_size_ && !pending.empty()) {
+      path[level].emplace_back(*stash_.Find(pending.back()));
+      stash_.Remove(pending.back());
+      pending.pop_back();
+    }
+  }
+
+  return path;
+}
+
+OramStatus RingOramController::EvictPath(void) {
+  // Paths are evicted in reverse-lexicographic order of their leaves, which
+  // spreads consecutive evictions evenly over the tree.
+  const uint32_t path =
+      oram_utils::ReverseBits(evict_counter_ % number_of_leafs_, tree_level_);
+  evict_counter_++;
+
+  std::vector<ring_oram_metadata_t> metadata;
+  OramStatus status = ReadMetadata(path, &metadata);
+  if (!status.ok()) {
+    return status;
+  }
+
+  status = ReadValidSlots(path, metadata,
+                          std::vector<bool>(tree_level_ + 1, true));
+  if (!status.ok()) {
+    return status;
+  }
+
+  p_oram_path_t path_to_write = std::move(FindSubsetOf(path));
+  for (auto& bucket : path_to_write) {
+    bucket = BuildBucket(bucket);
+  }
+
+  return WriteFullPath(path, path_to_write);
+}
+
+OramStatus RingOramController::EarlyReshuffle(
+    uint32_t path, const std::vector<ring_oram_metadata_t>& metadata) {
+  std::vector<bool> levels(tree_level_ + 1, false);
+  bool any = false;
+  for (size_t i = 0; i <= tree_level_; i++) {
+    levels[i] = metadata[i].count >= dummy_num_;
+    any |= levels[i];
+  }
+
+  if (!any) {
+    return OramStatus::OK;
+  }
+
+  // Remember which blocks each bucket held; they can always be put back into
+  // the same bucket.
+  std::vector<std::vector<uint32_t>> block_ids(tree_level_ + 1);
+  for (size_t i = 0; i <= tree_level_; i++) {
+    for (uint32_t j = 0; levels[i] && j < SlotNum(); j++) {
+      if (metadata[i].valid[j] && metadata[i].block_ids[j] != kInvalidMask) {
+        block_ids[i].emplace_back(metadata[i].block_ids[j]);
+      }
+    }
+  }
+
+  OramStatus status = ReadValidSlots(path, metadata, levels);
+  if (!status.ok()) {
+    return status;
+  }
+
+  // Rewrite every slot of the reshuffled buckets.
+  std::vector<uint32_t> all_slots(SlotNum() + 1);
+  for (uint32_t j = 0; j <= SlotNum(); j++) {
+    all_slots[j] = j;
+  }
+
+  std::vector<std::vector<uint32_t>> slots(tree_level_ + 1);
+  p_oram_path_t buckets(tree_level_ + 1);
+  for (size_t i = 0; i <= tree_level_; i++) {
+    if (!levels[i]) {
+      continue;
+    }
+
+    p_oram_bucket_t real_blocks;
+    for (const uint32_t block_id : block_ids[i]) {
+      const oram_block_t* const block = stash_.Find(block_id);
+      if (block != nullptr) {
+        real_blocks.emplace_back(*block);
+        stash_.Remove(block_id);
+      }
+    }
+
+    slots[i] = all_slots;
+    buckets[i] = BuildBucket(real_blocks);
+  }
+
+  return WriteSlots(path, slots, buckets);
+}
+
+OramStatus RingOramController::InternalAccess(Operation op_type,
+                                              uint32_t address,
+                                              oram_block_t* const data,
+                                              bool dummy) {
+  if (!is_initialized_) {
+    return OramStatus(StatusCode::kInvalidOperation,
+                      "Cannot access ORAM before it is initialized."
+                      " You may need to call `InitOram()` and `FillWithData()` "
+                      "method first.",
+                      __func__);
+  }
+
+  PANIC_IF(op_type == Operation::kInvalid, "Invalid operation.");
+
+  // Remap the block and let x denote its old position.
+  uint32_t x = RandomPosition();
+  if (!dummy) {
+    // A block that is written into a partition has no path yet, so a random
+    // one is read instead.
+    const uint32_t prev =
+        position_map_.count(address) != 0 ? position_map_[address] : x;
+    position_map_[address] = x;
+    x = prev;
+  }
+
+  // Read the metadata of P(x) and pick one valid slot in each bucket: the one
+  // holding the block if it is there, or a random valid dummy otherwise.
+  std::vector<ring_oram_metadata_t> metadata;
+  OramStatus status = ReadMetadata(x, &metadata);
+  if (!status.ok()) {
+    return status.Append(OramStatus(
+        StatusCode::kInvalidOperation,
+        oram_utils::StrCat("Failed to read the metadata of path ", x),
+        __func__));
+  }
+
+  std::vector<std::vector<uint32_t>> slots(tree_level_ + 1);
+  for (size_t i = 0; i <= tree_level_; i++) {
+    std::vector<uint32_t> dummies;
+    uint32_t chosen = kInvalidMask;
+
+    for (uint32_t j = 0; j < SlotNum(); j++) {
+      if (!metadata[i].valid[j]) {
+        continue;
+      }
+
+      if (!dummy && metadata[i].block_ids[j] == address) {
+        chosen = j;
+      } else if (metadata[i].block_ids[j] == kInvalidMask) {
+        dummies.emplace_back(j);
+      }
+    }
+
+    if (chosen == kInvalidMask) {
+      if (dummies.empty()) {
+        return OramStatus(StatusCode::kInvalidOperation,
+                          "No valid dummy slot is left in the bucket",
+                          __func__);
+      }
+
+      uint32_t index;
+      oram_utils::CheckStatus(
+          oram_crypto::UniformRandom(0, dummies.size() - 1, &index),
+          "UniformRandom error");
+      chosen = dummies[index];
+    }
+
+    slots[i].emplace_back(chosen);
+    metadata[i].valid[chosen] = 0;
+    metadata[i].count++;
+  }
+
+  p_oram_path_t blocks;
+  status = ReadSlots(x, slots, &blocks);
+  if (!status.ok()) {
+    return status.Append(OramStatus(
+        StatusCode::kInvalidOperation,
+        oram_utils::StrCat("Failed to read slots of path ", x), __func__));
+  }
+
+  for (const auto& bucket : blocks) {
+    for (const auto& block : bucket) {
+      if (block.header.type == BlockType::kNormal) {
+        stash_.Insert(block, position_map_[block.header.block_id]);
+      }
+    }
+  }
+
+  // Write back the metadata with the read slots invalidated.
+  std::vector<std::vector<uint32_t>> metadata_slots(
+      tree_level_ + 1, std::vector<uint32_t>{SlotNum()});
+  p_oram_path_t metadata_blocks;
+  for (const auto& bucket_metadata : metadata) {
+    metadata_blocks.emplace_back(
+        p_oram_bucket_t{FromMetadata(bucket_metadata)});
+  }
+  status = WriteSlots(x, metadata_slots, metadata_blocks);
+  if (!status.ok()) {
+    return status;
+  }
+
+  // Update the block, if any.
+  if (!dummy) {
+    oram_block_t* const block = stash_.Find(address);
+    if (block == nullptr) {
+      if (standalone_ || op_type != Operation::kWrite) {
+        return OramStatus(StatusCode::kObjectNotFound,
+                          oram_utils::StrCat("Failed to find the block ",
+                                             address, " in the stash!"),
+                          __func__);
+      }
+
+      // For Partition ORAM. => A block evicted from the slot was removed from
+      // this ORAM when it was read, so we insert it back into the stash.
+      oram_block_t evicted = *data;
+      evicted.header.block_id = address;
+      evicted.header.type = BlockType::kNormal;
+      stash_.Insert(evicted, position_map_[address]);
+    } else if (op_type == Operation::kWrite) {
+      memcpy(block->data, data->data, DEFAULT_ORAM_DATA_SIZE);
+      block->header.data_len = data->header.data_len;
+      stash_.UpdateLeaf(address, position_map_[address]);
+    } else {
+      memcpy(data, block, ORAM_BLOCK_SIZE);
+
+      if (!standalone_) {
+        // For Partition ORAM. => READ AND REMOVE.
+        stash_.Remove(address);
+        position_map_.erase(address);
+      } else {
+        stash_.UpdateLeaf(address, position_map_[address]);
+      }
+    }
+  }
+
+  stash_size_ = std::max(stash_size_, stash_.size());
+
+  // Reshuffle the buckets that have run out of dummies.
+  status = EarlyReshuffle(x, metadata);
+  if (!status.ok()) {
+    return status;
+  }
+
+  // Evict one path every A accesses.
+  if (++access_counter_ % evict_rate_ == 0) {
+    return EvictPath();
+  }
+
+  return OramStatus::OK;
+}
+
+// The blocks evicted from a slot of Partition ORAM are given fresh random
+// leaves and put straight into the stash, from where the scheduled evictions
+// write them to the tree. The server sees one dummy access whatever the number
+// of blocks, instead of one access per block.
+OramStatus RingOramController::InternalEvict(
+    std::vector<oram_block_t>& blocks) {
+  if (!is_initialized_ || standalone_) {
+    return OramStatus(StatusCode::kInvalidOperation,
+                      "Only an initialized partition of Partition ORAM can "
+                      "take in evicted blocks.",
+                      __func__);
+  }
+
+  for (oram_block_t& block : blocks) {
+    const uint32_t x = RandomPosition();
+    position_map_[block.header.block_id] = x;
+    block.header.type = BlockType::kNormal;
+    stash_.Insert(block, x);
+  }
+
+  return InternalAccess(Operation::kWrite, 0, nullptr, true);
+}
+}  // namespace oram_impl
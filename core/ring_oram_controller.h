@@ -0,0 +1,133 @@
+/*
+ Copyright (c) 2022 Haobin Chen
+
+ This program is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#ifndef ORAM_IMPL_CORE_RING_ORAM_CONTROLLER_H_
+#define ORAM_IMPL_CORE_RING_ORAM_CONTROLLER_H_
+
+#include "oram_controller.h"
+
+namespace oram_impl {
+// The maximum number of slots (Z + S) in a bucket of Ring ORAM.
+static const uint32_t kMaximumRingSlotNum = 64;
+// Default parameters from the Ring ORAM paper for Z = 4.
+static const uint32_t kRingDefaultDummyNum = 6;
+static const uint32_t kRingDefaultEvictRate = 3;
+
+// The metadata of a bucket. It is stored encrypted in the data of the last
+// slot of the bucket so that the server cannot tell real blocks from dummies.
+typedef struct _ring_oram_metadata_t {
+  // How many times the bucket has been read since it was last written.
+  uint32_t count;
+  // The block held by each slot; kInvalidMask marks a dummy slot.
+  uint32_t block_ids[kMaximumRingSlotNum];
+  // Whether each slot has not been read since the bucket was last written.
+  uint8_t valid[kMaximumRingSlotNum];
+} ring_oram_metadata_t;
+
+static_assert(sizeof(ring_oram_metadata_t) <= DEFAULT_ORAM_DATA_SIZE,
+              "The metadata of a bucket must fit into one block.");
+
+// This class is the implementation of the ORAM controller for Ring ORAM (Ren
+// et al., USENIX Security '15). Each bucket holds Z real slots, S dummy slots
+// and one metadata slot on a TreeOramServerStorage. An access reads only one
+// slot per bucket on the path; a path is evicted on a reverse-lexicographic
+// schedule every A accesses, and a bucket is reshuffled early once it has been
+// read S times.
+class RingOramController : public OramController {
+  // ORAM parameters.
+  uint32_t tree_level_;
+  uint32_t number_of_leafs_;
+  // Z.
+  uint32_t bucket_size_;
+  // S.
+  uint32_t dummy_num_;
+  // A.
+  uint32_t evict_rate_;
+  // The number of accesses performed so far.
+  uint32_t access_counter_;
+  // The number of paths evicted so far, i.e., G in the paper.
+  uint32_t evict_counter_;
+  // stash size.
+  size_t stash_size_;
+
+  p_oram_position_t position_map_;
+  p_oram_stash_t stash_;
+  // Networking time.
+  std::chrono::microseconds network_time_;
+  // Networking communication.
+  size_t network_communication_;
+
+  // ==================== Begin private methods ==================== //
+  uint32_t SlotNum(void) const { return bucket_size_ + dummy_num_; }
+  OramStatus ReadSlots(uint32_t path,
+                       const std::vector<std::vector<uint32_t>>& slots,
+                       p_oram_path_t* const out_path);
+  OramStatus WriteSlots(uint32_t path,
+                        const std::vector<std::vector<uint32_t>>& slots,
+                        const p_oram_path_t& in_path);
+  OramStatus WriteFullPath(uint32_t path, const p_oram_path_t& in_path);
+  OramStatus ReadMetadata(uint32_t path,
+                          std::vector<ring_oram_metadata_t>* const metadata);
+  // Reads Z valid slots (all valid real blocks, padded by valid dummies) of
+  // the buckets on P(path) whose `levels` flag is set into the stash.
+  OramStatus ReadValidSlots(uint32_t path,
+                            const std::vector<ring_oram_metadata_t>& metadata,
+                            const std::vector<bool>& levels);
+  // Pads the real blocks with dummies to Z + S slots, permutes them and
+  // appends the fresh metadata.
+  p_oram_bucket_t BuildBucket(const p_oram_bucket_t& real_blocks);
+
+  OramStatus EvictPath(void);
+  OramStatus EarlyReshuffle(uint32_t path,
+                            const std::vector<ring_oram_metadata_t>& metadata);
+
+  // Greedily assigns at most Z stash blocks to each bucket on P(current_path)
+  // from the leaf to the root and removes them from the stash.
+  p_oram_path_t FindSubsetOf(uint32_t current_path);
+  // ==================== End private methods ==================== //
+ protected:
+  virtual OramStatus InternalAccess(Operation op_type, uint32_t address,
+                                    oram_block_t* const data,
+                                    bool dummy = false) override;
+  // Puts all the blocks into the stash with one dummy access.
+  virtual OramStatus InternalEvict(std::vector<oram_block_t>& blocks) override;
+
+ public:
+  RingOramController(uint32_t id, uint32_t block_num, uint32_t bucket_size,
+                     bool standalone = true,
+                     uint32_t dummy_num = kRingDefaultDummyNum,
+                     uint32_t evict_rate = kRingDefaultEvictRate);
+
+  virtual OramStatus InitOram(void) override;
+  virtual OramStatus FillWithData(
+      const std::vector<oram_block_t>& data) override;
+  virtual uint32_t RandomPosition(void) override;
+
+  uint32_t GetTreeLevel(void) const { return tree_level_; }
+  virtual size_t GetDataSize(void) const override {
+    return (POW2(tree_level_ + 1) - 1) * bucket_size_;
+  }
+  virtual size_t ReportClientStorage(void) const override;
+  size_t ReportStashSize(void) const { return stash_size_; }
+  virtual size_t ReportNetworkCommunication(void) const override;
+  virtual std::chrono::microseconds ReportNetworkingTime(
+      void) const override {
+    return network_time_;
+  }
+};
+}  // namespace oram_impl
+
+#endif  // ORAM_IMPL_CORE_RING_ORAM_CONTROLLER_H_
@@ -51,7 +51,7 @@ static std::vector<uint32_t> CreateVec(size_t size) {
 void SquareRootOramController::UpdatePosition(
     const std::vector<uint32_t>& perm) {
   for (size_t i = 0; i < perm.size(); i++) {
-    if (position_map_.find(i) == position_map_.end()) {
+    if (position_map_.count(i) == 0) {
       // Initial state.
       // The element with index i is placed on index perm[i].
       position_map_[i] = perm[i];
@@ -88,12 +88,6 @@ OramStatus SquareRootOramController::FillWithData(
   // Pad the data size to m + \sqrt{m}. This is a must.
   std::vector<oram_block_t> padded_data = Padded(data, block_num_ + sqrt_m_);
 
-  grpc::ClientContext context;
-  LoadSqrtOramRequest request;
-  google::protobuf::Empty response;
-
-  ASSEMBLE_HEADER(request, id_, instance_hash_, GetVersion());
-
   // Get the permutation vector.
   std::vector<uint32_t> perm = std::move(CreateVec(padded_data.size()));
   oram_crypto::RandomPermutation(perm);
@@ -109,26 +103,26 @@ OramStatus SquareRootOramController::FillWithData(
 
   // Randomly permute the contents of locations 1 through m + \sqrt{m}. That is,
   // select a permutation π over the integers 1 through m + \sqrt{m} and
-  // relocate the contents of word i into word pi(i).
-  for (size_t i = 0; i < padded_data.size(); i++) {
-    // Load the Square Root ORAM with permutation.
-    oram_block_t block = padded_data[i];
-
-    DBG(logger, "Perm: {}, {}; visiting block {}", i, perm[i],
-        block.header.block_id);
-
-    std::string block_str;
-    oram_utils::EncryptBlock(&block, cryptor_.get());
-    oram_utils::ConvertToString(&block, &block_str);
+  // relocate the contents of word i into word pi(i). The permuted blocks are
+  // streamed to the server in chunks.
+  size_t i = 0;
+  OramStatus status = BulkLoad([&](BulkLoadRequest* const chunk,
+                                   bool* const done) {
+    for (size_t chunk_size = 0;
+         i < padded_data.size() && chunk_size < kBulkLoadChunkSize; i++) {
+      // Load the Square Root ORAM with permutation.
+      DBG(logger, "Perm: {}, {}; visiting block {}", i, perm[i],
+          padded_data[i].header.block_id);
+
+      chunk_size += AppendToChunk(padded_data[i], chunk);
+    }
 
-    // Add to request.
-    request.add_contents(block_str);
-  }
+    *done = i == padded_data.size();
+    return OramStatus::OK;
+  });
 
-  grpc::Status status = stub_->LoadSqrtOram(&context, request, &response);
   if (!status.ok()) {
-    return OramStatus(StatusCode::kServerError, status.error_message(),
-                      __func__);
+    return status;
   }
 
   is_initialized_ = true;
@@ -253,6 +247,7 @@ SquareRootOramController::SquareRootOramController(uint32_t id, bool standalone,
     : OramController(id, standalone, block_num, OramType::kSquareOram),
       sqrt_m_((size_t)std::ceil(std::sqrt(block_num))),
       next_dummy_(0ul),
+      position_map_(block_num + sqrt_m_, block_num + sqrt_m_ - 1),
       counter_(0ul) {
   // Check if the input is valid according to the current implementation of FPE.
   PANIC_IF(
@@ -360,7 +355,7 @@ OramStatus SquareRootOramController::InternalAccess(Operation op_type,
   // A full read-write operation is regarded as an atomic operation here.
 
   // Check the position map.
-  if (position_map_.find(address) == position_map_.end()) {
+  if (position_map_.count(address) == 0) {
     return OramStatus(StatusCode::kInvalidArgument,
                       "The requested block does not exist!", __func__);
   }
@@ -0,0 +1,59 @@
+#!/bin/bash
+# Copyright (c) 2022 Haobin Chen
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation, either version 3 of the License, or
+# (at your option) any later version.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+# Runs the Partition ORAM with its partitions spread over several local server
+# processes. Usage: ./multi_server.sh [server number] [block number]
+
+MAGENTA='\033[1;35m'
+NC='\033[0m' # No Color
+
+server_num=${1:-4};
+block=${2:-4096};
+base_port=1234;
+
+# Check if the environment variable is set.
+if [[ -z ${https_proxy} ]]; then
+    echo "Unsetting the proxy.";
+    unset ${https_proxy};
+fi
+
+printf "${MAGENTA}[+] Starting ${server_num} servers...${NC}\n";
+
+endpoints="";
+server_pids=();
+for ((i=0; i<${server_num}; i++)); do
+    port=$((${base_port} + ${i}));
+    ./bin/server --server_port=${port} --log_level=2 > "./log-server-${port}.log" &
+    server_pids+=($!);
+
+    if [[ -n ${endpoints} ]]; then
+        endpoints="${endpoints},";
+    fi
+    endpoints="${endpoints}localhost:${port}";
+done
+
+# Wait for the servers to start.
+sleep 1;
+
+printf "${MAGENTA}    Testing block number: ${block} on ${endpoints}...${NC}\n";
+./bin/client --oram_type=PartitionOram --block_num=${block} \
+    --server_endpoints=${endpoints} --log_level=2 > ./log-client.log;
+
+for pid in "${server_pids[@]}"; do
+    kill ${pid};
+done
+
+printf "${MAGENTA}[+] Successfully tested the Partition ORAM. Goodbye.${NC}\n";
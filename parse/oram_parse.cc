@@ -36,6 +36,14 @@ ABSL_FLAG(std::string, key_path, "./key/server.key",
 ABSL_FLAG(bool, enable_proxy, false, "Should we enable proxy or not.");
 ABSL_FLAG(std::string, proxy_address, "", "The address of the proxy server.");
 ABSL_FLAG(uint32_t, proxy_port, 0, "The port of the proxy server.");
+ABSL_FLAG(std::vector<std::string>, server_endpoints, {},
+          "The servers (address:port, comma-separated) that the partitions of "
+          "Partition ORAM are spread over.");
+ABSL_FLAG(std::string, storage_path, "",
+          "The directory of the file-backed tree storages of the server.");
+ABSL_FLAG(bool, direct_io, false,
+          "Whether the tree storages are accessed with direct I/O instead of "
+          "being mapped.");
 
 ABSL_FLAG(std::string, oram_type, "PathOram",
           "The type of the ORAM controller.");
@@ -43,6 +51,44 @@ ABSL_FLAG(uint32_t, id, 0, "The ID for the current ORAM controller.");
 ABSL_FLAG(uint32_t, block_num, 1e5, "The number of the block.");
 ABSL_FLAG(uint32_t, bucket_size, 4,
           "The size of each bucket. (Z in Path ORAM)");
+ABSL_FLAG(uint32_t, recursion_level, 0,
+          "The number of levels of the recursive position map of Path ORAM.");
+ABSL_FLAG(uint32_t, plb_size, 64,
+          "The number of position-map blocks cached in the PLB.");
+ABSL_FLAG(uint32_t, treetop_level, 0,
+          "The number of top levels of the tree cached on the client.");
+ABSL_FLAG(uint32_t, init_thread_num, 0,
+          "The number of threads initializing the partitions (0 means one per "
+          "hardware thread).");
+ABSL_FLAG(uint32_t, evict_thread_num, 0,
+          "The number of threads evicting from the slots of Partition ORAM (0 "
+          "means one per hardware thread).");
+ABSL_FLAG(bool, background_evict, false,
+          "Should Partition ORAM evict in the background or not.");
+ABSL_FLAG(uint32_t, evict_backlog, 1024,
+          "The number of evictions Partition ORAM may queue in the "
+          "background.");
+ABSL_FLAG(uint32_t, evict_block_num, 1,
+          "The number of blocks each eviction of Partition ORAM moves from a "
+          "slot.");
+ABSL_FLAG(bool, piggyback_evict, false,
+          "Should each access of Partition ORAM evict from the slot it reads "
+          "or not.");
+ABSL_FLAG(std::string, evict_type, "Random",
+          "The eviction policy of Partition ORAM (Sequential or Random).");
+ABSL_FLAG(uint32_t, nu, 2, "The eviction rate of Partition ORAM.");
+ABSL_FLAG(bool, adaptive_evict, false,
+          "Should Partition ORAM adapt its eviction rate to the slots or not. "
+          "Leaks up to log2(3) bits per period about the access locality.");
+ABSL_FLAG(uint32_t, nu_min, 1, "The minimum adaptive eviction rate.");
+ABSL_FLAG(uint32_t, nu_max, 4, "The maximum adaptive eviction rate.");
+ABSL_FLAG(uint32_t, adapt_period, 256,
+          "The number of accesses between two changes of the eviction rate.");
+ABSL_FLAG(std::string, sub_oram_type, "PathOram",
+          "The ORAM behind each partition of Partition ORAM (PathOram or "
+          "RingOram).");
+ABSL_FLAG(uint32_t, channel_num, 4,
+          "The number of channels to the server for the asynchronous RPCs.");
 
 ABSL_FLAG(uint32_t, odict_size, 1e5, "The size of the oblivious dictionary.");
 ABSL_FLAG(uint32_t, client_cache_size, 32, "The size of the client cache.");
@@ -99,6 +145,62 @@ oram_impl::OramStatus YamlParser::DoParse(const YAML::const_iterator& cur_iter,
     return oram_utils::TryExec(
         [&]() { config.bucket_size = cur_iter->second.as<size_t>(); });
 
+  } else if (key == "RecursionLevel") {
+    return oram_utils::TryExec(
+        [&]() { config.recursion_level = cur_iter->second.as<uint32_t>(); });
+  } else if (key == "PlbSize") {
+    return oram_utils::TryExec(
+        [&]() { config.plb_size = cur_iter->second.as<size_t>(); });
+  } else if (key == "TreetopLevel") {
+    return oram_utils::TryExec(
+        [&]() { config.treetop_level = cur_iter->second.as<uint32_t>(); });
+  } else if (key == "InitThreadNum") {
+    return oram_utils::TryExec(
+        [&]() { config.init_thread_num = cur_iter->second.as<size_t>(); });
+  } else if (key == "EvictThreadNum") {
+    return oram_utils::TryExec(
+        [&]() { config.evict_thread_num = cur_iter->second.as<size_t>(); });
+  } else if (key == "BackgroundEvict") {
+    return oram_utils::TryExec(
+        [&]() { config.background_evict = cur_iter->second.as<bool>(); });
+  } else if (key == "EvictBacklog") {
+    return oram_utils::TryExec(
+        [&]() { config.evict_backlog = cur_iter->second.as<size_t>(); });
+  } else if (key == "EvictBlockNum") {
+    return oram_utils::TryExec(
+        [&]() { config.evict_block_num = cur_iter->second.as<size_t>(); });
+  } else if (key == "PiggybackEvict") {
+    return oram_utils::TryExec(
+        [&]() { config.piggyback_evict = cur_iter->second.as<bool>(); });
+  } else if (key == "EvictType") {
+    return oram_utils::TryExec([&]() {
+      config.evict_type =
+          oram_utils::StrToEvictType(cur_iter->second.as<std::string>());
+    });
+  } else if (key == "Nu") {
+    return oram_utils::TryExec(
+        [&]() { config.nu = cur_iter->second.as<size_t>(); });
+  } else if (key == "AdaptiveEvict") {
+    return oram_utils::TryExec(
+        [&]() { config.adaptive_evict = cur_iter->second.as<bool>(); });
+  } else if (key == "NuMin") {
+    return oram_utils::TryExec(
+        [&]() { config.nu_min = cur_iter->second.as<size_t>(); });
+  } else if (key == "NuMax") {
+    return oram_utils::TryExec(
+        [&]() { config.nu_max = cur_iter->second.as<size_t>(); });
+  } else if (key == "AdaptPeriod") {
+    return oram_utils::TryExec(
+        [&]() { config.adapt_period = cur_iter->second.as<size_t>(); });
+  } else if (key == "SubOramType") {
+    return oram_utils::TryExec([&]() {
+      config.sub_oram_type =
+          oram_utils::StrToType(cur_iter->second.as<std::string>());
+    });
+  } else if (key == "ChannelNum") {
+    return oram_utils::TryExec(
+        [&]() { config.channel_num = cur_iter->second.as<size_t>(); });
+
   } else if (key == "Id") {
     return oram_utils::TryExec(
         [&]() { config.crt_path = cur_iter->second.as<uint32_t>(); });
@@ -131,6 +233,20 @@ oram_impl::OramStatus YamlParser::DoParse(const YAML::const_iterator& cur_iter,
     return oram_utils::TryExec(
         [&]() { config.proxy_port = cur_iter->second.as<uint32_t>(); });
 
+  } else if (key == "ServerEndpoints") {
+    return oram_utils::TryExec([&]() {
+      config.server_endpoints =
+          cur_iter->second.as<std::vector<std::string>>();
+    });
+
+  } else if (key == "StoragePath") {
+    return oram_utils::TryExec(
+        [&]() { config.storage_path = cur_iter->second.as<std::string>(); });
+
+  } else if (key == "DirectIo") {
+    return oram_utils::TryExec(
+        [&]() { config.direct_io = cur_iter->second.as<bool>(); });
+
   } else if (key == "LogLevel") {
     return oram_utils::TryExec([&]() {
       std::string log_level = cur_iter->second.as<std::string>();
@@ -173,6 +289,25 @@ oram_impl::OramStatus YamlParser::DoCommandLine(oram_impl::OramConfig& config) {
   config.block_num = absl::GetFlag(FLAGS_block_num);
   config.bucket_size = absl::GetFlag(FLAGS_bucket_size);
   config.id = absl::GetFlag(FLAGS_id);
+  config.recursion_level = absl::GetFlag(FLAGS_recursion_level);
+  config.plb_size = absl::GetFlag(FLAGS_plb_size);
+  config.treetop_level = absl::GetFlag(FLAGS_treetop_level);
+  config.init_thread_num = absl::GetFlag(FLAGS_init_thread_num);
+  config.evict_thread_num = absl::GetFlag(FLAGS_evict_thread_num);
+  config.background_evict = absl::GetFlag(FLAGS_background_evict);
+  config.evict_backlog = absl::GetFlag(FLAGS_evict_backlog);
+  config.evict_block_num = absl::GetFlag(FLAGS_evict_block_num);
+  config.piggyback_evict = absl::GetFlag(FLAGS_piggyback_evict);
+  config.evict_type =
+      oram_utils::StrToEvictType(absl::GetFlag(FLAGS_evict_type));
+  config.nu = absl::GetFlag(FLAGS_nu);
+  config.adaptive_evict = absl::GetFlag(FLAGS_adaptive_evict);
+  config.nu_min = absl::GetFlag(FLAGS_nu_min);
+  config.nu_max = absl::GetFlag(FLAGS_nu_max);
+  config.adapt_period = absl::GetFlag(FLAGS_adapt_period);
+  config.sub_oram_type =
+      oram_utils::StrToType(absl::GetFlag(FLAGS_sub_oram_type));
+  config.channel_num = absl::GetFlag(FLAGS_channel_num);
   config.crt_path = absl::GetFlag(FLAGS_crt_path);
   config.key_path = absl::GetFlag(FLAGS_key_path);
   config.server_address = absl::GetFlag(FLAGS_server_address);
@@ -180,6 +315,9 @@ oram_impl::OramStatus YamlParser::DoCommandLine(oram_impl::OramConfig& config) {
   config.enable_proxy = absl::GetFlag(FLAGS_enable_proxy);
   config.proxy_address = absl::GetFlag(FLAGS_proxy_address);
   config.proxy_port = absl::GetFlag(FLAGS_proxy_port);
+  config.server_endpoints = absl::GetFlag(FLAGS_server_endpoints);
+  config.storage_path = absl::GetFlag(FLAGS_storage_path);
+  config.direct_io = absl::GetFlag(FLAGS_direct_io);
   config.log_level = absl::GetFlag(FLAGS_log_level);
   config.log_frequency = absl::GetFlag(FLAGS_log_frequency);
   config.odict_size = absl::GetFlag(FLAGS_odict_size);
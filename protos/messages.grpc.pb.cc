@@ -26,9 +26,14 @@ static const char* oram_server_method_names[] = {
   "/oram_impl.oram_server/InitFlatOram",
   "/oram_impl.oram_server/InitSqrtOram",
   "/oram_impl.oram_server/LoadSqrtOram",
+  "/oram_impl.oram_server/BulkLoad",
   "/oram_impl.oram_server/PrintOramTree",
   "/oram_impl.oram_server/ReadPath",
   "/oram_impl.oram_server/WritePath",
+  "/oram_impl.oram_server/ReadFullPath",
+  "/oram_impl.oram_server/WriteFullPath",
+  "/oram_impl.oram_server/ReadSlots",
+  "/oram_impl.oram_server/WriteSlots",
   "/oram_impl.oram_server/ReadFlatMemory",
   "/oram_impl.oram_server/WriteFlatMemory",
   "/oram_impl.oram_server/ReadSqrtMemory",
@@ -52,19 +57,24 @@ oram_server::Stub::Stub(const std::shared_ptr< ::grpc::ChannelInterface>& channe
   , rpcmethod_InitFlatOram_(oram_server_method_names[1], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
   , rpcmethod_InitSqrtOram_(oram_server_method_names[2], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
   , rpcmethod_LoadSqrtOram_(oram_server_method_names[3], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
-  , rpcmethod_PrintOramTree_(oram_server_method_names[4], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
-  , rpcmethod_ReadPath_(oram_server_method_names[5], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
-  , rpcmethod_WritePath_(oram_server_method_names[6], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
-  , rpcmethod_ReadFlatMemory_(oram_server_method_names[7], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
-  , rpcmethod_WriteFlatMemory_(oram_server_method_names[8], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
-  , rpcmethod_ReadSqrtMemory_(oram_server_method_names[9], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
-  , rpcmethod_WriteSqrtMemory_(oram_server_method_names[10], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
-  , rpcmethod_SqrtPermute_(oram_server_method_names[11], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
-  , rpcmethod_CloseConnection_(oram_server_method_names[12], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
-  , rpcmethod_KeyExchange_(oram_server_method_names[13], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
-  , rpcmethod_SendHello_(oram_server_method_names[14], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
-  , rpcmethod_ReportServerInformation_(oram_server_method_names[15], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
-  , rpcmethod_ResetServer_(oram_server_method_names[16], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_BulkLoad_(oram_server_method_names[4], options.suffix_for_stats(),::grpc::internal::RpcMethod::CLIENT_STREAMING, channel)
+  , rpcmethod_PrintOramTree_(oram_server_method_names[5], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_ReadPath_(oram_server_method_names[6], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_WritePath_(oram_server_method_names[7], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_ReadFullPath_(oram_server_method_names[8], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_WriteFullPath_(oram_server_method_names[9], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_ReadSlots_(oram_server_method_names[10], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_WriteSlots_(oram_server_method_names[11], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_ReadFlatMemory_(oram_server_method_names[12], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_WriteFlatMemory_(oram_server_method_names[13], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_ReadSqrtMemory_(oram_server_method_names[14], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_WriteSqrtMemory_(oram_server_method_names[15], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_SqrtPermute_(oram_server_method_names[16], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_CloseConnection_(oram_server_method_names[17], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_KeyExchange_(oram_server_method_names[18], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_SendHello_(oram_server_method_names[19], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_ReportServerInformation_(oram_server_method_names[20], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_ResetServer_(oram_server_method_names[21], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
   {}
 
 ::grpc::Status oram_server::Stub::InitTreeOram(::grpc::ClientContext* context, const ::oram_impl::InitTreeOramRequest& request, ::google::protobuf::Empty* response) {
@@ -159,6 +169,22 @@ void oram_server::Stub::async::LoadSqrtOram(::grpc::ClientContext* context, cons
   return result;
 }
 
+::grpc::ClientWriter< ::oram_impl::BulkLoadRequest>* oram_server::Stub::BulkLoadRaw(::grpc::ClientContext* context, ::google::protobuf::Empty* response) {
+  return ::grpc::internal::ClientWriterFactory< ::oram_impl::BulkLoadRequest>::Create(channel_.get(), rpcmethod_BulkLoad_, context, response);
+}
+
+void oram_server::Stub::async::BulkLoad(::grpc::ClientContext* context, ::google::protobuf::Empty* response, ::grpc::ClientWriteReactor< ::oram_impl::BulkLoadRequest>* reactor) {
+  ::grpc::internal::ClientCallbackWriterFactory< ::oram_impl::BulkLoadRequest>::Create(stub_->channel_.get(), stub_->rpcmethod_BulkLoad_, context, response, reactor);
+}
+
+::grpc::ClientAsyncWriter< ::oram_impl::BulkLoadRequest>* oram_server::Stub::AsyncBulkLoadRaw(::grpc::ClientContext* context, ::google::protobuf::Empty* response, ::grpc::CompletionQueue* cq, void* tag) {
+  return ::grpc::internal::ClientAsyncWriterFactory< ::oram_impl::BulkLoadRequest>::Create(channel_.get(), cq, rpcmethod_BulkLoad_, context, response, true, tag);
+}
+
+::grpc::ClientAsyncWriter< ::oram_impl::BulkLoadRequest>* oram_server::Stub::PrepareAsyncBulkLoadRaw(::grpc::ClientContext* context, ::google::protobuf::Empty* response, ::grpc::CompletionQueue* cq) {
+  return ::grpc::internal::ClientAsyncWriterFactory< ::oram_impl::BulkLoadRequest>::Create(channel_.get(), cq, rpcmethod_BulkLoad_, context, response, false, nullptr);
+}
+
 ::grpc::Status oram_server::Stub::PrintOramTree(::grpc::ClientContext* context, const ::oram_impl::PrintOramTreeRequest& request, ::google::protobuf::Empty* response) {
   return ::grpc::internal::BlockingUnaryCall< ::oram_impl::PrintOramTreeRequest, ::google::protobuf::Empty, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), rpcmethod_PrintOramTree_, context, request, response);
 }
@@ -228,6 +254,98 @@ void oram_server::Stub::async::WritePath(::grpc::ClientContext* context, const :
   return result;
 }
 
+::grpc::Status oram_server::Stub::ReadFullPath(::grpc::ClientContext* context, const ::oram_impl::ReadFullPathRequest& request, ::oram_impl::ReadFullPathResponse* response) {
+  return ::grpc::internal::BlockingUnaryCall< ::oram_impl::ReadFullPathRequest, ::oram_impl::ReadFullPathResponse, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), rpcmethod_ReadFullPath_, context, request, response);
+}
+
+void oram_server::Stub::async::ReadFullPath(::grpc::ClientContext* context, const ::oram_impl::ReadFullPathRequest* request, ::oram_impl::ReadFullPathResponse* response, std::function<void(::grpc::Status)> f) {
+  ::grpc::internal::CallbackUnaryCall< ::oram_impl::ReadFullPathRequest, ::oram_impl::ReadFullPathResponse, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_ReadFullPath_, context, request, response, std::move(f));
+}
+
+void oram_server::Stub::async::ReadFullPath(::grpc::ClientContext* context, const ::oram_impl::ReadFullPathRequest* request, ::oram_impl::ReadFullPathResponse* response, ::grpc::ClientUnaryReactor* reactor) {
+  ::grpc::internal::ClientCallbackUnaryFactory::Create< ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_ReadFullPath_, context, request, response, reactor);
+}
+
+::grpc::ClientAsyncResponseReader< ::oram_impl::ReadFullPathResponse>* oram_server::Stub::PrepareAsyncReadFullPathRaw(::grpc::ClientContext* context, const ::oram_impl::ReadFullPathRequest& request, ::grpc::CompletionQueue* cq) {
+  return ::grpc::internal::ClientAsyncResponseReaderHelper::Create< ::oram_impl::ReadFullPathResponse, ::oram_impl::ReadFullPathRequest, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), cq, rpcmethod_ReadFullPath_, context, request);
+}
+
+::grpc::ClientAsyncResponseReader< ::oram_impl::ReadFullPathResponse>* oram_server::Stub::AsyncReadFullPathRaw(::grpc::ClientContext* context, const ::oram_impl::ReadFullPathRequest& request, ::grpc::CompletionQueue* cq) {
+  auto* result =
+    this->PrepareAsyncReadFullPathRaw(context, request, cq);
+  result->StartCall();
+  return result;
+}
+
+::grpc::Status oram_server::Stub::WriteFullPath(::grpc::ClientContext* context, const ::oram_impl::WriteFullPathRequest& request, ::oram_impl::WritePathResponse* response) {
+  return ::grpc::internal::BlockingUnaryCall< ::oram_impl::WriteFullPathRequest, ::oram_impl::WritePathResponse, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), rpcmethod_WriteFullPath_, context, request, response);
+}
+
+void oram_server::Stub::async::WriteFullPath(::grpc::ClientContext* context, const ::oram_impl::WriteFullPathRequest* request, ::oram_impl::WritePathResponse* response, std::function<void(::grpc::Status)> f) {
+  ::grpc::internal::CallbackUnaryCall< ::oram_impl::WriteFullPathRequest, ::oram_impl::WritePathResponse, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_WriteFullPath_, context, request, response, std::move(f));
+}
+
+void oram_server::Stub::async::WriteFullPath(::grpc::ClientContext* context, const ::oram_impl::WriteFullPathRequest* request, ::oram_impl::WritePathResponse* response, ::grpc::ClientUnaryReactor* reactor) {
+  ::grpc::internal::ClientCallbackUnaryFactory::Create< ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_WriteFullPath_, context, request, response, reactor);
+}
+
+::grpc::ClientAsyncResponseReader< ::oram_impl::WritePathResponse>* oram_server::Stub::PrepareAsyncWriteFullPathRaw(::grpc::ClientContext* context, const ::oram_impl::WriteFullPathRequest& request, ::grpc::CompletionQueue* cq) {
+  return ::grpc::internal::ClientAsyncResponseReaderHelper::Create< ::oram_impl::WritePathResponse, ::oram_impl::WriteFullPathRequest, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), cq, rpcmethod_WriteFullPath_, context, request);
+}
+
+::grpc::ClientAsyncResponseReader< ::oram_impl::WritePathResponse>* oram_server::Stub::AsyncWriteFullPathRaw(::grpc::ClientContext* context, const ::oram_impl::WriteFullPathRequest& request, ::grpc::CompletionQueue* cq) {
+  auto* result =
+    this->PrepareAsyncWriteFullPathRaw(context, request, cq);
+  result->StartCall();
+  return result;
+}
+
+::grpc::Status oram_server::Stub::ReadSlots(::grpc::ClientContext* context, const ::oram_impl::ReadSlotsRequest& request, ::oram_impl::ReadFullPathResponse* response) {
+  return ::grpc::internal::BlockingUnaryCall< ::oram_impl::ReadSlotsRequest, ::oram_impl::ReadFullPathResponse, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), rpcmethod_ReadSlots_, context, request, response);
+}
+
+void oram_server::Stub::async::ReadSlots(::grpc::ClientContext* context, const ::oram_impl::ReadSlotsRequest* request, ::oram_impl::ReadFullPathResponse* response, std::function<void(::grpc::Status)> f) {
+  ::grpc::internal::CallbackUnaryCall< ::oram_impl::ReadSlotsRequest, ::oram_impl::ReadFullPathResponse, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_ReadSlots_, context, request, response, std::move(f));
+}
+
+void oram_server::Stub::async::ReadSlots(::grpc::ClientContext* context, const ::oram_impl::ReadSlotsRequest* request, ::oram_impl::ReadFullPathResponse* response, ::grpc::ClientUnaryReactor* reactor) {
+  ::grpc::internal::ClientCallbackUnaryFactory::Create< ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_ReadSlots_, context, request, response, reactor);
+}
+
+::grpc::ClientAsyncResponseReader< ::oram_impl::ReadFullPathResponse>* oram_server::Stub::PrepareAsyncReadSlotsRaw(::grpc::ClientContext* context, const ::oram_impl::ReadSlotsRequest& request, ::grpc::CompletionQueue* cq) {
+  return ::grpc::internal::ClientAsyncResponseReaderHelper::Create< ::oram_impl::ReadFullPathResponse, ::oram_impl::ReadSlotsRequest, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), cq, rpcmethod_ReadSlots_, context, request);
+}
+
+::grpc::ClientAsyncResponseReader< ::oram_impl::ReadFullPathResponse>* oram_server::Stub::AsyncReadSlotsRaw(::grpc::ClientContext* context, const ::oram_impl::ReadSlotsRequest& request, ::grpc::CompletionQueue* cq) {
+  auto* result =
+    this->PrepareAsyncReadSlotsRaw(context, request, cq);
+  result->StartCall();
+  return result;
+}
+
+::grpc::Status oram_server::Stub::WriteSlots(::grpc::ClientContext* context, const ::oram_impl::WriteSlotsRequest& request, ::oram_impl::WritePathResponse* response) {
+  return ::grpc::internal::BlockingUnaryCall< ::oram_impl::WriteSlotsRequest, ::oram_impl::WritePathResponse, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), rpcmethod_WriteSlots_, context, request, response);
+}
+
+void oram_server::Stub::async::WriteSlots(::grpc::ClientContext* context, const ::oram_impl::WriteSlotsRequest* request, ::oram_impl::WritePathResponse* response, std::function<void(::grpc::Status)> f) {
+  ::grpc::internal::CallbackUnaryCall< ::oram_impl::WriteSlotsRequest, ::oram_impl::WritePathResponse, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_WriteSlots_, context, request, response, std::move(f));
+}
+
+void oram_server::Stub::async::WriteSlots(::grpc::ClientContext* context, const ::oram_impl::WriteSlotsRequest* request, ::oram_impl::WritePathResponse* response, ::grpc::ClientUnaryReactor* reactor) {
+  ::grpc::internal::ClientCallbackUnaryFactory::Create< ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_WriteSlots_, context, request, response, reactor);
+}
+
+::grpc::ClientAsyncResponseReader< ::oram_impl::WritePathResponse>* oram_server::Stub::PrepareAsyncWriteSlotsRaw(::grpc::ClientContext* context, const ::oram_impl::WriteSlotsRequest& request, ::grpc::CompletionQueue* cq) {
+  return ::grpc::internal::ClientAsyncResponseReaderHelper::Create< ::oram_impl::WritePathResponse, ::oram_impl::WriteSlotsRequest, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), cq, rpcmethod_WriteSlots_, context, request);
+}
+
+::grpc::ClientAsyncResponseReader< ::oram_impl::WritePathResponse>* oram_server::Stub::AsyncWriteSlotsRaw(::grpc::ClientContext* context, const ::oram_impl::WriteSlotsRequest& request, ::grpc::CompletionQueue* cq) {
+  auto* result =
+    this->PrepareAsyncWriteSlotsRaw(context, request, cq);
+  result->StartCall();
+  return result;
+}
+
 ::grpc::Status oram_server::Stub::ReadFlatMemory(::grpc::ClientContext* context, const ::oram_impl::ReadFlatRequest& request, ::oram_impl::FlatVectorMessage* response) {
   return ::grpc::internal::BlockingUnaryCall< ::oram_impl::ReadFlatRequest, ::oram_impl::FlatVectorMessage, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), rpcmethod_ReadFlatMemory_, context, request, response);
 }
@@ -501,6 +619,16 @@ oram_server::Service::Service() {
              }, this)));
   AddMethod(new ::grpc::internal::RpcServiceMethod(
       oram_server_method_names[4],
+      ::grpc::internal::RpcMethod::CLIENT_STREAMING,
+      new ::grpc::internal::ClientStreamingHandler< oram_server::Service, ::oram_impl::BulkLoadRequest, ::google::protobuf::Empty>(
+          [](oram_server::Service* service,
+             ::grpc::ServerContext* ctx,
+             ::grpc::ServerReader<::oram_impl::BulkLoadRequest>* reader,
+             ::google::protobuf::Empty* resp) {
+               return service->BulkLoad(ctx, reader, resp);
+             }, this)));
+  AddMethod(new ::grpc::internal::RpcServiceMethod(
+      oram_server_method_names[5],
       ::grpc::internal::RpcMethod::NORMAL_RPC,
       new ::grpc::internal::RpcMethodHandler< oram_server::Service, ::oram_impl::PrintOramTreeRequest, ::google::protobuf::Empty, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
           [](oram_server::Service* service,
@@ -510,7 +638,7 @@ oram_server::Service::Service() {
                return service->PrintOramTree(ctx, req, resp);
              }, this)));
   AddMethod(new ::grpc::internal::RpcServiceMethod(
-      oram_server_method_names[5],
+      oram_server_method_names[6],
       ::grpc::internal::RpcMethod::NORMAL_RPC,
       new ::grpc::internal::RpcMethodHandler< oram_server::Service, ::oram_impl::ReadPathRequest, ::oram_impl::ReadPathResponse, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
           [](oram_server::Service* service,
@@ -520,7 +648,7 @@ oram_server::Service::Service() {
                return service->ReadPath(ctx, req, resp);
              }, this)));
   AddMethod(new ::grpc::internal::RpcServiceMethod(
-      oram_server_method_names[6],
+      oram_server_method_names[7],
       ::grpc::internal::RpcMethod::NORMAL_RPC,
       new ::grpc::internal::RpcMethodHandler< oram_server::Service, ::oram_impl::WritePathRequest, ::oram_impl::WritePathResponse, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
           [](oram_server::Service* service,
@@ -530,7 +658,47 @@ oram_server::Service::Service() {
                return service->WritePath(ctx, req, resp);
              }, this)));
   AddMethod(new ::grpc::internal::RpcServiceMethod(
-      oram_server_method_names[7],
+      oram_server_method_names[8],
+      ::grpc::internal::RpcMethod::NORMAL_RPC,
+      new ::grpc::internal::RpcMethodHandler< oram_server::Service, ::oram_impl::ReadFullPathRequest, ::oram_impl::ReadFullPathResponse, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
+          [](oram_server::Service* service,
+             ::grpc::ServerContext* ctx,
+             const ::oram_impl::ReadFullPathRequest* req,
+             ::oram_impl::ReadFullPathResponse* resp) {
+               return service->ReadFullPath(ctx, req, resp);
+             }, this)));
+  AddMethod(new ::grpc::internal::RpcServiceMethod(
+      oram_server_method_names[9],
+      ::grpc::internal::RpcMethod::NORMAL_RPC,
+      new ::grpc::internal::RpcMethodHandler< oram_server::Service, ::oram_impl::WriteFullPathRequest, ::oram_impl::WritePathResponse, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
+          [](oram_server::Service* service,
+             ::grpc::ServerContext* ctx,
+             const ::oram_impl::WriteFullPathRequest* req,
+             ::oram_impl::WritePathResponse* resp) {
+               return service->WriteFullPath(ctx, req, resp);
+             }, this)));
+  AddMethod(new ::grpc::internal::RpcServiceMethod(
+      oram_server_method_names[10],
+      ::grpc::internal::RpcMethod::NORMAL_RPC,
+      new ::grpc::internal::RpcMethodHandler< oram_server::Service, ::oram_impl::ReadSlotsRequest, ::oram_impl::ReadFullPathResponse, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
+          [](oram_server::Service* service,
+             ::grpc::ServerContext* ctx,
+             const ::oram_impl::ReadSlotsRequest* req,
+             ::oram_impl::ReadFullPathResponse* resp) {
+               return service->ReadSlots(ctx, req, resp);
+             }, this)));
+  AddMethod(new ::grpc::internal::RpcServiceMethod(
+      oram_server_method_names[11],
+      ::grpc::internal::RpcMethod::NORMAL_RPC,
+      new ::grpc::internal::RpcMethodHandler< oram_server::Service, ::oram_impl::WriteSlotsRequest, ::oram_impl::WritePathResponse, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
+          [](oram_server::Service* service,
+             ::grpc::ServerContext* ctx,
+             const ::oram_impl::WriteSlotsRequest* req,
+             ::oram_impl::WritePathResponse* resp) {
+               return service->WriteSlots(ctx, req, resp);
+             }, this)));
+  AddMethod(new ::grpc::internal::RpcServiceMethod(
+      oram_server_method_names[12],
       ::grpc::internal::RpcMethod::NORMAL_RPC,
       new ::grpc::internal::RpcMethodHandler< oram_server::Service, ::oram_impl::ReadFlatRequest, ::oram_impl::FlatVectorMessage, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
           [](oram_server::Service* service,
@@ -540,7 +708,7 @@ oram_server::Service::Service() {
                return service->ReadFlatMemory(ctx, req, resp);
              }, this)));
   AddMethod(new ::grpc::internal::RpcServiceMethod(
-      oram_server_method_names[8],
+      oram_server_method_names[13],
       ::grpc::internal::RpcMethod::NORMAL_RPC,
       new ::grpc::internal::RpcMethodHandler< oram_server::Service, ::oram_impl::FlatVectorMessage, ::google::protobuf::Empty, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
           [](oram_server::Service* service,
@@ -550,7 +718,7 @@ oram_server::Service::Service() {
                return service->WriteFlatMemory(ctx, req, resp);
              }, this)));
   AddMethod(new ::grpc::internal::RpcServiceMethod(
-      oram_server_method_names[9],
+      oram_server_method_names[14],
       ::grpc::internal::RpcMethod::NORMAL_RPC,
       new ::grpc::internal::RpcMethodHandler< oram_server::Service, ::oram_impl::ReadSqrtRequest, ::oram_impl::SqrtMessage, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
           [](oram_server::Service* service,
@@ -560,7 +728,7 @@ oram_server::Service::Service() {
                return service->ReadSqrtMemory(ctx, req, resp);
              }, this)));
   AddMethod(new ::grpc::internal::RpcServiceMethod(
-      oram_server_method_names[10],
+      oram_server_method_names[15],
       ::grpc::internal::RpcMethod::NORMAL_RPC,
       new ::grpc::internal::RpcMethodHandler< oram_server::Service, ::oram_impl::WriteSqrtMessage, ::google::protobuf::Empty, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
           [](oram_server::Service* service,
@@ -570,7 +738,7 @@ oram_server::Service::Service() {
                return service->WriteSqrtMemory(ctx, req, resp);
              }, this)));
   AddMethod(new ::grpc::internal::RpcServiceMethod(
-      oram_server_method_names[11],
+      oram_server_method_names[16],
       ::grpc::internal::RpcMethod::NORMAL_RPC,
       new ::grpc::internal::RpcMethodHandler< oram_server::Service, ::oram_impl::SqrtPermMessage, ::google::protobuf::Empty, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
           [](oram_server::Service* service,
@@ -580,7 +748,7 @@ oram_server::Service::Service() {
                return service->SqrtPermute(ctx, req, resp);
              }, this)));
   AddMethod(new ::grpc::internal::RpcServiceMethod(
-      oram_server_method_names[12],
+      oram_server_method_names[17],
       ::grpc::internal::RpcMethod::NORMAL_RPC,
       new ::grpc::internal::RpcMethodHandler< oram_server::Service, ::google::protobuf::Empty, ::google::protobuf::Empty, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
           [](oram_server::Service* service,
@@ -590,7 +758,7 @@ oram_server::Service::Service() {
                return service->CloseConnection(ctx, req, resp);
              }, this)));
   AddMethod(new ::grpc::internal::RpcServiceMethod(
-      oram_server_method_names[13],
+      oram_server_method_names[18],
       ::grpc::internal::RpcMethod::NORMAL_RPC,
       new ::grpc::internal::RpcMethodHandler< oram_server::Service, ::oram_impl::KeyExchangeRequest, ::oram_impl::KeyExchangeResponse, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
           [](oram_server::Service* service,
@@ -600,7 +768,7 @@ oram_server::Service::Service() {
                return service->KeyExchange(ctx, req, resp);
              }, this)));
   AddMethod(new ::grpc::internal::RpcServiceMethod(
-      oram_server_method_names[14],
+      oram_server_method_names[19],
       ::grpc::internal::RpcMethod::NORMAL_RPC,
       new ::grpc::internal::RpcMethodHandler< oram_server::Service, ::oram_impl::HelloMessage, ::google::protobuf::Empty, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
           [](oram_server::Service* service,
@@ -610,7 +778,7 @@ oram_server::Service::Service() {
                return service->SendHello(ctx, req, resp);
              }, this)));
   AddMethod(new ::grpc::internal::RpcServiceMethod(
-      oram_server_method_names[15],
+      oram_server_method_names[20],
       ::grpc::internal::RpcMethod::NORMAL_RPC,
       new ::grpc::internal::RpcMethodHandler< oram_server::Service, ::google::protobuf::Empty, ::google::protobuf::Empty, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
           [](oram_server::Service* service,
@@ -620,7 +788,7 @@ oram_server::Service::Service() {
                return service->ReportServerInformation(ctx, req, resp);
              }, this)));
   AddMethod(new ::grpc::internal::RpcServiceMethod(
-      oram_server_method_names[16],
+      oram_server_method_names[21],
       ::grpc::internal::RpcMethod::NORMAL_RPC,
       new ::grpc::internal::RpcMethodHandler< oram_server::Service, ::google::protobuf::Empty, ::google::protobuf::Empty, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
           [](oram_server::Service* service,
@@ -662,6 +830,13 @@ oram_server::Service::~Service() {
   return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
 }
 
+::grpc::Status oram_server::Service::BulkLoad(::grpc::ServerContext* context, ::grpc::ServerReader< ::oram_impl::BulkLoadRequest>* reader, ::google::protobuf::Empty* response) {
+  (void) context;
+  (void) reader;
+  (void) response;
+  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+}
+
 ::grpc::Status oram_server::Service::PrintOramTree(::grpc::ServerContext* context, const ::oram_impl::PrintOramTreeRequest* request, ::google::protobuf::Empty* response) {
   (void) context;
   (void) request;
@@ -683,6 +858,34 @@ oram_server::Service::~Service() {
   return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
 }
 
+::grpc::Status oram_server::Service::ReadFullPath(::grpc::ServerContext* context, const ::oram_impl::ReadFullPathRequest* request, ::oram_impl::ReadFullPathResponse* response) {
+  (void) context;
+  (void) request;
+  (void) response;
+  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+}
+
+::grpc::Status oram_server::Service::WriteFullPath(::grpc::ServerContext* context, const ::oram_impl::WriteFullPathRequest* request, ::oram_impl::WritePathResponse* response) {
+  (void) context;
+  (void) request;
+  (void) response;
+  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+}
+
+::grpc::Status oram_server::Service::ReadSlots(::grpc::ServerContext* context, const ::oram_impl::ReadSlotsRequest* request, ::oram_impl::ReadFullPathResponse* response) {
+  (void) context;
+  (void) request;
+  (void) response;
+  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+}
+
+::grpc::Status oram_server::Service::WriteSlots(::grpc::ServerContext* context, const ::oram_impl::WriteSlotsRequest* request, ::oram_impl::WritePathResponse* response) {
+  (void) context;
+  (void) request;
+  (void) response;
+  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+}
+
 ::grpc::Status oram_server::Service::ReadFlatMemory(::grpc::ServerContext* context, const ::oram_impl::ReadFlatRequest* request, ::oram_impl::FlatVectorMessage* response) {
   (void) context;
   (void) request;
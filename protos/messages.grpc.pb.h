@@ -66,6 +66,16 @@ class oram_server final {
     std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::google::protobuf::Empty>> PrepareAsyncLoadSqrtOram(::grpc::ClientContext* context, const ::oram_impl::LoadSqrtOramRequest& request, ::grpc::CompletionQueue* cq) {
       return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::google::protobuf::Empty>>(PrepareAsyncLoadSqrtOramRaw(context, request, cq));
     }
+    // Stream the initial contents of any ORAM storage in chunks.
+    std::unique_ptr< ::grpc::ClientWriterInterface< ::oram_impl::BulkLoadRequest>> BulkLoad(::grpc::ClientContext* context, ::google::protobuf::Empty* response) {
+      return std::unique_ptr< ::grpc::ClientWriterInterface< ::oram_impl::BulkLoadRequest>>(BulkLoadRaw(context, response));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncWriterInterface< ::oram_impl::BulkLoadRequest>> AsyncBulkLoad(::grpc::ClientContext* context, ::google::protobuf::Empty* response, ::grpc::CompletionQueue* cq, void* tag) {
+      return std::unique_ptr< ::grpc::ClientAsyncWriterInterface< ::oram_impl::BulkLoadRequest>>(AsyncBulkLoadRaw(context, response, cq, tag));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncWriterInterface< ::oram_impl::BulkLoadRequest>> PrepareAsyncBulkLoad(::grpc::ClientContext* context, ::google::protobuf::Empty* response, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncWriterInterface< ::oram_impl::BulkLoadRequest>>(PrepareAsyncBulkLoadRaw(context, response, cq));
+    }
     virtual ::grpc::Status PrintOramTree(::grpc::ClientContext* context, const ::oram_impl::PrintOramTreeRequest& request, ::google::protobuf::Empty* response) = 0;
     std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::google::protobuf::Empty>> AsyncPrintOramTree(::grpc::ClientContext* context, const ::oram_impl::PrintOramTreeRequest& request, ::grpc::CompletionQueue* cq) {
       return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::google::protobuf::Empty>>(AsyncPrintOramTreeRaw(context, request, cq));
@@ -87,6 +97,37 @@ class oram_server final {
     std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::oram_impl::WritePathResponse>> PrepareAsyncWritePath(::grpc::ClientContext* context, const ::oram_impl::WritePathRequest& request, ::grpc::CompletionQueue* cq) {
       return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::oram_impl::WritePathResponse>>(PrepareAsyncWritePathRaw(context, request, cq));
     }
+    // Read / write all the buckets on a path in a single round trip.
+    virtual ::grpc::Status ReadFullPath(::grpc::ClientContext* context, const ::oram_impl::ReadFullPathRequest& request, ::oram_impl::ReadFullPathResponse* response) = 0;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::oram_impl::ReadFullPathResponse>> AsyncReadFullPath(::grpc::ClientContext* context, const ::oram_impl::ReadFullPathRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::oram_impl::ReadFullPathResponse>>(AsyncReadFullPathRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::oram_impl::ReadFullPathResponse>> PrepareAsyncReadFullPath(::grpc::ClientContext* context, const ::oram_impl::ReadFullPathRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::oram_impl::ReadFullPathResponse>>(PrepareAsyncReadFullPathRaw(context, request, cq));
+    }
+    virtual ::grpc::Status WriteFullPath(::grpc::ClientContext* context, const ::oram_impl::WriteFullPathRequest& request, ::oram_impl::WritePathResponse* response) = 0;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::oram_impl::WritePathResponse>> AsyncWriteFullPath(::grpc::ClientContext* context, const ::oram_impl::WriteFullPathRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::oram_impl::WritePathResponse>>(AsyncWriteFullPathRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::oram_impl::WritePathResponse>> PrepareAsyncWriteFullPath(::grpc::ClientContext* context, const ::oram_impl::WriteFullPathRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::oram_impl::WritePathResponse>>(PrepareAsyncWriteFullPathRaw(context, request, cq));
+    }
+    // Read / overwrite individual slots of the buckets on a path without
+    // clearing the rest of the buckets (for Ring ORAM).
+    virtual ::grpc::Status ReadSlots(::grpc::ClientContext* context, const ::oram_impl::ReadSlotsRequest& request, ::oram_impl::ReadFullPathResponse* response) = 0;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::oram_impl::ReadFullPathResponse>> AsyncReadSlots(::grpc::ClientContext* context, const ::oram_impl::ReadSlotsRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::oram_impl::ReadFullPathResponse>>(AsyncReadSlotsRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::oram_impl::ReadFullPathResponse>> PrepareAsyncReadSlots(::grpc::ClientContext* context, const ::oram_impl::ReadSlotsRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::oram_impl::ReadFullPathResponse>>(PrepareAsyncReadSlotsRaw(context, request, cq));
+    }
+    virtual ::grpc::Status WriteSlots(::grpc::ClientContext* context, const ::oram_impl::WriteSlotsRequest& request, ::oram_impl::WritePathResponse* response) = 0;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::oram_impl::WritePathResponse>> AsyncWriteSlots(::grpc::ClientContext* context, const ::oram_impl::WriteSlotsRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::oram_impl::WritePathResponse>>(AsyncWriteSlotsRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::oram_impl::WritePathResponse>> PrepareAsyncWriteSlots(::grpc::ClientContext* context, const ::oram_impl::WriteSlotsRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::oram_impl::WritePathResponse>>(PrepareAsyncWriteSlotsRaw(context, request, cq));
+    }
     virtual ::grpc::Status ReadFlatMemory(::grpc::ClientContext* context, const ::oram_impl::ReadFlatRequest& request, ::oram_impl::FlatVectorMessage* response) = 0;
     std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::oram_impl::FlatVectorMessage>> AsyncReadFlatMemory(::grpc::ClientContext* context, const ::oram_impl::ReadFlatRequest& request, ::grpc::CompletionQueue* cq) {
       return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::oram_impl::FlatVectorMessage>>(AsyncReadFlatMemoryRaw(context, request, cq));
@@ -173,12 +214,25 @@ class oram_server final {
       virtual void InitSqrtOram(::grpc::ClientContext* context, const ::oram_impl::InitSqrtOramRequest* request, ::google::protobuf::Empty* response, ::grpc::ClientUnaryReactor* reactor) = 0;
       virtual void LoadSqrtOram(::grpc::ClientContext* context, const ::oram_impl::LoadSqrtOramRequest* request, ::google::protobuf::Empty* response, std::function<void(::grpc::Status)>) = 0;
       virtual void LoadSqrtOram(::grpc::ClientContext* context, const ::oram_impl::LoadSqrtOramRequest* request, ::google::protobuf::Empty* response, ::grpc::ClientUnaryReactor* reactor) = 0;
+      // Stream the initial contents of any ORAM storage in chunks.
+      virtual void BulkLoad(::grpc::ClientContext* context, ::google::protobuf::Empty* response, ::grpc::ClientWriteReactor< ::oram_impl::BulkLoadRequest>* reactor) = 0;
       virtual void PrintOramTree(::grpc::ClientContext* context, const ::oram_impl::PrintOramTreeRequest* request, ::google::protobuf::Empty* response, std::function<void(::grpc::Status)>) = 0;
       virtual void PrintOramTree(::grpc::ClientContext* context, const ::oram_impl::PrintOramTreeRequest* request, ::google::protobuf::Empty* response, ::grpc::ClientUnaryReactor* reactor) = 0;
       virtual void ReadPath(::grpc::ClientContext* context, const ::oram_impl::ReadPathRequest* request, ::oram_impl::ReadPathResponse* response, std::function<void(::grpc::Status)>) = 0;
       virtual void ReadPath(::grpc::ClientContext* context, const ::oram_impl::ReadPathRequest* request, ::oram_impl::ReadPathResponse* response, ::grpc::ClientUnaryReactor* reactor) = 0;
       virtual void WritePath(::grpc::ClientContext* context, const ::oram_impl::WritePathRequest* request, ::oram_impl::WritePathResponse* response, std::function<void(::grpc::Status)>) = 0;
       virtual void WritePath(::grpc::ClientContext* context, const ::oram_impl::WritePathRequest* request, ::oram_impl::WritePathResponse* response, ::grpc::ClientUnaryReactor* reactor) = 0;
+      // Read / write all the buckets on a path in a single round trip.
+      virtual void ReadFullPath(::grpc::ClientContext* context, const ::oram_impl::ReadFullPathRequest* request, ::oram_impl::ReadFullPathResponse* response, std::function<void(::grpc::Status)>) = 0;
+      virtual void ReadFullPath(::grpc::ClientContext* context, const ::oram_impl::ReadFullPathRequest* request, ::oram_impl::ReadFullPathResponse* response, ::grpc::ClientUnaryReactor* reactor) = 0;
+      virtual void WriteFullPath(::grpc::ClientContext* context, const ::oram_impl::WriteFullPathRequest* request, ::oram_impl::WritePathResponse* response, std::function<void(::grpc::Status)>) = 0;
+      virtual void WriteFullPath(::grpc::ClientContext* context, const ::oram_impl::WriteFullPathRequest* request, ::oram_impl::WritePathResponse* response, ::grpc::ClientUnaryReactor* reactor) = 0;
+      // Read / overwrite individual slots of the buckets on a path without
+      // clearing the rest of the buckets (for Ring ORAM).
+      virtual void ReadSlots(::grpc::ClientContext* context, const ::oram_impl::ReadSlotsRequest* request, ::oram_impl::ReadFullPathResponse* response, std::function<void(::grpc::Status)>) = 0;
+      virtual void ReadSlots(::grpc::ClientContext* context, const ::oram_impl::ReadSlotsRequest* request, ::oram_impl::ReadFullPathResponse* response, ::grpc::ClientUnaryReactor* reactor) = 0;
+      virtual void WriteSlots(::grpc::ClientContext* context, const ::oram_impl::WriteSlotsRequest* request, ::oram_impl::WritePathResponse* response, std::function<void(::grpc::Status)>) = 0;
+      virtual void WriteSlots(::grpc::ClientContext* context, const ::oram_impl::WriteSlotsRequest* request, ::oram_impl::WritePathResponse* response, ::grpc::ClientUnaryReactor* reactor) = 0;
       virtual void ReadFlatMemory(::grpc::ClientContext* context, const ::oram_impl::ReadFlatRequest* request, ::oram_impl::FlatVectorMessage* response, std::function<void(::grpc::Status)>) = 0;
       virtual void ReadFlatMemory(::grpc::ClientContext* context, const ::oram_impl::ReadFlatRequest* request, ::oram_impl::FlatVectorMessage* response, ::grpc::ClientUnaryReactor* reactor) = 0;
       virtual void WriteFlatMemory(::grpc::ClientContext* context, const ::oram_impl::FlatVectorMessage* request, ::google::protobuf::Empty* response, std::function<void(::grpc::Status)>) = 0;
@@ -216,12 +270,23 @@ class oram_server final {
     virtual ::grpc::ClientAsyncResponseReaderInterface< ::google::protobuf::Empty>* PrepareAsyncInitSqrtOramRaw(::grpc::ClientContext* context, const ::oram_impl::InitSqrtOramRequest& request, ::grpc::CompletionQueue* cq) = 0;
     virtual ::grpc::ClientAsyncResponseReaderInterface< ::google::protobuf::Empty>* AsyncLoadSqrtOramRaw(::grpc::ClientContext* context, const ::oram_impl::LoadSqrtOramRequest& request, ::grpc::CompletionQueue* cq) = 0;
     virtual ::grpc::ClientAsyncResponseReaderInterface< ::google::protobuf::Empty>* PrepareAsyncLoadSqrtOramRaw(::grpc::ClientContext* context, const ::oram_impl::LoadSqrtOramRequest& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientWriterInterface< ::oram_impl::BulkLoadRequest>* BulkLoadRaw(::grpc::ClientContext* context, ::google::protobuf::Empty* response) = 0;
+    virtual ::grpc::ClientAsyncWriterInterface< ::oram_impl::BulkLoadRequest>* AsyncBulkLoadRaw(::grpc::ClientContext* context, ::google::protobuf::Empty* response, ::grpc::CompletionQueue* cq, void* tag) = 0;
+    virtual ::grpc::ClientAsyncWriterInterface< ::oram_impl::BulkLoadRequest>* PrepareAsyncBulkLoadRaw(::grpc::ClientContext* context, ::google::protobuf::Empty* response, ::grpc::CompletionQueue* cq) = 0;
     virtual ::grpc::ClientAsyncResponseReaderInterface< ::google::protobuf::Empty>* AsyncPrintOramTreeRaw(::grpc::ClientContext* context, const ::oram_impl::PrintOramTreeRequest& request, ::grpc::CompletionQueue* cq) = 0;
     virtual ::grpc::ClientAsyncResponseReaderInterface< ::google::protobuf::Empty>* PrepareAsyncPrintOramTreeRaw(::grpc::ClientContext* context, const ::oram_impl::PrintOramTreeRequest& request, ::grpc::CompletionQueue* cq) = 0;
     virtual ::grpc::ClientAsyncResponseReaderInterface< ::oram_impl::ReadPathResponse>* AsyncReadPathRaw(::grpc::ClientContext* context, const ::oram_impl::ReadPathRequest& request, ::grpc::CompletionQueue* cq) = 0;
     virtual ::grpc::ClientAsyncResponseReaderInterface< ::oram_impl::ReadPathResponse>* PrepareAsyncReadPathRaw(::grpc::ClientContext* context, const ::oram_impl::ReadPathRequest& request, ::grpc::CompletionQueue* cq) = 0;
     virtual ::grpc::ClientAsyncResponseReaderInterface< ::oram_impl::WritePathResponse>* AsyncWritePathRaw(::grpc::ClientContext* context, const ::oram_impl::WritePathRequest& request, ::grpc::CompletionQueue* cq) = 0;
     virtual ::grpc::ClientAsyncResponseReaderInterface< ::oram_impl::WritePathResponse>* PrepareAsyncWritePathRaw(::grpc::ClientContext* context, const ::oram_impl::WritePathRequest& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::oram_impl::ReadFullPathResponse>* AsyncReadFullPathRaw(::grpc::ClientContext* context, const ::oram_impl::ReadFullPathRequest& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::oram_impl::ReadFullPathResponse>* PrepareAsyncReadFullPathRaw(::grpc::ClientContext* context, const ::oram_impl::ReadFullPathRequest& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::oram_impl::WritePathResponse>* AsyncWriteFullPathRaw(::grpc::ClientContext* context, const ::oram_impl::WriteFullPathRequest& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::oram_impl::WritePathResponse>* PrepareAsyncWriteFullPathRaw(::grpc::ClientContext* context, const ::oram_impl::WriteFullPathRequest& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::oram_impl::ReadFullPathResponse>* AsyncReadSlotsRaw(::grpc::ClientContext* context, const ::oram_impl::ReadSlotsRequest& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::oram_impl::ReadFullPathResponse>* PrepareAsyncReadSlotsRaw(::grpc::ClientContext* context, const ::oram_impl::ReadSlotsRequest& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::oram_impl::WritePathResponse>* AsyncWriteSlotsRaw(::grpc::ClientContext* context, const ::oram_impl::WriteSlotsRequest& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::oram_impl::WritePathResponse>* PrepareAsyncWriteSlotsRaw(::grpc::ClientContext* context, const ::oram_impl::WriteSlotsRequest& request, ::grpc::CompletionQueue* cq) = 0;
     virtual ::grpc::ClientAsyncResponseReaderInterface< ::oram_impl::FlatVectorMessage>* AsyncReadFlatMemoryRaw(::grpc::ClientContext* context, const ::oram_impl::ReadFlatRequest& request, ::grpc::CompletionQueue* cq) = 0;
     virtual ::grpc::ClientAsyncResponseReaderInterface< ::oram_impl::FlatVectorMessage>* PrepareAsyncReadFlatMemoryRaw(::grpc::ClientContext* context, const ::oram_impl::ReadFlatRequest& request, ::grpc::CompletionQueue* cq) = 0;
     virtual ::grpc::ClientAsyncResponseReaderInterface< ::google::protobuf::Empty>* AsyncWriteFlatMemoryRaw(::grpc::ClientContext* context, const ::oram_impl::FlatVectorMessage& request, ::grpc::CompletionQueue* cq) = 0;
@@ -274,6 +339,15 @@ class oram_server final {
     std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::google::protobuf::Empty>> PrepareAsyncLoadSqrtOram(::grpc::ClientContext* context, const ::oram_impl::LoadSqrtOramRequest& request, ::grpc::CompletionQueue* cq) {
       return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::google::protobuf::Empty>>(PrepareAsyncLoadSqrtOramRaw(context, request, cq));
     }
+    std::unique_ptr< ::grpc::ClientWriter< ::oram_impl::BulkLoadRequest>> BulkLoad(::grpc::ClientContext* context, ::google::protobuf::Empty* response) {
+      return std::unique_ptr< ::grpc::ClientWriter< ::oram_impl::BulkLoadRequest>>(BulkLoadRaw(context, response));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncWriter< ::oram_impl::BulkLoadRequest>> AsyncBulkLoad(::grpc::ClientContext* context, ::google::protobuf::Empty* response, ::grpc::CompletionQueue* cq, void* tag) {
+      return std::unique_ptr< ::grpc::ClientAsyncWriter< ::oram_impl::BulkLoadRequest>>(AsyncBulkLoadRaw(context, response, cq, tag));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncWriter< ::oram_impl::BulkLoadRequest>> PrepareAsyncBulkLoad(::grpc::ClientContext* context, ::google::protobuf::Empty* response, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncWriter< ::oram_impl::BulkLoadRequest>>(PrepareAsyncBulkLoadRaw(context, response, cq));
+    }
     ::grpc::Status PrintOramTree(::grpc::ClientContext* context, const ::oram_impl::PrintOramTreeRequest& request, ::google::protobuf::Empty* response) override;
     std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::google::protobuf::Empty>> AsyncPrintOramTree(::grpc::ClientContext* context, const ::oram_impl::PrintOramTreeRequest& request, ::grpc::CompletionQueue* cq) {
       return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::google::protobuf::Empty>>(AsyncPrintOramTreeRaw(context, request, cq));
@@ -295,6 +369,34 @@ class oram_server final {
     std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::oram_impl::WritePathResponse>> PrepareAsyncWritePath(::grpc::ClientContext* context, const ::oram_impl::WritePathRequest& request, ::grpc::CompletionQueue* cq) {
       return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::oram_impl::WritePathResponse>>(PrepareAsyncWritePathRaw(context, request, cq));
     }
+    ::grpc::Status ReadFullPath(::grpc::ClientContext* context, const ::oram_impl::ReadFullPathRequest& request, ::oram_impl::ReadFullPathResponse* response) override;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::oram_impl::ReadFullPathResponse>> AsyncReadFullPath(::grpc::ClientContext* context, const ::oram_impl::ReadFullPathRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::oram_impl::ReadFullPathResponse>>(AsyncReadFullPathRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::oram_impl::ReadFullPathResponse>> PrepareAsyncReadFullPath(::grpc::ClientContext* context, const ::oram_impl::ReadFullPathRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::oram_impl::ReadFullPathResponse>>(PrepareAsyncReadFullPathRaw(context, request, cq));
+    }
+    ::grpc::Status WriteFullPath(::grpc::ClientContext* context, const ::oram_impl::WriteFullPathRequest& request, ::oram_impl::WritePathResponse* response) override;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::oram_impl::WritePathResponse>> AsyncWriteFullPath(::grpc::ClientContext* context, const ::oram_impl::WriteFullPathRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::oram_impl::WritePathResponse>>(AsyncWriteFullPathRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::oram_impl::WritePathResponse>> PrepareAsyncWriteFullPath(::grpc::ClientContext* context, const ::oram_impl::WriteFullPathRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::oram_impl::WritePathResponse>>(PrepareAsyncWriteFullPathRaw(context, request, cq));
+    }
+    ::grpc::Status ReadSlots(::grpc::ClientContext* context, const ::oram_impl::ReadSlotsRequest& request, ::oram_impl::ReadFullPathResponse* response) override;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::oram_impl::ReadFullPathResponse>> AsyncReadSlots(::grpc::ClientContext* context, const ::oram_impl::ReadSlotsRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::oram_impl::ReadFullPathResponse>>(AsyncReadSlotsRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::oram_impl::ReadFullPathResponse>> PrepareAsyncReadSlots(::grpc::ClientContext* context, const ::oram_impl::ReadSlotsRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::oram_impl::ReadFullPathResponse>>(PrepareAsyncReadSlotsRaw(context, request, cq));
+    }
+    ::grpc::Status WriteSlots(::grpc::ClientContext* context, const ::oram_impl::WriteSlotsRequest& request, ::oram_impl::WritePathResponse* response) override;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::oram_impl::WritePathResponse>> AsyncWriteSlots(::grpc::ClientContext* context, const ::oram_impl::WriteSlotsRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::oram_impl::WritePathResponse>>(AsyncWriteSlotsRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::oram_impl::WritePathResponse>> PrepareAsyncWriteSlots(::grpc::ClientContext* context, const ::oram_impl::WriteSlotsRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::oram_impl::WritePathResponse>>(PrepareAsyncWriteSlotsRaw(context, request, cq));
+    }
     ::grpc::Status ReadFlatMemory(::grpc::ClientContext* context, const ::oram_impl::ReadFlatRequest& request, ::oram_impl::FlatVectorMessage* response) override;
     std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::oram_impl::FlatVectorMessage>> AsyncReadFlatMemory(::grpc::ClientContext* context, const ::oram_impl::ReadFlatRequest& request, ::grpc::CompletionQueue* cq) {
       return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::oram_impl::FlatVectorMessage>>(AsyncReadFlatMemoryRaw(context, request, cq));
@@ -376,12 +478,21 @@ class oram_server final {
       void InitSqrtOram(::grpc::ClientContext* context, const ::oram_impl::InitSqrtOramRequest* request, ::google::protobuf::Empty* response, ::grpc::ClientUnaryReactor* reactor) override;
       void LoadSqrtOram(::grpc::ClientContext* context, const ::oram_impl::LoadSqrtOramRequest* request, ::google::protobuf::Empty* response, std::function<void(::grpc::Status)>) override;
       void LoadSqrtOram(::grpc::ClientContext* context, const ::oram_impl::LoadSqrtOramRequest* request, ::google::protobuf::Empty* response, ::grpc::ClientUnaryReactor* reactor) override;
+      void BulkLoad(::grpc::ClientContext* context, ::google::protobuf::Empty* response, ::grpc::ClientWriteReactor< ::oram_impl::BulkLoadRequest>* reactor) override;
       void PrintOramTree(::grpc::ClientContext* context, const ::oram_impl::PrintOramTreeRequest* request, ::google::protobuf::Empty* response, std::function<void(::grpc::Status)>) override;
       void PrintOramTree(::grpc::ClientContext* context, const ::oram_impl::PrintOramTreeRequest* request, ::google::protobuf::Empty* response, ::grpc::ClientUnaryReactor* reactor) override;
       void ReadPath(::grpc::ClientContext* context, const ::oram_impl::ReadPathRequest* request, ::oram_impl::ReadPathResponse* response, std::function<void(::grpc::Status)>) override;
       void ReadPath(::grpc::ClientContext* context, const ::oram_impl::ReadPathRequest* request, ::oram_impl::ReadPathResponse* response, ::grpc::ClientUnaryReactor* reactor) override;
       void WritePath(::grpc::ClientContext* context, const ::oram_impl::WritePathRequest* request, ::oram_impl::WritePathResponse* response, std::function<void(::grpc::Status)>) override;
       void WritePath(::grpc::ClientContext* context, const ::oram_impl::WritePathRequest* request, ::oram_impl::WritePathResponse* response, ::grpc::ClientUnaryReactor* reactor) override;
+      void ReadFullPath(::grpc::ClientContext* context, const ::oram_impl::ReadFullPathRequest* request, ::oram_impl::ReadFullPathResponse* response, std::function<void(::grpc::Status)>) override;
+      void ReadFullPath(::grpc::ClientContext* context, const ::oram_impl::ReadFullPathRequest* request, ::oram_impl::ReadFullPathResponse* response, ::grpc::ClientUnaryReactor* reactor) override;
+      void WriteFullPath(::grpc::ClientContext* context, const ::oram_impl::WriteFullPathRequest* request, ::oram_impl::WritePathResponse* response, std::function<void(::grpc::Status)>) override;
+      void WriteFullPath(::grpc::ClientContext* context, const ::oram_impl::WriteFullPathRequest* request, ::oram_impl::WritePathResponse* response, ::grpc::ClientUnaryReactor* reactor) override;
+      void ReadSlots(::grpc::ClientContext* context, const ::oram_impl::ReadSlotsRequest* request, ::oram_impl::ReadFullPathResponse* response, std::function<void(::grpc::Status)>) override;
+      void ReadSlots(::grpc::ClientContext* context, const ::oram_impl::ReadSlotsRequest* request, ::oram_impl::ReadFullPathResponse* response, ::grpc::ClientUnaryReactor* reactor) override;
+      void WriteSlots(::grpc::ClientContext* context, const ::oram_impl::WriteSlotsRequest* request, ::oram_impl::WritePathResponse* response, std::function<void(::grpc::Status)>) override;
+      void WriteSlots(::grpc::ClientContext* context, const ::oram_impl::WriteSlotsRequest* request, ::oram_impl::WritePathResponse* response, ::grpc::ClientUnaryReactor* reactor) override;
       void ReadFlatMemory(::grpc::ClientContext* context, const ::oram_impl::ReadFlatRequest* request, ::oram_impl::FlatVectorMessage* response, std::function<void(::grpc::Status)>) override;
       void ReadFlatMemory(::grpc::ClientContext* context, const ::oram_impl::ReadFlatRequest* request, ::oram_impl::FlatVectorMessage* response, ::grpc::ClientUnaryReactor* reactor) override;
       void WriteFlatMemory(::grpc::ClientContext* context, const ::oram_impl::FlatVectorMessage* request, ::google::protobuf::Empty* response, std::function<void(::grpc::Status)>) override;
@@ -421,12 +532,23 @@ class oram_server final {
     ::grpc::ClientAsyncResponseReader< ::google::protobuf::Empty>* PrepareAsyncInitSqrtOramRaw(::grpc::ClientContext* context, const ::oram_impl::InitSqrtOramRequest& request, ::grpc::CompletionQueue* cq) override;
     ::grpc::ClientAsyncResponseReader< ::google::protobuf::Empty>* AsyncLoadSqrtOramRaw(::grpc::ClientContext* context, const ::oram_impl::LoadSqrtOramRequest& request, ::grpc::CompletionQueue* cq) override;
     ::grpc::ClientAsyncResponseReader< ::google::protobuf::Empty>* PrepareAsyncLoadSqrtOramRaw(::grpc::ClientContext* context, const ::oram_impl::LoadSqrtOramRequest& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientWriter< ::oram_impl::BulkLoadRequest>* BulkLoadRaw(::grpc::ClientContext* context, ::google::protobuf::Empty* response) override;
+    ::grpc::ClientAsyncWriter< ::oram_impl::BulkLoadRequest>* AsyncBulkLoadRaw(::grpc::ClientContext* context, ::google::protobuf::Empty* response, ::grpc::CompletionQueue* cq, void* tag) override;
+    ::grpc::ClientAsyncWriter< ::oram_impl::BulkLoadRequest>* PrepareAsyncBulkLoadRaw(::grpc::ClientContext* context, ::google::protobuf::Empty* response, ::grpc::CompletionQueue* cq) override;
     ::grpc::ClientAsyncResponseReader< ::google::protobuf::Empty>* AsyncPrintOramTreeRaw(::grpc::ClientContext* context, const ::oram_impl::PrintOramTreeRequest& request, ::grpc::CompletionQueue* cq) override;
     ::grpc::ClientAsyncResponseReader< ::google::protobuf::Empty>* PrepareAsyncPrintOramTreeRaw(::grpc::ClientContext* context, const ::oram_impl::PrintOramTreeRequest& request, ::grpc::CompletionQueue* cq) override;
     ::grpc::ClientAsyncResponseReader< ::oram_impl::ReadPathResponse>* AsyncReadPathRaw(::grpc::ClientContext* context, const ::oram_impl::ReadPathRequest& request, ::grpc::CompletionQueue* cq) override;
     ::grpc::ClientAsyncResponseReader< ::oram_impl::ReadPathResponse>* PrepareAsyncReadPathRaw(::grpc::ClientContext* context, const ::oram_impl::ReadPathRequest& request, ::grpc::CompletionQueue* cq) override;
     ::grpc::ClientAsyncResponseReader< ::oram_impl::WritePathResponse>* AsyncWritePathRaw(::grpc::ClientContext* context, const ::oram_impl::WritePathRequest& request, ::grpc::CompletionQueue* cq) override;
     ::grpc::ClientAsyncResponseReader< ::oram_impl::WritePathResponse>* PrepareAsyncWritePathRaw(::grpc::ClientContext* context, const ::oram_impl::WritePathRequest& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::oram_impl::ReadFullPathResponse>* AsyncReadFullPathRaw(::grpc::ClientContext* context, const ::oram_impl::ReadFullPathRequest& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::oram_impl::ReadFullPathResponse>* PrepareAsyncReadFullPathRaw(::grpc::ClientContext* context, const ::oram_impl::ReadFullPathRequest& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::oram_impl::WritePathResponse>* AsyncWriteFullPathRaw(::grpc::ClientContext* context, const ::oram_impl::WriteFullPathRequest& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::oram_impl::WritePathResponse>* PrepareAsyncWriteFullPathRaw(::grpc::ClientContext* context, const ::oram_impl::WriteFullPathRequest& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::oram_impl::ReadFullPathResponse>* AsyncReadSlotsRaw(::grpc::ClientContext* context, const ::oram_impl::ReadSlotsRequest& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::oram_impl::ReadFullPathResponse>* PrepareAsyncReadSlotsRaw(::grpc::ClientContext* context, const ::oram_impl::ReadSlotsRequest& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::oram_impl::WritePathResponse>* AsyncWriteSlotsRaw(::grpc::ClientContext* context, const ::oram_impl::WriteSlotsRequest& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::oram_impl::WritePathResponse>* PrepareAsyncWriteSlotsRaw(::grpc::ClientContext* context, const ::oram_impl::WriteSlotsRequest& request, ::grpc::CompletionQueue* cq) override;
     ::grpc::ClientAsyncResponseReader< ::oram_impl::FlatVectorMessage>* AsyncReadFlatMemoryRaw(::grpc::ClientContext* context, const ::oram_impl::ReadFlatRequest& request, ::grpc::CompletionQueue* cq) override;
     ::grpc::ClientAsyncResponseReader< ::oram_impl::FlatVectorMessage>* PrepareAsyncReadFlatMemoryRaw(::grpc::ClientContext* context, const ::oram_impl::ReadFlatRequest& request, ::grpc::CompletionQueue* cq) override;
     ::grpc::ClientAsyncResponseReader< ::google::protobuf::Empty>* AsyncWriteFlatMemoryRaw(::grpc::ClientContext* context, const ::oram_impl::FlatVectorMessage& request, ::grpc::CompletionQueue* cq) override;
@@ -451,9 +573,14 @@ class oram_server final {
     const ::grpc::internal::RpcMethod rpcmethod_InitFlatOram_;
     const ::grpc::internal::RpcMethod rpcmethod_InitSqrtOram_;
     const ::grpc::internal::RpcMethod rpcmethod_LoadSqrtOram_;
+    const ::grpc::internal::RpcMethod rpcmethod_BulkLoad_;
     const ::grpc::internal::RpcMethod rpcmethod_PrintOramTree_;
     const ::grpc::internal::RpcMethod rpcmethod_ReadPath_;
     const ::grpc::internal::RpcMethod rpcmethod_WritePath_;
+    const ::grpc::internal::RpcMethod rpcmethod_ReadFullPath_;
+    const ::grpc::internal::RpcMethod rpcmethod_WriteFullPath_;
+    const ::grpc::internal::RpcMethod rpcmethod_ReadSlots_;
+    const ::grpc::internal::RpcMethod rpcmethod_WriteSlots_;
     const ::grpc::internal::RpcMethod rpcmethod_ReadFlatMemory_;
     const ::grpc::internal::RpcMethod rpcmethod_WriteFlatMemory_;
     const ::grpc::internal::RpcMethod rpcmethod_ReadSqrtMemory_;
@@ -476,9 +603,18 @@ class oram_server final {
     virtual ::grpc::Status InitFlatOram(::grpc::ServerContext* context, const ::oram_impl::InitFlatOramRequest* request, ::google::protobuf::Empty* response);
     virtual ::grpc::Status InitSqrtOram(::grpc::ServerContext* context, const ::oram_impl::InitSqrtOramRequest* request, ::google::protobuf::Empty* response);
     virtual ::grpc::Status LoadSqrtOram(::grpc::ServerContext* context, const ::oram_impl::LoadSqrtOramRequest* request, ::google::protobuf::Empty* response);
+    // Stream the initial contents of any ORAM storage in chunks.
+    virtual ::grpc::Status BulkLoad(::grpc::ServerContext* context, ::grpc::ServerReader< ::oram_impl::BulkLoadRequest>* reader, ::google::protobuf::Empty* response);
     virtual ::grpc::Status PrintOramTree(::grpc::ServerContext* context, const ::oram_impl::PrintOramTreeRequest* request, ::google::protobuf::Empty* response);
     virtual ::grpc::Status ReadPath(::grpc::ServerContext* context, const ::oram_impl::ReadPathRequest* request, ::oram_impl::ReadPathResponse* response);
     virtual ::grpc::Status WritePath(::grpc::ServerContext* context, const ::oram_impl::WritePathRequest* request, ::oram_impl::WritePathResponse* response);
+    // Read / write all the buckets on a path in a single round trip.
+    virtual ::grpc::Status ReadFullPath(::grpc::ServerContext* context, const ::oram_impl::ReadFullPathRequest* request, ::oram_impl::ReadFullPathResponse* response);
+    virtual ::grpc::Status WriteFullPath(::grpc::ServerContext* context, const ::oram_impl::WriteFullPathRequest* request, ::oram_impl::WritePathResponse* response);
+    // Read / overwrite individual slots of the buckets on a path without
+    // clearing the rest of the buckets (for Ring ORAM).
+    virtual ::grpc::Status ReadSlots(::grpc::ServerContext* context, const ::oram_impl::ReadSlotsRequest* request, ::oram_impl::ReadFullPathResponse* response);
+    virtual ::grpc::Status WriteSlots(::grpc::ServerContext* context, const ::oram_impl::WriteSlotsRequest* request, ::oram_impl::WritePathResponse* response);
     virtual ::grpc::Status ReadFlatMemory(::grpc::ServerContext* context, const ::oram_impl::ReadFlatRequest* request, ::oram_impl::FlatVectorMessage* response);
     virtual ::grpc::Status WriteFlatMemory(::grpc::ServerContext* context, const ::oram_impl::FlatVectorMessage* request, ::google::protobuf::Empty* response);
     virtual ::grpc::Status ReadSqrtMemory(::grpc::ServerContext* context, const ::oram_impl::ReadSqrtRequest* request, ::oram_impl::SqrtMessage* response);
@@ -575,12 +711,32 @@ class oram_server final {
     }
   };
   template <class BaseClass>
+  class WithAsyncMethod_BulkLoad : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithAsyncMethod_BulkLoad() {
+      ::grpc::Service::MarkMethodAsync(4);
+    }
+    ~WithAsyncMethod_BulkLoad() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status BulkLoad(::grpc::ServerContext* /*context*/, ::grpc::ServerReader< ::oram_impl::BulkLoadRequest>* /*reader*/, ::google::protobuf::Empty* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestBulkLoad(::grpc::ServerContext* context, ::grpc::ServerAsyncReader< ::google::protobuf::Empty, ::oram_impl::BulkLoadRequest>* reader, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncClientStreaming(4, context, reader, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
   class WithAsyncMethod_PrintOramTree : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithAsyncMethod_PrintOramTree() {
-      ::grpc::Service::MarkMethodAsync(4);
+      ::grpc::Service::MarkMethodAsync(5);
     }
     ~WithAsyncMethod_PrintOramTree() override {
       BaseClassMustBeDerivedFromService(this);
@@ -591,7 +747,7 @@ class oram_server final {
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
     void RequestPrintOramTree(::grpc::ServerContext* context, ::oram_impl::PrintOramTreeRequest* request, ::grpc::ServerAsyncResponseWriter< ::google::protobuf::Empty>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
-      ::grpc::Service::RequestAsyncUnary(4, context, request, response, new_call_cq, notification_cq, tag);
+      ::grpc::Service::RequestAsyncUnary(5, context, request, response, new_call_cq, notification_cq, tag);
     }
   };
   template <class BaseClass>
@@ -600,7 +756,7 @@ class oram_server final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithAsyncMethod_ReadPath() {
-      ::grpc::Service::MarkMethodAsync(5);
+      ::grpc::Service::MarkMethodAsync(6);
     }
     ~WithAsyncMethod_ReadPath() override {
       BaseClassMustBeDerivedFromService(this);
@@ -611,7 +767,7 @@ class oram_server final {
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
     void RequestReadPath(::grpc::ServerContext* context, ::oram_impl::ReadPathRequest* request, ::grpc::ServerAsyncResponseWriter< ::oram_impl::ReadPathResponse>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
-      ::grpc::Service::RequestAsyncUnary(5, context, request, response, new_call_cq, notification_cq, tag);
+      ::grpc::Service::RequestAsyncUnary(6, context, request, response, new_call_cq, notification_cq, tag);
     }
   };
   template <class BaseClass>
@@ -620,7 +776,7 @@ class oram_server final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithAsyncMethod_WritePath() {
-      ::grpc::Service::MarkMethodAsync(6);
+      ::grpc::Service::MarkMethodAsync(7);
     }
     ~WithAsyncMethod_WritePath() override {
       BaseClassMustBeDerivedFromService(this);
@@ -631,7 +787,87 @@ class oram_server final {
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
     void RequestWritePath(::grpc::ServerContext* context, ::oram_impl::WritePathRequest* request, ::grpc::ServerAsyncResponseWriter< ::oram_impl::WritePathResponse>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
-      ::grpc::Service::RequestAsyncUnary(6, context, request, response, new_call_cq, notification_cq, tag);
+      ::grpc::Service::RequestAsyncUnary(7, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithAsyncMethod_ReadFullPath : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithAsyncMethod_ReadFullPath() {
+      ::grpc::Service::MarkMethodAsync(8);
+    }
+    ~WithAsyncMethod_ReadFullPath() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status ReadFullPath(::grpc::ServerContext* /*context*/, const ::oram_impl::ReadFullPathRequest* /*request*/, ::oram_impl::ReadFullPathResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestReadFullPath(::grpc::ServerContext* context, ::oram_impl::ReadFullPathRequest* request, ::grpc::ServerAsyncResponseWriter< ::oram_impl::ReadFullPathResponse>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(8, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithAsyncMethod_WriteFullPath : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithAsyncMethod_WriteFullPath() {
+      ::grpc::Service::MarkMethodAsync(9);
+    }
+    ~WithAsyncMethod_WriteFullPath() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status WriteFullPath(::grpc::ServerContext* /*context*/, const ::oram_impl::WriteFullPathRequest* /*request*/, ::oram_impl::WritePathResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestWriteFullPath(::grpc::ServerContext* context, ::oram_impl::WriteFullPathRequest* request, ::grpc::ServerAsyncResponseWriter< ::oram_impl::WritePathResponse>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(9, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithAsyncMethod_ReadSlots : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithAsyncMethod_ReadSlots() {
+      ::grpc::Service::MarkMethodAsync(10);
+    }
+    ~WithAsyncMethod_ReadSlots() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status ReadSlots(::grpc::ServerContext* /*context*/, const ::oram_impl::ReadSlotsRequest* /*request*/, ::oram_impl::ReadFullPathResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestReadSlots(::grpc::ServerContext* context, ::oram_impl::ReadSlotsRequest* request, ::grpc::ServerAsyncResponseWriter< ::oram_impl::ReadFullPathResponse>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(10, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithAsyncMethod_WriteSlots : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithAsyncMethod_WriteSlots() {
+      ::grpc::Service::MarkMethodAsync(11);
+    }
+    ~WithAsyncMethod_WriteSlots() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status WriteSlots(::grpc::ServerContext* /*context*/, const ::oram_impl::WriteSlotsRequest* /*request*/, ::oram_impl::WritePathResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestWriteSlots(::grpc::ServerContext* context, ::oram_impl::WriteSlotsRequest* request, ::grpc::ServerAsyncResponseWriter< ::oram_impl::WritePathResponse>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(11, context, request, response, new_call_cq, notification_cq, tag);
     }
   };
   template <class BaseClass>
@@ -640,7 +876,7 @@ class oram_server final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithAsyncMethod_ReadFlatMemory() {
-      ::grpc::Service::MarkMethodAsync(7);
+      ::grpc::Service::MarkMethodAsync(12);
     }
     ~WithAsyncMethod_ReadFlatMemory() override {
       BaseClassMustBeDerivedFromService(this);
@@ -651,7 +887,7 @@ class oram_server final {
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
     void RequestReadFlatMemory(::grpc::ServerContext* context, ::oram_impl::ReadFlatRequest* request, ::grpc::ServerAsyncResponseWriter< ::oram_impl::FlatVectorMessage>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
-      ::grpc::Service::RequestAsyncUnary(7, context, request, response, new_call_cq, notification_cq, tag);
+      ::grpc::Service::RequestAsyncUnary(12, context, request, response, new_call_cq, notification_cq, tag);
     }
   };
   template <class BaseClass>
@@ -660,7 +896,7 @@ class oram_server final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithAsyncMethod_WriteFlatMemory() {
-      ::grpc::Service::MarkMethodAsync(8);
+      ::grpc::Service::MarkMethodAsync(13);
     }
     ~WithAsyncMethod_WriteFlatMemory() override {
       BaseClassMustBeDerivedFromService(this);
@@ -671,7 +907,7 @@ class oram_server final {
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
     void RequestWriteFlatMemory(::grpc::ServerContext* context, ::oram_impl::FlatVectorMessage* request, ::grpc::ServerAsyncResponseWriter< ::google::protobuf::Empty>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
-      ::grpc::Service::RequestAsyncUnary(8, context, request, response, new_call_cq, notification_cq, tag);
+      ::grpc::Service::RequestAsyncUnary(13, context, request, response, new_call_cq, notification_cq, tag);
     }
   };
   template <class BaseClass>
@@ -680,7 +916,7 @@ class oram_server final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithAsyncMethod_ReadSqrtMemory() {
-      ::grpc::Service::MarkMethodAsync(9);
+      ::grpc::Service::MarkMethodAsync(14);
     }
     ~WithAsyncMethod_ReadSqrtMemory() override {
       BaseClassMustBeDerivedFromService(this);
@@ -691,7 +927,7 @@ class oram_server final {
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
     void RequestReadSqrtMemory(::grpc::ServerContext* context, ::oram_impl::ReadSqrtRequest* request, ::grpc::ServerAsyncResponseWriter< ::oram_impl::SqrtMessage>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
-      ::grpc::Service::RequestAsyncUnary(9, context, request, response, new_call_cq, notification_cq, tag);
+      ::grpc::Service::RequestAsyncUnary(14, context, request, response, new_call_cq, notification_cq, tag);
     }
   };
   template <class BaseClass>
@@ -700,7 +936,7 @@ class oram_server final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithAsyncMethod_WriteSqrtMemory() {
-      ::grpc::Service::MarkMethodAsync(10);
+      ::grpc::Service::MarkMethodAsync(15);
     }
     ~WithAsyncMethod_WriteSqrtMemory() override {
       BaseClassMustBeDerivedFromService(this);
@@ -711,7 +947,7 @@ class oram_server final {
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
     void RequestWriteSqrtMemory(::grpc::ServerContext* context, ::oram_impl::WriteSqrtMessage* request, ::grpc::ServerAsyncResponseWriter< ::google::protobuf::Empty>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
-      ::grpc::Service::RequestAsyncUnary(10, context, request, response, new_call_cq, notification_cq, tag);
+      ::grpc::Service::RequestAsyncUnary(15, context, request, response, new_call_cq, notification_cq, tag);
     }
   };
   template <class BaseClass>
@@ -720,7 +956,7 @@ class oram_server final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithAsyncMethod_SqrtPermute() {
-      ::grpc::Service::MarkMethodAsync(11);
+      ::grpc::Service::MarkMethodAsync(16);
     }
     ~WithAsyncMethod_SqrtPermute() override {
       BaseClassMustBeDerivedFromService(this);
@@ -731,7 +967,7 @@ class oram_server final {
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
     void RequestSqrtPermute(::grpc::ServerContext* context, ::oram_impl::SqrtPermMessage* request, ::grpc::ServerAsyncResponseWriter< ::google::protobuf::Empty>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
-      ::grpc::Service::RequestAsyncUnary(11, context, request, response, new_call_cq, notification_cq, tag);
+      ::grpc::Service::RequestAsyncUnary(16, context, request, response, new_call_cq, notification_cq, tag);
     }
   };
   template <class BaseClass>
@@ -740,7 +976,7 @@ class oram_server final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithAsyncMethod_CloseConnection() {
-      ::grpc::Service::MarkMethodAsync(12);
+      ::grpc::Service::MarkMethodAsync(17);
     }
     ~WithAsyncMethod_CloseConnection() override {
       BaseClassMustBeDerivedFromService(this);
@@ -751,7 +987,7 @@ class oram_server final {
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
     void RequestCloseConnection(::grpc::ServerContext* context, ::google::protobuf::Empty* request, ::grpc::ServerAsyncResponseWriter< ::google::protobuf::Empty>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
-      ::grpc::Service::RequestAsyncUnary(12, context, request, response, new_call_cq, notification_cq, tag);
+      ::grpc::Service::RequestAsyncUnary(17, context, request, response, new_call_cq, notification_cq, tag);
     }
   };
   template <class BaseClass>
@@ -760,7 +996,7 @@ class oram_server final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithAsyncMethod_KeyExchange() {
-      ::grpc::Service::MarkMethodAsync(13);
+      ::grpc::Service::MarkMethodAsync(18);
     }
     ~WithAsyncMethod_KeyExchange() override {
       BaseClassMustBeDerivedFromService(this);
@@ -771,7 +1007,7 @@ class oram_server final {
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
     void RequestKeyExchange(::grpc::ServerContext* context, ::oram_impl::KeyExchangeRequest* request, ::grpc::ServerAsyncResponseWriter< ::oram_impl::KeyExchangeResponse>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
-      ::grpc::Service::RequestAsyncUnary(13, context, request, response, new_call_cq, notification_cq, tag);
+      ::grpc::Service::RequestAsyncUnary(18, context, request, response, new_call_cq, notification_cq, tag);
     }
   };
   template <class BaseClass>
@@ -780,7 +1016,7 @@ class oram_server final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithAsyncMethod_SendHello() {
-      ::grpc::Service::MarkMethodAsync(14);
+      ::grpc::Service::MarkMethodAsync(19);
     }
     ~WithAsyncMethod_SendHello() override {
       BaseClassMustBeDerivedFromService(this);
@@ -791,7 +1027,7 @@ class oram_server final {
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
     void RequestSendHello(::grpc::ServerContext* context, ::oram_impl::HelloMessage* request, ::grpc::ServerAsyncResponseWriter< ::google::protobuf::Empty>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
-      ::grpc::Service::RequestAsyncUnary(14, context, request, response, new_call_cq, notification_cq, tag);
+      ::grpc::Service::RequestAsyncUnary(19, context, request, response, new_call_cq, notification_cq, tag);
     }
   };
   template <class BaseClass>
@@ -800,7 +1036,7 @@ class oram_server final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithAsyncMethod_ReportServerInformation() {
-      ::grpc::Service::MarkMethodAsync(15);
+      ::grpc::Service::MarkMethodAsync(20);
     }
     ~WithAsyncMethod_ReportServerInformation() override {
       BaseClassMustBeDerivedFromService(this);
@@ -811,7 +1047,7 @@ class oram_server final {
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
     void RequestReportServerInformation(::grpc::ServerContext* context, ::google::protobuf::Empty* request, ::grpc::ServerAsyncResponseWriter< ::google::protobuf::Empty>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
-      ::grpc::Service::RequestAsyncUnary(15, context, request, response, new_call_cq, notification_cq, tag);
+      ::grpc::Service::RequestAsyncUnary(20, context, request, response, new_call_cq, notification_cq, tag);
     }
   };
   template <class BaseClass>
@@ -820,7 +1056,7 @@ class oram_server final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithAsyncMethod_ResetServer() {
-      ::grpc::Service::MarkMethodAsync(16);
+      ::grpc::Service::MarkMethodAsync(21);
     }
     ~WithAsyncMethod_ResetServer() override {
       BaseClassMustBeDerivedFromService(this);
@@ -831,10 +1067,10 @@ class oram_server final {
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
     void RequestResetServer(::grpc::ServerContext* context, ::google::protobuf::Empty* request, ::grpc::ServerAsyncResponseWriter< ::google::protobuf::Empty>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
-      ::grpc::Service::RequestAsyncUnary(16, context, request, response, new_call_cq, notification_cq, tag);
+      ::grpc::Service::RequestAsyncUnary(21, context, request, response, new_call_cq, notification_cq, tag);
     }
   };
-  typedef WithAsyncMethod_InitTreeOram<WithAsyncMethod_InitFlatOram<WithAsyncMethod_InitSqrtOram<WithAsyncMethod_LoadSqrtOram<WithAsyncMethod_PrintOramTree<WithAsyncMethod_ReadPath<WithAsyncMethod_WritePath<WithAsyncMethod_ReadFlatMemory<WithAsyncMethod_WriteFlatMemory<WithAsyncMethod_ReadSqrtMemory<WithAsyncMethod_WriteSqrtMemory<WithAsyncMethod_SqrtPermute<WithAsyncMethod_CloseConnection<WithAsyncMethod_KeyExchange<WithAsyncMethod_SendHello<WithAsyncMethod_ReportServerInformation<WithAsyncMethod_ResetServer<Service > > > > > > > > > > > > > > > > > AsyncService;
+  typedef WithAsyncMethod_InitTreeOram<WithAsyncMethod_InitFlatOram<WithAsyncMethod_InitSqrtOram<WithAsyncMethod_LoadSqrtOram<WithAsyncMethod_BulkLoad<WithAsyncMethod_PrintOramTree<WithAsyncMethod_ReadPath<WithAsyncMethod_WritePath<WithAsyncMethod_ReadFullPath<WithAsyncMethod_WriteFullPath<WithAsyncMethod_ReadSlots<WithAsyncMethod_WriteSlots<WithAsyncMethod_ReadFlatMemory<WithAsyncMethod_WriteFlatMemory<WithAsyncMethod_ReadSqrtMemory<WithAsyncMethod_WriteSqrtMemory<WithAsyncMethod_SqrtPermute<WithAsyncMethod_CloseConnection<WithAsyncMethod_KeyExchange<WithAsyncMethod_SendHello<WithAsyncMethod_ReportServerInformation<WithAsyncMethod_ResetServer<Service > > > > > > > > > > > > > > > > > > > > > > AsyncService;
   template <class BaseClass>
   class WithCallbackMethod_InitTreeOram : public BaseClass {
    private:
@@ -944,18 +1180,40 @@ class oram_server final {
       ::grpc::CallbackServerContext* /*context*/, const ::oram_impl::LoadSqrtOramRequest* /*request*/, ::google::protobuf::Empty* /*response*/)  { return nullptr; }
   };
   template <class BaseClass>
+  class WithCallbackMethod_BulkLoad : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithCallbackMethod_BulkLoad() {
+      ::grpc::Service::MarkMethodCallback(4,
+          new ::grpc::internal::CallbackClientStreamingHandler< ::oram_impl::BulkLoadRequest, ::google::protobuf::Empty>(
+            [this](
+                   ::grpc::CallbackServerContext* context, ::google::protobuf::Empty* response) { return this->BulkLoad(context, response); }));
+    }
+    ~WithCallbackMethod_BulkLoad() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status BulkLoad(::grpc::ServerContext* /*context*/, ::grpc::ServerReader< ::oram_impl::BulkLoadRequest>* /*reader*/, ::google::protobuf::Empty* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerReadReactor< ::oram_impl::BulkLoadRequest>* BulkLoad(
+      ::grpc::CallbackServerContext* /*context*/, ::google::protobuf::Empty* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
   class WithCallbackMethod_PrintOramTree : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithCallbackMethod_PrintOramTree() {
-      ::grpc::Service::MarkMethodCallback(4,
+      ::grpc::Service::MarkMethodCallback(5,
           new ::grpc::internal::CallbackUnaryHandler< ::oram_impl::PrintOramTreeRequest, ::google::protobuf::Empty>(
             [this](
                    ::grpc::CallbackServerContext* context, const ::oram_impl::PrintOramTreeRequest* request, ::google::protobuf::Empty* response) { return this->PrintOramTree(context, request, response); }));}
     void SetMessageAllocatorFor_PrintOramTree(
         ::grpc::MessageAllocator< ::oram_impl::PrintOramTreeRequest, ::google::protobuf::Empty>* allocator) {
-      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(4);
+      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(5);
       static_cast<::grpc::internal::CallbackUnaryHandler< ::oram_impl::PrintOramTreeRequest, ::google::protobuf::Empty>*>(handler)
               ->SetMessageAllocator(allocator);
     }
@@ -976,13 +1234,13 @@ class oram_server final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithCallbackMethod_ReadPath() {
-      ::grpc::Service::MarkMethodCallback(5,
+      ::grpc::Service::MarkMethodCallback(6,
           new ::grpc::internal::CallbackUnaryHandler< ::oram_impl::ReadPathRequest, ::oram_impl::ReadPathResponse>(
             [this](
                    ::grpc::CallbackServerContext* context, const ::oram_impl::ReadPathRequest* request, ::oram_impl::ReadPathResponse* response) { return this->ReadPath(context, request, response); }));}
     void SetMessageAllocatorFor_ReadPath(
         ::grpc::MessageAllocator< ::oram_impl::ReadPathRequest, ::oram_impl::ReadPathResponse>* allocator) {
-      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(5);
+      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(6);
       static_cast<::grpc::internal::CallbackUnaryHandler< ::oram_impl::ReadPathRequest, ::oram_impl::ReadPathResponse>*>(handler)
               ->SetMessageAllocator(allocator);
     }
@@ -1003,13 +1261,13 @@ class oram_server final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithCallbackMethod_WritePath() {
-      ::grpc::Service::MarkMethodCallback(6,
+      ::grpc::Service::MarkMethodCallback(7,
           new ::grpc::internal::CallbackUnaryHandler< ::oram_impl::WritePathRequest, ::oram_impl::WritePathResponse>(
             [this](
                    ::grpc::CallbackServerContext* context, const ::oram_impl::WritePathRequest* request, ::oram_impl::WritePathResponse* response) { return this->WritePath(context, request, response); }));}
     void SetMessageAllocatorFor_WritePath(
         ::grpc::MessageAllocator< ::oram_impl::WritePathRequest, ::oram_impl::WritePathResponse>* allocator) {
-      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(6);
+      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(7);
       static_cast<::grpc::internal::CallbackUnaryHandler< ::oram_impl::WritePathRequest, ::oram_impl::WritePathResponse>*>(handler)
               ->SetMessageAllocator(allocator);
     }
@@ -1025,18 +1283,126 @@ class oram_server final {
       ::grpc::CallbackServerContext* /*context*/, const ::oram_impl::WritePathRequest* /*request*/, ::oram_impl::WritePathResponse* /*response*/)  { return nullptr; }
   };
   template <class BaseClass>
+  class WithCallbackMethod_ReadFullPath : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithCallbackMethod_ReadFullPath() {
+      ::grpc::Service::MarkMethodCallback(8,
+          new ::grpc::internal::CallbackUnaryHandler< ::oram_impl::ReadFullPathRequest, ::oram_impl::ReadFullPathResponse>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::oram_impl::ReadFullPathRequest* request, ::oram_impl::ReadFullPathResponse* response) { return this->ReadFullPath(context, request, response); }));}
+    void SetMessageAllocatorFor_ReadFullPath(
+        ::grpc::MessageAllocator< ::oram_impl::ReadFullPathRequest, ::oram_impl::ReadFullPathResponse>* allocator) {
+      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(8);
+      static_cast<::grpc::internal::CallbackUnaryHandler< ::oram_impl::ReadFullPathRequest, ::oram_impl::ReadFullPathResponse>*>(handler)
+              ->SetMessageAllocator(allocator);
+    }
+    ~WithCallbackMethod_ReadFullPath() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status ReadFullPath(::grpc::ServerContext* /*context*/, const ::oram_impl::ReadFullPathRequest* /*request*/, ::oram_impl::ReadFullPathResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* ReadFullPath(
+      ::grpc::CallbackServerContext* /*context*/, const ::oram_impl::ReadFullPathRequest* /*request*/, ::oram_impl::ReadFullPathResponse* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithCallbackMethod_WriteFullPath : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithCallbackMethod_WriteFullPath() {
+      ::grpc::Service::MarkMethodCallback(9,
+          new ::grpc::internal::CallbackUnaryHandler< ::oram_impl::WriteFullPathRequest, ::oram_impl::WritePathResponse>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::oram_impl::WriteFullPathRequest* request, ::oram_impl::WritePathResponse* response) { return this->WriteFullPath(context, request, response); }));}
+    void SetMessageAllocatorFor_WriteFullPath(
+        ::grpc::MessageAllocator< ::oram_impl::WriteFullPathRequest, ::oram_impl::WritePathResponse>* allocator) {
+      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(9);
+      static_cast<::grpc::internal::CallbackUnaryHandler< ::oram_impl::WriteFullPathRequest, ::oram_impl::WritePathResponse>*>(handler)
+              ->SetMessageAllocator(allocator);
+    }
+    ~WithCallbackMethod_WriteFullPath() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status WriteFullPath(::grpc::ServerContext* /*context*/, const ::oram_impl::WriteFullPathRequest* /*request*/, ::oram_impl::WritePathResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* WriteFullPath(
+      ::grpc::CallbackServerContext* /*context*/, const ::oram_impl::WriteFullPathRequest* /*request*/, ::oram_impl::WritePathResponse* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithCallbackMethod_ReadSlots : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithCallbackMethod_ReadSlots() {
+      ::grpc::Service::MarkMethodCallback(10,
+          new ::grpc::internal::CallbackUnaryHandler< ::oram_impl::ReadSlotsRequest, ::oram_impl::ReadFullPathResponse>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::oram_impl::ReadSlotsRequest* request, ::oram_impl::ReadFullPathResponse* response) { return this->ReadSlots(context, request, response); }));}
+    void SetMessageAllocatorFor_ReadSlots(
+        ::grpc::MessageAllocator< ::oram_impl::ReadSlotsRequest, ::oram_impl::ReadFullPathResponse>* allocator) {
+      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(10);
+      static_cast<::grpc::internal::CallbackUnaryHandler< ::oram_impl::ReadSlotsRequest, ::oram_impl::ReadFullPathResponse>*>(handler)
+              ->SetMessageAllocator(allocator);
+    }
+    ~WithCallbackMethod_ReadSlots() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status ReadSlots(::grpc::ServerContext* /*context*/, const ::oram_impl::ReadSlotsRequest* /*request*/, ::oram_impl::ReadFullPathResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* ReadSlots(
+      ::grpc::CallbackServerContext* /*context*/, const ::oram_impl::ReadSlotsRequest* /*request*/, ::oram_impl::ReadFullPathResponse* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithCallbackMethod_WriteSlots : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithCallbackMethod_WriteSlots() {
+      ::grpc::Service::MarkMethodCallback(11,
+          new ::grpc::internal::CallbackUnaryHandler< ::oram_impl::WriteSlotsRequest, ::oram_impl::WritePathResponse>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::oram_impl::WriteSlotsRequest* request, ::oram_impl::WritePathResponse* response) { return this->WriteSlots(context, request, response); }));}
+    void SetMessageAllocatorFor_WriteSlots(
+        ::grpc::MessageAllocator< ::oram_impl::WriteSlotsRequest, ::oram_impl::WritePathResponse>* allocator) {
+      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(11);
+      static_cast<::grpc::internal::CallbackUnaryHandler< ::oram_impl::WriteSlotsRequest, ::oram_impl::WritePathResponse>*>(handler)
+              ->SetMessageAllocator(allocator);
+    }
+    ~WithCallbackMethod_WriteSlots() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status WriteSlots(::grpc::ServerContext* /*context*/, const ::oram_impl::WriteSlotsRequest* /*request*/, ::oram_impl::WritePathResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* WriteSlots(
+      ::grpc::CallbackServerContext* /*context*/, const ::oram_impl::WriteSlotsRequest* /*request*/, ::oram_impl::WritePathResponse* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
   class WithCallbackMethod_ReadFlatMemory : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithCallbackMethod_ReadFlatMemory() {
-      ::grpc::Service::MarkMethodCallback(7,
+      ::grpc::Service::MarkMethodCallback(12,
           new ::grpc::internal::CallbackUnaryHandler< ::oram_impl::ReadFlatRequest, ::oram_impl::FlatVectorMessage>(
             [this](
                    ::grpc::CallbackServerContext* context, const ::oram_impl::ReadFlatRequest* request, ::oram_impl::FlatVectorMessage* response) { return this->ReadFlatMemory(context, request, response); }));}
     void SetMessageAllocatorFor_ReadFlatMemory(
         ::grpc::MessageAllocator< ::oram_impl::ReadFlatRequest, ::oram_impl::FlatVectorMessage>* allocator) {
-      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(7);
+      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(12);
       static_cast<::grpc::internal::CallbackUnaryHandler< ::oram_impl::ReadFlatRequest, ::oram_impl::FlatVectorMessage>*>(handler)
               ->SetMessageAllocator(allocator);
     }
@@ -1057,13 +1423,13 @@ class oram_server final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithCallbackMethod_WriteFlatMemory() {
-      ::grpc::Service::MarkMethodCallback(8,
+      ::grpc::Service::MarkMethodCallback(13,
           new ::grpc::internal::CallbackUnaryHandler< ::oram_impl::FlatVectorMessage, ::google::protobuf::Empty>(
             [this](
                    ::grpc::CallbackServerContext* context, const ::oram_impl::FlatVectorMessage* request, ::google::protobuf::Empty* response) { return this->WriteFlatMemory(context, request, response); }));}
     void SetMessageAllocatorFor_WriteFlatMemory(
         ::grpc::MessageAllocator< ::oram_impl::FlatVectorMessage, ::google::protobuf::Empty>* allocator) {
-      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(8);
+      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(13);
       static_cast<::grpc::internal::CallbackUnaryHandler< ::oram_impl::FlatVectorMessage, ::google::protobuf::Empty>*>(handler)
               ->SetMessageAllocator(allocator);
     }
@@ -1084,13 +1450,13 @@ class oram_server final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithCallbackMethod_ReadSqrtMemory() {
-      ::grpc::Service::MarkMethodCallback(9,
+      ::grpc::Service::MarkMethodCallback(14,
           new ::grpc::internal::CallbackUnaryHandler< ::oram_impl::ReadSqrtRequest, ::oram_impl::SqrtMessage>(
             [this](
                    ::grpc::CallbackServerContext* context, const ::oram_impl::ReadSqrtRequest* request, ::oram_impl::SqrtMessage* response) { return this->ReadSqrtMemory(context, request, response); }));}
     void SetMessageAllocatorFor_ReadSqrtMemory(
         ::grpc::MessageAllocator< ::oram_impl::ReadSqrtRequest, ::oram_impl::SqrtMessage>* allocator) {
-      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(9);
+      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(14);
       static_cast<::grpc::internal::CallbackUnaryHandler< ::oram_impl::ReadSqrtRequest, ::oram_impl::SqrtMessage>*>(handler)
               ->SetMessageAllocator(allocator);
     }
@@ -1111,13 +1477,13 @@ class oram_server final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithCallbackMethod_WriteSqrtMemory() {
-      ::grpc::Service::MarkMethodCallback(10,
+      ::grpc::Service::MarkMethodCallback(15,
           new ::grpc::internal::CallbackUnaryHandler< ::oram_impl::WriteSqrtMessage, ::google::protobuf::Empty>(
             [this](
                    ::grpc::CallbackServerContext* context, const ::oram_impl::WriteSqrtMessage* request, ::google::protobuf::Empty* response) { return this->WriteSqrtMemory(context, request, response); }));}
     void SetMessageAllocatorFor_WriteSqrtMemory(
         ::grpc::MessageAllocator< ::oram_impl::WriteSqrtMessage, ::google::protobuf::Empty>* allocator) {
-      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(10);
+      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(15);
       static_cast<::grpc::internal::CallbackUnaryHandler< ::oram_impl::WriteSqrtMessage, ::google::protobuf::Empty>*>(handler)
               ->SetMessageAllocator(allocator);
     }
@@ -1138,13 +1504,13 @@ class oram_server final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithCallbackMethod_SqrtPermute() {
-      ::grpc::Service::MarkMethodCallback(11,
+      ::grpc::Service::MarkMethodCallback(16,
           new ::grpc::internal::CallbackUnaryHandler< ::oram_impl::SqrtPermMessage, ::google::protobuf::Empty>(
             [this](
                    ::grpc::CallbackServerContext* context, const ::oram_impl::SqrtPermMessage* request, ::google::protobuf::Empty* response) { return this->SqrtPermute(context, request, response); }));}
     void SetMessageAllocatorFor_SqrtPermute(
         ::grpc::MessageAllocator< ::oram_impl::SqrtPermMessage, ::google::protobuf::Empty>* allocator) {
-      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(11);
+      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(16);
       static_cast<::grpc::internal::CallbackUnaryHandler< ::oram_impl::SqrtPermMessage, ::google::protobuf::Empty>*>(handler)
               ->SetMessageAllocator(allocator);
     }
@@ -1165,13 +1531,13 @@ class oram_server final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithCallbackMethod_CloseConnection() {
-      ::grpc::Service::MarkMethodCallback(12,
+      ::grpc::Service::MarkMethodCallback(17,
           new ::grpc::internal::CallbackUnaryHandler< ::google::protobuf::Empty, ::google::protobuf::Empty>(
             [this](
                    ::grpc::CallbackServerContext* context, const ::google::protobuf::Empty* request, ::google::protobuf::Empty* response) { return this->CloseConnection(context, request, response); }));}
     void SetMessageAllocatorFor_CloseConnection(
         ::grpc::MessageAllocator< ::google::protobuf::Empty, ::google::protobuf::Empty>* allocator) {
-      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(12);
+      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(17);
       static_cast<::grpc::internal::CallbackUnaryHandler< ::google::protobuf::Empty, ::google::protobuf::Empty>*>(handler)
               ->SetMessageAllocator(allocator);
     }
@@ -1192,13 +1558,13 @@ class oram_server final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithCallbackMethod_KeyExchange() {
-      ::grpc::Service::MarkMethodCallback(13,
+      ::grpc::Service::MarkMethodCallback(18,
           new ::grpc::internal::CallbackUnaryHandler< ::oram_impl::KeyExchangeRequest, ::oram_impl::KeyExchangeResponse>(
             [this](
                    ::grpc::CallbackServerContext* context, const ::oram_impl::KeyExchangeRequest* request, ::oram_impl::KeyExchangeResponse* response) { return this->KeyExchange(context, request, response); }));}
     void SetMessageAllocatorFor_KeyExchange(
         ::grpc::MessageAllocator< ::oram_impl::KeyExchangeRequest, ::oram_impl::KeyExchangeResponse>* allocator) {
-      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(13);
+      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(18);
       static_cast<::grpc::internal::CallbackUnaryHandler< ::oram_impl::KeyExchangeRequest, ::oram_impl::KeyExchangeResponse>*>(handler)
               ->SetMessageAllocator(allocator);
     }
@@ -1219,13 +1585,13 @@ class oram_server final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithCallbackMethod_SendHello() {
-      ::grpc::Service::MarkMethodCallback(14,
+      ::grpc::Service::MarkMethodCallback(19,
           new ::grpc::internal::CallbackUnaryHandler< ::oram_impl::HelloMessage, ::google::protobuf::Empty>(
             [this](
                    ::grpc::CallbackServerContext* context, const ::oram_impl::HelloMessage* request, ::google::protobuf::Empty* response) { return this->SendHello(context, request, response); }));}
     void SetMessageAllocatorFor_SendHello(
         ::grpc::MessageAllocator< ::oram_impl::HelloMessage, ::google::protobuf::Empty>* allocator) {
-      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(14);
+      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(19);
       static_cast<::grpc::internal::CallbackUnaryHandler< ::oram_impl::HelloMessage, ::google::protobuf::Empty>*>(handler)
               ->SetMessageAllocator(allocator);
     }
@@ -1246,13 +1612,13 @@ class oram_server final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithCallbackMethod_ReportServerInformation() {
-      ::grpc::Service::MarkMethodCallback(15,
+      ::grpc::Service::MarkMethodCallback(20,
           new ::grpc::internal::CallbackUnaryHandler< ::google::protobuf::Empty, ::google::protobuf::Empty>(
             [this](
                    ::grpc::CallbackServerContext* context, const ::google::protobuf::Empty* request, ::google::protobuf::Empty* response) { return this->ReportServerInformation(context, request, response); }));}
     void SetMessageAllocatorFor_ReportServerInformation(
         ::grpc::MessageAllocator< ::google::protobuf::Empty, ::google::protobuf::Empty>* allocator) {
-      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(15);
+      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(20);
       static_cast<::grpc::internal::CallbackUnaryHandler< ::google::protobuf::Empty, ::google::protobuf::Empty>*>(handler)
               ->SetMessageAllocator(allocator);
     }
@@ -1273,13 +1639,13 @@ class oram_server final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithCallbackMethod_ResetServer() {
-      ::grpc::Service::MarkMethodCallback(16,
+      ::grpc::Service::MarkMethodCallback(21,
           new ::grpc::internal::CallbackUnaryHandler< ::google::protobuf::Empty, ::google::protobuf::Empty>(
             [this](
                    ::grpc::CallbackServerContext* context, const ::google::protobuf::Empty* request, ::google::protobuf::Empty* response) { return this->ResetServer(context, request, response); }));}
     void SetMessageAllocatorFor_ResetServer(
         ::grpc::MessageAllocator< ::google::protobuf::Empty, ::google::protobuf::Empty>* allocator) {
-      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(16);
+      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(21);
       static_cast<::grpc::internal::CallbackUnaryHandler< ::google::protobuf::Empty, ::google::protobuf::Empty>*>(handler)
               ->SetMessageAllocator(allocator);
     }
@@ -1294,7 +1660,7 @@ class oram_server final {
     virtual ::grpc::ServerUnaryReactor* ResetServer(
       ::grpc::CallbackServerContext* /*context*/, const ::google::protobuf::Empty* /*request*/, ::google::protobuf::Empty* /*response*/)  { return nullptr; }
   };
-  typedef WithCallbackMethod_InitTreeOram<WithCallbackMethod_InitFlatOram<WithCallbackMethod_InitSqrtOram<WithCallbackMethod_LoadSqrtOram<WithCallbackMethod_PrintOramTree<WithCallbackMethod_ReadPath<WithCallbackMethod_WritePath<WithCallbackMethod_ReadFlatMemory<WithCallbackMethod_WriteFlatMemory<WithCallbackMethod_ReadSqrtMemory<WithCallbackMethod_WriteSqrtMemory<WithCallbackMethod_SqrtPermute<WithCallbackMethod_CloseConnection<WithCallbackMethod_KeyExchange<WithCallbackMethod_SendHello<WithCallbackMethod_ReportServerInformation<WithCallbackMethod_ResetServer<Service > > > > > > > > > > > > > > > > > CallbackService;
+  typedef WithCallbackMethod_InitTreeOram<WithCallbackMethod_InitFlatOram<WithCallbackMethod_InitSqrtOram<WithCallbackMethod_LoadSqrtOram<WithCallbackMethod_BulkLoad<WithCallbackMethod_PrintOramTree<WithCallbackMethod_ReadPath<WithCallbackMethod_WritePath<WithCallbackMethod_ReadFullPath<WithCallbackMethod_WriteFullPath<WithCallbackMethod_ReadSlots<WithCallbackMethod_WriteSlots<WithCallbackMethod_ReadFlatMemory<WithCallbackMethod_WriteFlatMemory<WithCallbackMethod_ReadSqrtMemory<WithCallbackMethod_WriteSqrtMemory<WithCallbackMethod_SqrtPermute<WithCallbackMethod_CloseConnection<WithCallbackMethod_KeyExchange<WithCallbackMethod_SendHello<WithCallbackMethod_ReportServerInformation<WithCallbackMethod_ResetServer<Service > > > > > > > > > > > > > > > > > > > > > > CallbackService;
   typedef CallbackService ExperimentalCallbackService;
   template <class BaseClass>
   class WithGenericMethod_InitTreeOram : public BaseClass {
@@ -1365,12 +1731,29 @@ class oram_server final {
     }
   };
   template <class BaseClass>
+  class WithGenericMethod_BulkLoad : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithGenericMethod_BulkLoad() {
+      ::grpc::Service::MarkMethodGeneric(4);
+    }
+    ~WithGenericMethod_BulkLoad() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status BulkLoad(::grpc::ServerContext* /*context*/, ::grpc::ServerReader< ::oram_impl::BulkLoadRequest>* /*reader*/, ::google::protobuf::Empty* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+  };
+  template <class BaseClass>
   class WithGenericMethod_PrintOramTree : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithGenericMethod_PrintOramTree() {
-      ::grpc::Service::MarkMethodGeneric(4);
+      ::grpc::Service::MarkMethodGeneric(5);
     }
     ~WithGenericMethod_PrintOramTree() override {
       BaseClassMustBeDerivedFromService(this);
@@ -1387,7 +1770,7 @@ class oram_server final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithGenericMethod_ReadPath() {
-      ::grpc::Service::MarkMethodGeneric(5);
+      ::grpc::Service::MarkMethodGeneric(6);
     }
     ~WithGenericMethod_ReadPath() override {
       BaseClassMustBeDerivedFromService(this);
@@ -1404,7 +1787,7 @@ class oram_server final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithGenericMethod_WritePath() {
-      ::grpc::Service::MarkMethodGeneric(6);
+      ::grpc::Service::MarkMethodGeneric(7);
     }
     ~WithGenericMethod_WritePath() override {
       BaseClassMustBeDerivedFromService(this);
@@ -1416,12 +1799,80 @@ class oram_server final {
     }
   };
   template <class BaseClass>
+  class WithGenericMethod_ReadFullPath : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithGenericMethod_ReadFullPath() {
+      ::grpc::Service::MarkMethodGeneric(8);
+    }
+    ~WithGenericMethod_ReadFullPath() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status ReadFullPath(::grpc::ServerContext* /*context*/, const ::oram_impl::ReadFullPathRequest* /*request*/, ::oram_impl::ReadFullPathResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+  };
+  template <class BaseClass>
+  class WithGenericMethod_WriteFullPath : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithGenericMethod_WriteFullPath() {
+      ::grpc::Service::MarkMethodGeneric(9);
+    }
+    ~WithGenericMethod_WriteFullPath() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status WriteFullPath(::grpc::ServerContext* /*context*/, const ::oram_impl::WriteFullPathRequest* /*request*/, ::oram_impl::WritePathResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+  };
+  template <class BaseClass>
+  class WithGenericMethod_ReadSlots : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithGenericMethod_ReadSlots() {
+      ::grpc::Service::MarkMethodGeneric(10);
+    }
+    ~WithGenericMethod_ReadSlots() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status ReadSlots(::grpc::ServerContext* /*context*/, const ::oram_impl::ReadSlotsRequest* /*request*/, ::oram_impl::ReadFullPathResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+  };
+  template <class BaseClass>
+  class WithGenericMethod_WriteSlots : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithGenericMethod_WriteSlots() {
+      ::grpc::Service::MarkMethodGeneric(11);
+    }
+    ~WithGenericMethod_WriteSlots() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status WriteSlots(::grpc::ServerContext* /*context*/, const ::oram_impl::WriteSlotsRequest* /*request*/, ::oram_impl::WritePathResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+  };
+  template <class BaseClass>
   class WithGenericMethod_ReadFlatMemory : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithGenericMethod_ReadFlatMemory() {
-      ::grpc::Service::MarkMethodGeneric(7);
+      ::grpc::Service::MarkMethodGeneric(12);
     }
     ~WithGenericMethod_ReadFlatMemory() override {
       BaseClassMustBeDerivedFromService(this);
@@ -1438,7 +1889,7 @@ class oram_server final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithGenericMethod_WriteFlatMemory() {
-      ::grpc::Service::MarkMethodGeneric(8);
+      ::grpc::Service::MarkMethodGeneric(13);
     }
     ~WithGenericMethod_WriteFlatMemory() override {
       BaseClassMustBeDerivedFromService(this);
@@ -1455,7 +1906,7 @@ class oram_server final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithGenericMethod_ReadSqrtMemory() {
-      ::grpc::Service::MarkMethodGeneric(9);
+      ::grpc::Service::MarkMethodGeneric(14);
     }
     ~WithGenericMethod_ReadSqrtMemory() override {
       BaseClassMustBeDerivedFromService(this);
@@ -1472,7 +1923,7 @@ class oram_server final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithGenericMethod_WriteSqrtMemory() {
-      ::grpc::Service::MarkMethodGeneric(10);
+      ::grpc::Service::MarkMethodGeneric(15);
     }
     ~WithGenericMethod_WriteSqrtMemory() override {
       BaseClassMustBeDerivedFromService(this);
@@ -1489,7 +1940,7 @@ class oram_server final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithGenericMethod_SqrtPermute() {
-      ::grpc::Service::MarkMethodGeneric(11);
+      ::grpc::Service::MarkMethodGeneric(16);
     }
     ~WithGenericMethod_SqrtPermute() override {
       BaseClassMustBeDerivedFromService(this);
@@ -1506,7 +1957,7 @@ class oram_server final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithGenericMethod_CloseConnection() {
-      ::grpc::Service::MarkMethodGeneric(12);
+      ::grpc::Service::MarkMethodGeneric(17);
     }
     ~WithGenericMethod_CloseConnection() override {
       BaseClassMustBeDerivedFromService(this);
@@ -1523,7 +1974,7 @@ class oram_server final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithGenericMethod_KeyExchange() {
-      ::grpc::Service::MarkMethodGeneric(13);
+      ::grpc::Service::MarkMethodGeneric(18);
     }
     ~WithGenericMethod_KeyExchange() override {
       BaseClassMustBeDerivedFromService(this);
@@ -1540,7 +1991,7 @@ class oram_server final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithGenericMethod_SendHello() {
-      ::grpc::Service::MarkMethodGeneric(14);
+      ::grpc::Service::MarkMethodGeneric(19);
     }
     ~WithGenericMethod_SendHello() override {
       BaseClassMustBeDerivedFromService(this);
@@ -1557,7 +2008,7 @@ class oram_server final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithGenericMethod_ReportServerInformation() {
-      ::grpc::Service::MarkMethodGeneric(15);
+      ::grpc::Service::MarkMethodGeneric(20);
     }
     ~WithGenericMethod_ReportServerInformation() override {
       BaseClassMustBeDerivedFromService(this);
@@ -1574,7 +2025,7 @@ class oram_server final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithGenericMethod_ResetServer() {
-      ::grpc::Service::MarkMethodGeneric(16);
+      ::grpc::Service::MarkMethodGeneric(21);
     }
     ~WithGenericMethod_ResetServer() override {
       BaseClassMustBeDerivedFromService(this);
@@ -1666,12 +2117,32 @@ class oram_server final {
     }
   };
   template <class BaseClass>
+  class WithRawMethod_BulkLoad : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawMethod_BulkLoad() {
+      ::grpc::Service::MarkMethodRaw(4);
+    }
+    ~WithRawMethod_BulkLoad() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status BulkLoad(::grpc::ServerContext* /*context*/, ::grpc::ServerReader< ::oram_impl::BulkLoadRequest>* /*reader*/, ::google::protobuf::Empty* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestBulkLoad(::grpc::ServerContext* context, ::grpc::ServerAsyncReader< ::grpc::ByteBuffer, ::grpc::ByteBuffer>* reader, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncClientStreaming(4, context, reader, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
   class WithRawMethod_PrintOramTree : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithRawMethod_PrintOramTree() {
-      ::grpc::Service::MarkMethodRaw(4);
+      ::grpc::Service::MarkMethodRaw(5);
     }
     ~WithRawMethod_PrintOramTree() override {
       BaseClassMustBeDerivedFromService(this);
@@ -1682,7 +2153,7 @@ class oram_server final {
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
     void RequestPrintOramTree(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
-      ::grpc::Service::RequestAsyncUnary(4, context, request, response, new_call_cq, notification_cq, tag);
+      ::grpc::Service::RequestAsyncUnary(5, context, request, response, new_call_cq, notification_cq, tag);
     }
   };
   template <class BaseClass>
@@ -1691,7 +2162,7 @@ class oram_server final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithRawMethod_ReadPath() {
-      ::grpc::Service::MarkMethodRaw(5);
+      ::grpc::Service::MarkMethodRaw(6);
     }
     ~WithRawMethod_ReadPath() override {
       BaseClassMustBeDerivedFromService(this);
@@ -1702,7 +2173,7 @@ class oram_server final {
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
     void RequestReadPath(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
-      ::grpc::Service::RequestAsyncUnary(5, context, request, response, new_call_cq, notification_cq, tag);
+      ::grpc::Service::RequestAsyncUnary(6, context, request, response, new_call_cq, notification_cq, tag);
     }
   };
   template <class BaseClass>
@@ -1711,7 +2182,7 @@ class oram_server final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithRawMethod_WritePath() {
-      ::grpc::Service::MarkMethodRaw(6);
+      ::grpc::Service::MarkMethodRaw(7);
     }
     ~WithRawMethod_WritePath() override {
       BaseClassMustBeDerivedFromService(this);
@@ -1722,7 +2193,87 @@ class oram_server final {
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
     void RequestWritePath(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
-      ::grpc::Service::RequestAsyncUnary(6, context, request, response, new_call_cq, notification_cq, tag);
+      ::grpc::Service::RequestAsyncUnary(7, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithRawMethod_ReadFullPath : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawMethod_ReadFullPath() {
+      ::grpc::Service::MarkMethodRaw(8);
+    }
+    ~WithRawMethod_ReadFullPath() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status ReadFullPath(::grpc::ServerContext* /*context*/, const ::oram_impl::ReadFullPathRequest* /*request*/, ::oram_impl::ReadFullPathResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestReadFullPath(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(8, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithRawMethod_WriteFullPath : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawMethod_WriteFullPath() {
+      ::grpc::Service::MarkMethodRaw(9);
+    }
+    ~WithRawMethod_WriteFullPath() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status WriteFullPath(::grpc::ServerContext* /*context*/, const ::oram_impl::WriteFullPathRequest* /*request*/, ::oram_impl::WritePathResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestWriteFullPath(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(9, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithRawMethod_ReadSlots : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawMethod_ReadSlots() {
+      ::grpc::Service::MarkMethodRaw(10);
+    }
+    ~WithRawMethod_ReadSlots() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status ReadSlots(::grpc::ServerContext* /*context*/, const ::oram_impl::ReadSlotsRequest* /*request*/, ::oram_impl::ReadFullPathResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestReadSlots(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(10, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithRawMethod_WriteSlots : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawMethod_WriteSlots() {
+      ::grpc::Service::MarkMethodRaw(11);
+    }
+    ~WithRawMethod_WriteSlots() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status WriteSlots(::grpc::ServerContext* /*context*/, const ::oram_impl::WriteSlotsRequest* /*request*/, ::oram_impl::WritePathResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestWriteSlots(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(11, context, request, response, new_call_cq, notification_cq, tag);
     }
   };
   template <class BaseClass>
@@ -1731,7 +2282,7 @@ class oram_server final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithRawMethod_ReadFlatMemory() {
-      ::grpc::Service::MarkMethodRaw(7);
+      ::grpc::Service::MarkMethodRaw(12);
     }
     ~WithRawMethod_ReadFlatMemory() override {
       BaseClassMustBeDerivedFromService(this);
@@ -1742,7 +2293,7 @@ class oram_server final {
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
     void RequestReadFlatMemory(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
-      ::grpc::Service::RequestAsyncUnary(7, context, request, response, new_call_cq, notification_cq, tag);
+      ::grpc::Service::RequestAsyncUnary(12, context, request, response, new_call_cq, notification_cq, tag);
     }
   };
   template <class BaseClass>
@@ -1751,7 +2302,7 @@ class oram_server final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithRawMethod_WriteFlatMemory() {
-      ::grpc::Service::MarkMethodRaw(8);
+      ::grpc::Service::MarkMethodRaw(13);
     }
     ~WithRawMethod_WriteFlatMemory() override {
       BaseClassMustBeDerivedFromService(this);
@@ -1762,7 +2313,7 @@ class oram_server final {
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
     void RequestWriteFlatMemory(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
-      ::grpc::Service::RequestAsyncUnary(8, context, request, response, new_call_cq, notification_cq, tag);
+      ::grpc::Service::RequestAsyncUnary(13, context, request, response, new_call_cq, notification_cq, tag);
     }
   };
   template <class BaseClass>
@@ -1771,7 +2322,7 @@ class oram_server final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithRawMethod_ReadSqrtMemory() {
-      ::grpc::Service::MarkMethodRaw(9);
+      ::grpc::Service::MarkMethodRaw(14);
     }
     ~WithRawMethod_ReadSqrtMemory() override {
       BaseClassMustBeDerivedFromService(this);
@@ -1782,7 +2333,7 @@ class oram_server final {
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
     void RequestReadSqrtMemory(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
-      ::grpc::Service::RequestAsyncUnary(9, context, request, response, new_call_cq, notification_cq, tag);
+      ::grpc::Service::RequestAsyncUnary(14, context, request, response, new_call_cq, notification_cq, tag);
     }
   };
   template <class BaseClass>
@@ -1791,7 +2342,7 @@ class oram_server final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithRawMethod_WriteSqrtMemory() {
-      ::grpc::Service::MarkMethodRaw(10);
+      ::grpc::Service::MarkMethodRaw(15);
     }
     ~WithRawMethod_WriteSqrtMemory() override {
       BaseClassMustBeDerivedFromService(this);
@@ -1802,7 +2353,7 @@ class oram_server final {
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
     void RequestWriteSqrtMemory(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
-      ::grpc::Service::RequestAsyncUnary(10, context, request, response, new_call_cq, notification_cq, tag);
+      ::grpc::Service::RequestAsyncUnary(15, context, request, response, new_call_cq, notification_cq, tag);
     }
   };
   template <class BaseClass>
@@ -1811,7 +2362,7 @@ class oram_server final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithRawMethod_SqrtPermute() {
-      ::grpc::Service::MarkMethodRaw(11);
+      ::grpc::Service::MarkMethodRaw(16);
     }
     ~WithRawMethod_SqrtPermute() override {
       BaseClassMustBeDerivedFromService(this);
@@ -1822,7 +2373,7 @@ class oram_server final {
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
     void RequestSqrtPermute(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
-      ::grpc::Service::RequestAsyncUnary(11, context, request, response, new_call_cq, notification_cq, tag);
+      ::grpc::Service::RequestAsyncUnary(16, context, request, response, new_call_cq, notification_cq, tag);
     }
   };
   template <class BaseClass>
@@ -1831,7 +2382,7 @@ class oram_server final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithRawMethod_CloseConnection() {
-      ::grpc::Service::MarkMethodRaw(12);
+      ::grpc::Service::MarkMethodRaw(17);
     }
     ~WithRawMethod_CloseConnection() override {
       BaseClassMustBeDerivedFromService(this);
@@ -1842,7 +2393,7 @@ class oram_server final {
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
     void RequestCloseConnection(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
-      ::grpc::Service::RequestAsyncUnary(12, context, request, response, new_call_cq, notification_cq, tag);
+      ::grpc::Service::RequestAsyncUnary(17, context, request, response, new_call_cq, notification_cq, tag);
     }
   };
   template <class BaseClass>
@@ -1851,7 +2402,7 @@ class oram_server final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithRawMethod_KeyExchange() {
-      ::grpc::Service::MarkMethodRaw(13);
+      ::grpc::Service::MarkMethodRaw(18);
     }
     ~WithRawMethod_KeyExchange() override {
       BaseClassMustBeDerivedFromService(this);
@@ -1862,7 +2413,7 @@ class oram_server final {
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
     void RequestKeyExchange(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
-      ::grpc::Service::RequestAsyncUnary(13, context, request, response, new_call_cq, notification_cq, tag);
+      ::grpc::Service::RequestAsyncUnary(18, context, request, response, new_call_cq, notification_cq, tag);
     }
   };
   template <class BaseClass>
@@ -1871,7 +2422,7 @@ class oram_server final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithRawMethod_SendHello() {
-      ::grpc::Service::MarkMethodRaw(14);
+      ::grpc::Service::MarkMethodRaw(19);
     }
     ~WithRawMethod_SendHello() override {
       BaseClassMustBeDerivedFromService(this);
@@ -1882,7 +2433,7 @@ class oram_server final {
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
     void RequestSendHello(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
-      ::grpc::Service::RequestAsyncUnary(14, context, request, response, new_call_cq, notification_cq, tag);
+      ::grpc::Service::RequestAsyncUnary(19, context, request, response, new_call_cq, notification_cq, tag);
     }
   };
   template <class BaseClass>
@@ -1891,7 +2442,7 @@ class oram_server final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithRawMethod_ReportServerInformation() {
-      ::grpc::Service::MarkMethodRaw(15);
+      ::grpc::Service::MarkMethodRaw(20);
     }
     ~WithRawMethod_ReportServerInformation() override {
       BaseClassMustBeDerivedFromService(this);
@@ -1902,7 +2453,7 @@ class oram_server final {
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
     void RequestReportServerInformation(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
-      ::grpc::Service::RequestAsyncUnary(15, context, request, response, new_call_cq, notification_cq, tag);
+      ::grpc::Service::RequestAsyncUnary(20, context, request, response, new_call_cq, notification_cq, tag);
     }
   };
   template <class BaseClass>
@@ -1911,7 +2462,7 @@ class oram_server final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithRawMethod_ResetServer() {
-      ::grpc::Service::MarkMethodRaw(16);
+      ::grpc::Service::MarkMethodRaw(21);
     }
     ~WithRawMethod_ResetServer() override {
       BaseClassMustBeDerivedFromService(this);
@@ -1922,7 +2473,7 @@ class oram_server final {
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
     void RequestResetServer(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
-      ::grpc::Service::RequestAsyncUnary(16, context, request, response, new_call_cq, notification_cq, tag);
+      ::grpc::Service::RequestAsyncUnary(21, context, request, response, new_call_cq, notification_cq, tag);
     }
   };
   template <class BaseClass>
@@ -2014,12 +2565,34 @@ class oram_server final {
       ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
   };
   template <class BaseClass>
+  class WithRawCallbackMethod_BulkLoad : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawCallbackMethod_BulkLoad() {
+      ::grpc::Service::MarkMethodRawCallback(4,
+          new ::grpc::internal::CallbackClientStreamingHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
+            [this](
+                   ::grpc::CallbackServerContext* context, ::grpc::ByteBuffer* response) { return this->BulkLoad(context, response); }));
+    }
+    ~WithRawCallbackMethod_BulkLoad() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status BulkLoad(::grpc::ServerContext* /*context*/, ::grpc::ServerReader< ::oram_impl::BulkLoadRequest>* /*reader*/, ::google::protobuf::Empty* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerReadReactor< ::grpc::ByteBuffer>* BulkLoad(
+      ::grpc::CallbackServerContext* /*context*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
   class WithRawCallbackMethod_PrintOramTree : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithRawCallbackMethod_PrintOramTree() {
-      ::grpc::Service::MarkMethodRawCallback(4,
+      ::grpc::Service::MarkMethodRawCallback(5,
           new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
             [this](
                    ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->PrintOramTree(context, request, response); }));
@@ -2041,7 +2614,7 @@ class oram_server final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithRawCallbackMethod_ReadPath() {
-      ::grpc::Service::MarkMethodRawCallback(5,
+      ::grpc::Service::MarkMethodRawCallback(6,
           new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
             [this](
                    ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->ReadPath(context, request, response); }));
@@ -2063,7 +2636,7 @@ class oram_server final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithRawCallbackMethod_WritePath() {
-      ::grpc::Service::MarkMethodRawCallback(6,
+      ::grpc::Service::MarkMethodRawCallback(7,
           new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
             [this](
                    ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->WritePath(context, request, response); }));
@@ -2080,12 +2653,100 @@ class oram_server final {
       ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
   };
   template <class BaseClass>
+  class WithRawCallbackMethod_ReadFullPath : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawCallbackMethod_ReadFullPath() {
+      ::grpc::Service::MarkMethodRawCallback(8,
+          new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->ReadFullPath(context, request, response); }));
+    }
+    ~WithRawCallbackMethod_ReadFullPath() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status ReadFullPath(::grpc::ServerContext* /*context*/, const ::oram_impl::ReadFullPathRequest* /*request*/, ::oram_impl::ReadFullPathResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* ReadFullPath(
+      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithRawCallbackMethod_WriteFullPath : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawCallbackMethod_WriteFullPath() {
+      ::grpc::Service::MarkMethodRawCallback(9,
+          new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->WriteFullPath(context, request, response); }));
+    }
+    ~WithRawCallbackMethod_WriteFullPath() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status WriteFullPath(::grpc::ServerContext* /*context*/, const ::oram_impl::WriteFullPathRequest* /*request*/, ::oram_impl::WritePathResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* WriteFullPath(
+      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithRawCallbackMethod_ReadSlots : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawCallbackMethod_ReadSlots() {
+      ::grpc::Service::MarkMethodRawCallback(10,
+          new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->ReadSlots(context, request, response); }));
+    }
+    ~WithRawCallbackMethod_ReadSlots() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status ReadSlots(::grpc::ServerContext* /*context*/, const ::oram_impl::ReadSlotsRequest* /*request*/, ::oram_impl::ReadFullPathResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* ReadSlots(
+      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithRawCallbackMethod_WriteSlots : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawCallbackMethod_WriteSlots() {
+      ::grpc::Service::MarkMethodRawCallback(11,
+          new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->WriteSlots(context, request, response); }));
+    }
+    ~WithRawCallbackMethod_WriteSlots() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status WriteSlots(::grpc::ServerContext* /*context*/, const ::oram_impl::WriteSlotsRequest* /*request*/, ::oram_impl::WritePathResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* WriteSlots(
+      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
   class WithRawCallbackMethod_ReadFlatMemory : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithRawCallbackMethod_ReadFlatMemory() {
-      ::grpc::Service::MarkMethodRawCallback(7,
+      ::grpc::Service::MarkMethodRawCallback(12,
           new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
             [this](
                    ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->ReadFlatMemory(context, request, response); }));
@@ -2107,7 +2768,7 @@ class oram_server final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithRawCallbackMethod_WriteFlatMemory() {
-      ::grpc::Service::MarkMethodRawCallback(8,
+      ::grpc::Service::MarkMethodRawCallback(13,
           new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
             [this](
                    ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->WriteFlatMemory(context, request, response); }));
@@ -2129,7 +2790,7 @@ class oram_server final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithRawCallbackMethod_ReadSqrtMemory() {
-      ::grpc::Service::MarkMethodRawCallback(9,
+      ::grpc::Service::MarkMethodRawCallback(14,
           new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
             [this](
                    ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->ReadSqrtMemory(context, request, response); }));
@@ -2151,7 +2812,7 @@ class oram_server final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithRawCallbackMethod_WriteSqrtMemory() {
-      ::grpc::Service::MarkMethodRawCallback(10,
+      ::grpc::Service::MarkMethodRawCallback(15,
           new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
             [this](
                    ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->WriteSqrtMemory(context, request, response); }));
@@ -2173,7 +2834,7 @@ class oram_server final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithRawCallbackMethod_SqrtPermute() {
-      ::grpc::Service::MarkMethodRawCallback(11,
+      ::grpc::Service::MarkMethodRawCallback(16,
           new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
             [this](
                    ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->SqrtPermute(context, request, response); }));
@@ -2195,7 +2856,7 @@ class oram_server final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithRawCallbackMethod_CloseConnection() {
-      ::grpc::Service::MarkMethodRawCallback(12,
+      ::grpc::Service::MarkMethodRawCallback(17,
           new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
             [this](
                    ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->CloseConnection(context, request, response); }));
@@ -2217,7 +2878,7 @@ class oram_server final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithRawCallbackMethod_KeyExchange() {
-      ::grpc::Service::MarkMethodRawCallback(13,
+      ::grpc::Service::MarkMethodRawCallback(18,
           new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
             [this](
                    ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->KeyExchange(context, request, response); }));
@@ -2239,7 +2900,7 @@ class oram_server final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithRawCallbackMethod_SendHello() {
-      ::grpc::Service::MarkMethodRawCallback(14,
+      ::grpc::Service::MarkMethodRawCallback(19,
           new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
             [this](
                    ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->SendHello(context, request, response); }));
@@ -2261,7 +2922,7 @@ class oram_server final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithRawCallbackMethod_ReportServerInformation() {
-      ::grpc::Service::MarkMethodRawCallback(15,
+      ::grpc::Service::MarkMethodRawCallback(20,
           new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
             [this](
                    ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->ReportServerInformation(context, request, response); }));
@@ -2283,7 +2944,7 @@ class oram_server final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithRawCallbackMethod_ResetServer() {
-      ::grpc::Service::MarkMethodRawCallback(16,
+      ::grpc::Service::MarkMethodRawCallback(21,
           new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
             [this](
                    ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->ResetServer(context, request, response); }));
@@ -2413,7 +3074,7 @@ class oram_server final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithStreamedUnaryMethod_PrintOramTree() {
-      ::grpc::Service::MarkMethodStreamed(4,
+      ::grpc::Service::MarkMethodStreamed(5,
         new ::grpc::internal::StreamedUnaryHandler<
           ::oram_impl::PrintOramTreeRequest, ::google::protobuf::Empty>(
             [this](::grpc::ServerContext* context,
@@ -2440,7 +3101,7 @@ class oram_server final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithStreamedUnaryMethod_ReadPath() {
-      ::grpc::Service::MarkMethodStreamed(5,
+      ::grpc::Service::MarkMethodStreamed(6,
         new ::grpc::internal::StreamedUnaryHandler<
           ::oram_impl::ReadPathRequest, ::oram_impl::ReadPathResponse>(
             [this](::grpc::ServerContext* context,
@@ -2467,7 +3128,7 @@ class oram_server final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithStreamedUnaryMethod_WritePath() {
-      ::grpc::Service::MarkMethodStreamed(6,
+      ::grpc::Service::MarkMethodStreamed(7,
         new ::grpc::internal::StreamedUnaryHandler<
           ::oram_impl::WritePathRequest, ::oram_impl::WritePathResponse>(
             [this](::grpc::ServerContext* context,
@@ -2489,12 +3150,120 @@ class oram_server final {
     virtual ::grpc::Status StreamedWritePath(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< ::oram_impl::WritePathRequest,::oram_impl::WritePathResponse>* server_unary_streamer) = 0;
   };
   template <class BaseClass>
+  class WithStreamedUnaryMethod_ReadFullPath : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithStreamedUnaryMethod_ReadFullPath() {
+      ::grpc::Service::MarkMethodStreamed(8,
+        new ::grpc::internal::StreamedUnaryHandler<
+          ::oram_impl::ReadFullPathRequest, ::oram_impl::ReadFullPathResponse>(
+            [this](::grpc::ServerContext* context,
+                   ::grpc::ServerUnaryStreamer<
+                     ::oram_impl::ReadFullPathRequest, ::oram_impl::ReadFullPathResponse>* streamer) {
+                       return this->StreamedReadFullPath(context,
+                         streamer);
+                  }));
+    }
+    ~WithStreamedUnaryMethod_ReadFullPath() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable regular version of this method
+    ::grpc::Status ReadFullPath(::grpc::ServerContext* /*context*/, const ::oram_impl::ReadFullPathRequest* /*request*/, ::oram_impl::ReadFullPathResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    // replace default version of method with streamed unary
+    virtual ::grpc::Status StreamedReadFullPath(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< ::oram_impl::ReadFullPathRequest,::oram_impl::ReadFullPathResponse>* server_unary_streamer) = 0;
+  };
+  template <class BaseClass>
+  class WithStreamedUnaryMethod_WriteFullPath : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithStreamedUnaryMethod_WriteFullPath() {
+      ::grpc::Service::MarkMethodStreamed(9,
+        new ::grpc::internal::StreamedUnaryHandler<
+          ::oram_impl::WriteFullPathRequest, ::oram_impl::WritePathResponse>(
+            [this](::grpc::ServerContext* context,
+                   ::grpc::ServerUnaryStreamer<
+                     ::oram_impl::WriteFullPathRequest, ::oram_impl::WritePathResponse>* streamer) {
+                       return this->StreamedWriteFullPath(context,
+                         streamer);
+                  }));
+    }
+    ~WithStreamedUnaryMethod_WriteFullPath() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable regular version of this method
+    ::grpc::Status WriteFullPath(::grpc::ServerContext* /*context*/, const ::oram_impl::WriteFullPathRequest* /*request*/, ::oram_impl::WritePathResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    // replace default version of method with streamed unary
+    virtual ::grpc::Status StreamedWriteFullPath(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< ::oram_impl::WriteFullPathRequest,::oram_impl::WritePathResponse>* server_unary_streamer) = 0;
+  };
+  template <class BaseClass>
+  class WithStreamedUnaryMethod_ReadSlots : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithStreamedUnaryMethod_ReadSlots() {
+      ::grpc::Service::MarkMethodStreamed(10,
+        new ::grpc::internal::StreamedUnaryHandler<
+          ::oram_impl::ReadSlotsRequest, ::oram_impl::ReadFullPathResponse>(
+            [this](::grpc::ServerContext* context,
+                   ::grpc::ServerUnaryStreamer<
+                     ::oram_impl::ReadSlotsRequest, ::oram_impl::ReadFullPathResponse>* streamer) {
+                       return this->StreamedReadSlots(context,
+                         streamer);
+                  }));
+    }
+    ~WithStreamedUnaryMethod_ReadSlots() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable regular version of this method
+    ::grpc::Status ReadSlots(::grpc::ServerContext* /*context*/, const ::oram_impl::ReadSlotsRequest* /*request*/, ::oram_impl::ReadFullPathResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    // replace default version of method with streamed unary
+    virtual ::grpc::Status StreamedReadSlots(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< ::oram_impl::ReadSlotsRequest,::oram_impl::ReadFullPathResponse>* server_unary_streamer) = 0;
+  };
+  template <class BaseClass>
+  class WithStreamedUnaryMethod_WriteSlots : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithStreamedUnaryMethod_WriteSlots() {
+      ::grpc::Service::MarkMethodStreamed(11,
+        new ::grpc::internal::StreamedUnaryHandler<
+          ::oram_impl::WriteSlotsRequest, ::oram_impl::WritePathResponse>(
+            [this](::grpc::ServerContext* context,
+                   ::grpc::ServerUnaryStreamer<
+                     ::oram_impl::WriteSlotsRequest, ::oram_impl::WritePathResponse>* streamer) {
+                       return this->StreamedWriteSlots(context,
+                         streamer);
+                  }));
+    }
+    ~WithStreamedUnaryMethod_WriteSlots() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable regular version of this method
+    ::grpc::Status WriteSlots(::grpc::ServerContext* /*context*/, const ::oram_impl::WriteSlotsRequest* /*request*/, ::oram_impl::WritePathResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    // replace default version of method with streamed unary
+    virtual ::grpc::Status StreamedWriteSlots(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< ::oram_impl::WriteSlotsRequest,::oram_impl::WritePathResponse>* server_unary_streamer) = 0;
+  };
+  template <class BaseClass>
   class WithStreamedUnaryMethod_ReadFlatMemory : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithStreamedUnaryMethod_ReadFlatMemory() {
-      ::grpc::Service::MarkMethodStreamed(7,
+      ::grpc::Service::MarkMethodStreamed(12,
         new ::grpc::internal::StreamedUnaryHandler<
           ::oram_impl::ReadFlatRequest, ::oram_impl::FlatVectorMessage>(
             [this](::grpc::ServerContext* context,
@@ -2521,7 +3290,7 @@ class oram_server final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithStreamedUnaryMethod_WriteFlatMemory() {
-      ::grpc::Service::MarkMethodStreamed(8,
+      ::grpc::Service::MarkMethodStreamed(13,
         new ::grpc::internal::StreamedUnaryHandler<
           ::oram_impl::FlatVectorMessage, ::google::protobuf::Empty>(
             [this](::grpc::ServerContext* context,
@@ -2548,7 +3317,7 @@ class oram_server final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithStreamedUnaryMethod_ReadSqrtMemory() {
-      ::grpc::Service::MarkMethodStreamed(9,
+      ::grpc::Service::MarkMethodStreamed(14,
         new ::grpc::internal::StreamedUnaryHandler<
           ::oram_impl::ReadSqrtRequest, ::oram_impl::SqrtMessage>(
             [this](::grpc::ServerContext* context,
@@ -2575,7 +3344,7 @@ class oram_server final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithStreamedUnaryMethod_WriteSqrtMemory() {
-      ::grpc::Service::MarkMethodStreamed(10,
+      ::grpc::Service::MarkMethodStreamed(15,
         new ::grpc::internal::StreamedUnaryHandler<
           ::oram_impl::WriteSqrtMessage, ::google::protobuf::Empty>(
             [this](::grpc::ServerContext* context,
@@ -2602,7 +3371,7 @@ class oram_server final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithStreamedUnaryMethod_SqrtPermute() {
-      ::grpc::Service::MarkMethodStreamed(11,
+      ::grpc::Service::MarkMethodStreamed(16,
         new ::grpc::internal::StreamedUnaryHandler<
           ::oram_impl::SqrtPermMessage, ::google::protobuf::Empty>(
             [this](::grpc::ServerContext* context,
@@ -2629,7 +3398,7 @@ class oram_server final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithStreamedUnaryMethod_CloseConnection() {
-      ::grpc::Service::MarkMethodStreamed(12,
+      ::grpc::Service::MarkMethodStreamed(17,
         new ::grpc::internal::StreamedUnaryHandler<
           ::google::protobuf::Empty, ::google::protobuf::Empty>(
             [this](::grpc::ServerContext* context,
@@ -2656,7 +3425,7 @@ class oram_server final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithStreamedUnaryMethod_KeyExchange() {
-      ::grpc::Service::MarkMethodStreamed(13,
+      ::grpc::Service::MarkMethodStreamed(18,
         new ::grpc::internal::StreamedUnaryHandler<
           ::oram_impl::KeyExchangeRequest, ::oram_impl::KeyExchangeResponse>(
             [this](::grpc::ServerContext* context,
@@ -2683,7 +3452,7 @@ class oram_server final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithStreamedUnaryMethod_SendHello() {
-      ::grpc::Service::MarkMethodStreamed(14,
+      ::grpc::Service::MarkMethodStreamed(19,
         new ::grpc::internal::StreamedUnaryHandler<
           ::oram_impl::HelloMessage, ::google::protobuf::Empty>(
             [this](::grpc::ServerContext* context,
@@ -2710,7 +3479,7 @@ class oram_server final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithStreamedUnaryMethod_ReportServerInformation() {
-      ::grpc::Service::MarkMethodStreamed(15,
+      ::grpc::Service::MarkMethodStreamed(20,
         new ::grpc::internal::StreamedUnaryHandler<
           ::google::protobuf::Empty, ::google::protobuf::Empty>(
             [this](::grpc::ServerContext* context,
@@ -2737,7 +3506,7 @@ class oram_server final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithStreamedUnaryMethod_ResetServer() {
-      ::grpc::Service::MarkMethodStreamed(16,
+      ::grpc::Service::MarkMethodStreamed(21,
         new ::grpc::internal::StreamedUnaryHandler<
           ::google::protobuf::Empty, ::google::protobuf::Empty>(
             [this](::grpc::ServerContext* context,
@@ -2758,9 +3527,9 @@ class oram_server final {
     // replace default version of method with streamed unary
     virtual ::grpc::Status StreamedResetServer(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< ::google::protobuf::Empty,::google::protobuf::Empty>* server_unary_streamer) = 0;
   };
-  typedef WithStreamedUnaryMethod_InitTreeOram<WithStreamedUnaryMethod_InitFlatOram<WithStreamedUnaryMethod_InitSqrtOram<WithStreamedUnaryMethod_LoadSqrtOram<WithStreamedUnaryMethod_PrintOramTree<WithStreamedUnaryMethod_ReadPath<WithStreamedUnaryMethod_WritePath<WithStreamedUnaryMethod_ReadFlatMemory<WithStreamedUnaryMethod_WriteFlatMemory<WithStreamedUnaryMethod_ReadSqrtMemory<WithStreamedUnaryMethod_WriteSqrtMemory<WithStreamedUnaryMethod_SqrtPermute<WithStreamedUnaryMethod_CloseConnection<WithStreamedUnaryMethod_KeyExchange<WithStreamedUnaryMethod_SendHello<WithStreamedUnaryMethod_ReportServerInformation<WithStreamedUnaryMethod_ResetServer<Service > > > > > > > > > > > > > > > > > StreamedUnaryService;
+  typedef WithStreamedUnaryMethod_InitTreeOram<WithStreamedUnaryMethod_InitFlatOram<WithStreamedUnaryMethod_InitSqrtOram<WithStreamedUnaryMethod_LoadSqrtOram<WithStreamedUnaryMethod_PrintOramTree<WithStreamedUnaryMethod_ReadPath<WithStreamedUnaryMethod_WritePath<WithStreamedUnaryMethod_ReadFullPath<WithStreamedUnaryMethod_WriteFullPath<WithStreamedUnaryMethod_ReadSlots<WithStreamedUnaryMethod_WriteSlots<WithStreamedUnaryMethod_ReadFlatMemory<WithStreamedUnaryMethod_WriteFlatMemory<WithStreamedUnaryMethod_ReadSqrtMemory<WithStreamedUnaryMethod_WriteSqrtMemory<WithStreamedUnaryMethod_SqrtPermute<WithStreamedUnaryMethod_CloseConnection<WithStreamedUnaryMethod_KeyExchange<WithStreamedUnaryMethod_SendHello<WithStreamedUnaryMethod_ReportServerInformation<WithStreamedUnaryMethod_ResetServer<Service > > > > > > > > > > > > > > > > > > > > > StreamedUnaryService;
   typedef Service SplitStreamedService;
-  typedef WithStreamedUnaryMethod_InitTreeOram<WithStreamedUnaryMethod_InitFlatOram<WithStreamedUnaryMethod_InitSqrtOram<WithStreamedUnaryMethod_LoadSqrtOram<WithStreamedUnaryMethod_PrintOramTree<WithStreamedUnaryMethod_ReadPath<WithStreamedUnaryMethod_WritePath<WithStreamedUnaryMethod_ReadFlatMemory<WithStreamedUnaryMethod_WriteFlatMemory<WithStreamedUnaryMethod_ReadSqrtMemory<WithStreamedUnaryMethod_WriteSqrtMemory<WithStreamedUnaryMethod_SqrtPermute<WithStreamedUnaryMethod_CloseConnection<WithStreamedUnaryMethod_KeyExchange<WithStreamedUnaryMethod_SendHello<WithStreamedUnaryMethod_ReportServerInformation<WithStreamedUnaryMethod_ResetServer<Service > > > > > > > > > > > > > > > > > StreamedService;
+  typedef WithStreamedUnaryMethod_InitTreeOram<WithStreamedUnaryMethod_InitFlatOram<WithStreamedUnaryMethod_InitSqrtOram<WithStreamedUnaryMethod_LoadSqrtOram<WithStreamedUnaryMethod_PrintOramTree<WithStreamedUnaryMethod_ReadPath<WithStreamedUnaryMethod_WritePath<WithStreamedUnaryMethod_ReadFullPath<WithStreamedUnaryMethod_WriteFullPath<WithStreamedUnaryMethod_ReadSlots<WithStreamedUnaryMethod_WriteSlots<WithStreamedUnaryMethod_ReadFlatMemory<WithStreamedUnaryMethod_WriteFlatMemory<WithStreamedUnaryMethod_ReadSqrtMemory<WithStreamedUnaryMethod_WriteSqrtMemory<WithStreamedUnaryMethod_SqrtPermute<WithStreamedUnaryMethod_CloseConnection<WithStreamedUnaryMethod_KeyExchange<WithStreamedUnaryMethod_SendHello<WithStreamedUnaryMethod_ReportServerInformation<WithStreamedUnaryMethod_ResetServer<Service > > > > > > > > > > > > > > > > > > > > > StreamedService;
 };
 
 }  // namespace oram_impl
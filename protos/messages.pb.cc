@@ -284,6 +284,138 @@ struct WritePathRequestDefaultTypeInternal {
   };
 };
 PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 WritePathRequestDefaultTypeInternal _WritePathRequest_default_instance_;
+PROTOBUF_CONSTEXPR BucketMessage::BucketMessage(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.bucket_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct BucketMessageDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR BucketMessageDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~BucketMessageDefaultTypeInternal() {}
+  union {
+    BucketMessage _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 BucketMessageDefaultTypeInternal _BucketMessage_default_instance_;
+PROTOBUF_CONSTEXPR ReadFullPathRequest::ReadFullPathRequest(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.header_)*/nullptr
+  , /*decltype(_impl_.path_)*/0u
+  , /*decltype(_impl_.start_level_)*/0u
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct ReadFullPathRequestDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ReadFullPathRequestDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ReadFullPathRequestDefaultTypeInternal() {}
+  union {
+    ReadFullPathRequest _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ReadFullPathRequestDefaultTypeInternal _ReadFullPathRequest_default_instance_;
+PROTOBUF_CONSTEXPR ReadFullPathResponse::ReadFullPathResponse(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.buckets_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct ReadFullPathResponseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ReadFullPathResponseDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ReadFullPathResponseDefaultTypeInternal() {}
+  union {
+    ReadFullPathResponse _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ReadFullPathResponseDefaultTypeInternal _ReadFullPathResponse_default_instance_;
+PROTOBUF_CONSTEXPR WriteFullPathRequest::WriteFullPathRequest(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.buckets_)*/{}
+  , /*decltype(_impl_.header_)*/nullptr
+  , /*decltype(_impl_.path_)*/0u
+  , /*decltype(_impl_.start_level_)*/0u
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct WriteFullPathRequestDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR WriteFullPathRequestDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~WriteFullPathRequestDefaultTypeInternal() {}
+  union {
+    WriteFullPathRequest _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 WriteFullPathRequestDefaultTypeInternal _WriteFullPathRequest_default_instance_;
+PROTOBUF_CONSTEXPR SlotListMessage::SlotListMessage(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.slot_)*/{}
+  , /*decltype(_impl_._slot_cached_byte_size_)*/{0}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct SlotListMessageDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR SlotListMessageDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~SlotListMessageDefaultTypeInternal() {}
+  union {
+    SlotListMessage _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 SlotListMessageDefaultTypeInternal _SlotListMessage_default_instance_;
+PROTOBUF_CONSTEXPR ReadSlotsRequest::ReadSlotsRequest(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.slots_)*/{}
+  , /*decltype(_impl_.header_)*/nullptr
+  , /*decltype(_impl_.path_)*/0u
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct ReadSlotsRequestDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ReadSlotsRequestDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ReadSlotsRequestDefaultTypeInternal() {}
+  union {
+    ReadSlotsRequest _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ReadSlotsRequestDefaultTypeInternal _ReadSlotsRequest_default_instance_;
+PROTOBUF_CONSTEXPR WriteSlotsRequest::WriteSlotsRequest(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.slots_)*/{}
+  , /*decltype(_impl_.buckets_)*/{}
+  , /*decltype(_impl_.header_)*/nullptr
+  , /*decltype(_impl_.path_)*/0u
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct WriteSlotsRequestDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR WriteSlotsRequestDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~WriteSlotsRequestDefaultTypeInternal() {}
+  union {
+    WriteSlotsRequest _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 WriteSlotsRequestDefaultTypeInternal _WriteSlotsRequest_default_instance_;
+PROTOBUF_CONSTEXPR BulkLoadBucketMessage::BulkLoadBucketMessage(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.bucket_)*/{}
+  , /*decltype(_impl_.level_)*/0u
+  , /*decltype(_impl_.offset_)*/0u
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct BulkLoadBucketMessageDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR BulkLoadBucketMessageDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~BulkLoadBucketMessageDefaultTypeInternal() {}
+  union {
+    BulkLoadBucketMessage _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 BulkLoadBucketMessageDefaultTypeInternal _BulkLoadBucketMessage_default_instance_;
+PROTOBUF_CONSTEXPR BulkLoadRequest::BulkLoadRequest(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.buckets_)*/{}
+  , /*decltype(_impl_.blocks_)*/{}
+  , /*decltype(_impl_.header_)*/nullptr
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct BulkLoadRequestDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR BulkLoadRequestDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~BulkLoadRequestDefaultTypeInternal() {}
+  union {
+    BulkLoadRequest _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 BulkLoadRequestDefaultTypeInternal _BulkLoadRequest_default_instance_;
 PROTOBUF_CONSTEXPR WritePathResponse::WritePathResponse(
     ::_pbi::ConstantInitialized) {}
 struct WritePathResponseDefaultTypeInternal {
@@ -296,7 +428,7 @@ struct WritePathResponseDefaultTypeInternal {
 };
 PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 WritePathResponseDefaultTypeInternal _WritePathResponse_default_instance_;
 }  // namespace oram_impl
-static ::_pb::Metadata file_level_metadata_messages_2eproto[19];
+static ::_pb::Metadata file_level_metadata_messages_2eproto[28];
 static const ::_pb::EnumDescriptor* file_level_enum_descriptors_messages_2eproto[1];
 static constexpr ::_pb::ServiceDescriptor const** file_level_service_descriptors_messages_2eproto = nullptr;
 
@@ -461,6 +593,83 @@ const uint32_t TableStruct_messages_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE
   0,
   1,
   ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::oram_impl::BucketMessage, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::oram_impl::BucketMessage, _impl_.bucket_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::oram_impl::ReadFullPathRequest, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::oram_impl::ReadFullPathRequest, _impl_.header_),
+  PROTOBUF_FIELD_OFFSET(::oram_impl::ReadFullPathRequest, _impl_.path_),
+  PROTOBUF_FIELD_OFFSET(::oram_impl::ReadFullPathRequest, _impl_.start_level_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::oram_impl::ReadFullPathResponse, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::oram_impl::ReadFullPathResponse, _impl_.buckets_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::oram_impl::WriteFullPathRequest, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::oram_impl::WriteFullPathRequest, _impl_.header_),
+  PROTOBUF_FIELD_OFFSET(::oram_impl::WriteFullPathRequest, _impl_.path_),
+  PROTOBUF_FIELD_OFFSET(::oram_impl::WriteFullPathRequest, _impl_.buckets_),
+  PROTOBUF_FIELD_OFFSET(::oram_impl::WriteFullPathRequest, _impl_.start_level_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::oram_impl::SlotListMessage, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::oram_impl::SlotListMessage, _impl_.slot_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::oram_impl::ReadSlotsRequest, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::oram_impl::ReadSlotsRequest, _impl_.header_),
+  PROTOBUF_FIELD_OFFSET(::oram_impl::ReadSlotsRequest, _impl_.path_),
+  PROTOBUF_FIELD_OFFSET(::oram_impl::ReadSlotsRequest, _impl_.slots_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::oram_impl::WriteSlotsRequest, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::oram_impl::WriteSlotsRequest, _impl_.header_),
+  PROTOBUF_FIELD_OFFSET(::oram_impl::WriteSlotsRequest, _impl_.path_),
+  PROTOBUF_FIELD_OFFSET(::oram_impl::WriteSlotsRequest, _impl_.slots_),
+  PROTOBUF_FIELD_OFFSET(::oram_impl::WriteSlotsRequest, _impl_.buckets_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::oram_impl::BulkLoadBucketMessage, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::oram_impl::BulkLoadBucketMessage, _impl_.level_),
+  PROTOBUF_FIELD_OFFSET(::oram_impl::BulkLoadBucketMessage, _impl_.offset_),
+  PROTOBUF_FIELD_OFFSET(::oram_impl::BulkLoadBucketMessage, _impl_.bucket_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::oram_impl::BulkLoadRequest, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::oram_impl::BulkLoadRequest, _impl_.header_),
+  PROTOBUF_FIELD_OFFSET(::oram_impl::BulkLoadRequest, _impl_.buckets_),
+  PROTOBUF_FIELD_OFFSET(::oram_impl::BulkLoadRequest, _impl_.blocks_),
+  ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::oram_impl::WritePathResponse, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
@@ -486,7 +695,16 @@ static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protode
   { 125, -1, -1, sizeof(::oram_impl::ReadPathRequest)},
   { 134, -1, -1, sizeof(::oram_impl::ReadPathResponse)},
   { 141, 153, -1, sizeof(::oram_impl::WritePathRequest)},
-  { 159, -1, -1, sizeof(::oram_impl::WritePathResponse)},
+  { 159, -1, -1, sizeof(::oram_impl::BucketMessage)},
+  { 166, -1, -1, sizeof(::oram_impl::ReadFullPathRequest)},
+  { 175, -1, -1, sizeof(::oram_impl::ReadFullPathResponse)},
+  { 182, -1, -1, sizeof(::oram_impl::WriteFullPathRequest)},
+  { 192, -1, -1, sizeof(::oram_impl::SlotListMessage)},
+  { 199, -1, -1, sizeof(::oram_impl::ReadSlotsRequest)},
+  { 208, -1, -1, sizeof(::oram_impl::WriteSlotsRequest)},
+  { 218, -1, -1, sizeof(::oram_impl::BulkLoadBucketMessage)},
+  { 227, -1, -1, sizeof(::oram_impl::BulkLoadRequest)},
+  { 236, -1, -1, sizeof(::oram_impl::WritePathResponse)},
 };
 
 static const ::_pb::Message* const file_default_instances[] = {
@@ -508,6 +726,15 @@ static const ::_pb::Message* const file_default_instances[] = {
   &::oram_impl::_ReadPathRequest_default_instance_._instance,
   &::oram_impl::_ReadPathResponse_default_instance_._instance,
   &::oram_impl::_WritePathRequest_default_instance_._instance,
+  &::oram_impl::_BucketMessage_default_instance_._instance,
+  &::oram_impl::_ReadFullPathRequest_default_instance_._instance,
+  &::oram_impl::_ReadFullPathResponse_default_instance_._instance,
+  &::oram_impl::_WriteFullPathRequest_default_instance_._instance,
+  &::oram_impl::_SlotListMessage_default_instance_._instance,
+  &::oram_impl::_ReadSlotsRequest_default_instance_._instance,
+  &::oram_impl::_WriteSlotsRequest_default_instance_._instance,
+  &::oram_impl::_BulkLoadBucketMessage_default_instance_._instance,
+  &::oram_impl::_BulkLoadRequest_default_instance_._instance,
   &::oram_impl::_WritePathResponse_default_instance_._instance,
 };
 
@@ -550,50 +777,81 @@ const char descriptor_table_protodef_messages_2eproto[] PROTOBUF_SECTION_VARIABL
   "(\0132\030.oram_impl.RequestHeader\022\014\n\004path\030\002 \001"
   "(\r\022\r\n\005level\030\003 \001(\r\022\016\n\006bucket\030\004 \003(\014\022\"\n\004typ"
   "e\030\005 \001(\0162\017.oram_impl.TypeH\000\210\001\001\022\023\n\006offset\030"
-  "\006 \001(\rH\001\210\001\001B\007\n\005_typeB\t\n\007_offset\"\023\n\021WriteP"
-  "athResponse*<\n\004Type\022\017\n\013kSequential\020\000\022\013\n\007"
-  "kRandom\020\001\022\t\n\005kInit\020\002\022\013\n\007kNormal\020\0032\345\t\n\013or"
-  "am_server\022H\n\014InitTreeOram\022\036.oram_impl.In"
-  "itTreeOramRequest\032\026.google.protobuf.Empt"
-  "y\"\000\022H\n\014InitFlatOram\022\036.oram_impl.InitFlat"
-  "OramRequest\032\026.google.protobuf.Empty\"\000\022H\n"
-  "\014InitSqrtOram\022\036.oram_impl.InitSqrtOramRe"
-  "quest\032\026.google.protobuf.Empty\"\000\022H\n\014LoadS"
-  "qrtOram\022\036.oram_impl.LoadSqrtOramRequest\032"
-  "\026.google.protobuf.Empty\"\000\022J\n\rPrintOramTr"
-  "ee\022\037.oram_impl.PrintOramTreeRequest\032\026.go"
-  "ogle.protobuf.Empty\"\000\022E\n\010ReadPath\022\032.oram"
-  "_impl.ReadPathRequest\032\033.oram_impl.ReadPa"
-  "thResponse\"\000\022H\n\tWritePath\022\033.oram_impl.Wr"
-  "itePathRequest\032\034.oram_impl.WritePathResp"
-  "onse\"\000\022L\n\016ReadFlatMemory\022\032.oram_impl.Rea"
-  "dFlatRequest\032\034.oram_impl.FlatVectorMessa"
-  "ge\"\000\022I\n\017WriteFlatMemory\022\034.oram_impl.Flat"
-  "VectorMessage\032\026.google.protobuf.Empty\"\000\022"
-  "F\n\016ReadSqrtMemory\022\032.oram_impl.ReadSqrtRe"
-  "quest\032\026.oram_impl.SqrtMessage\"\000\022H\n\017Write"
-  "SqrtMemory\022\033.oram_impl.WriteSqrtMessage\032"
-  "\026.google.protobuf.Empty\"\000\022C\n\013SqrtPermute"
-  "\022\032.oram_impl.SqrtPermMessage\032\026.google.pr"
-  "otobuf.Empty\"\000\022C\n\017CloseConnection\022\026.goog"
-  "le.protobuf.Empty\032\026.google.protobuf.Empt"
-  "y\"\000\022N\n\013KeyExchange\022\035.oram_impl.KeyExchan"
-  "geRequest\032\036.oram_impl.KeyExchangeRespons"
-  "e\"\000\022>\n\tSendHello\022\027.oram_impl.HelloMessag"
-  "e\032\026.google.protobuf.Empty\"\000\022K\n\027ReportSer"
-  "verInformation\022\026.google.protobuf.Empty\032\026"
-  ".google.protobuf.Empty\"\000\022\?\n\013ResetServer\022"
-  "\026.google.protobuf.Empty\032\026.google.protobu"
-  "f.Empty\"\000b\006proto3"
+  "\006 \001(\rH\001\210\001\001B\007\n\005_typeB\t\n\007_offset\"\037\n\rBucket"
+  "Message\022\016\n\006bucket\030\001 \003(\014\"b\n\023ReadFullPathR"
+  "equest\022(\n\006header\030\001 \001(\0132\030.oram_impl.Reque"
+  "stHeader\022\014\n\004path\030\002 \001(\r\022\023\n\013start_level\030\003 "
+  "\001(\r\"A\n\024ReadFullPathResponse\022)\n\007buckets\030\001"
+  " \003(\0132\030.oram_impl.BucketMessage\"\216\001\n\024Write"
+  "FullPathRequest\022(\n\006header\030\001 \001(\0132\030.oram_i"
+  "mpl.RequestHeader\022\014\n\004path\030\002 \001(\r\022)\n\007bucke"
+  "ts\030\003 \003(\0132\030.oram_impl.BucketMessage\022\023\n\013st"
+  "art_level\030\004 \001(\r\"\037\n\017SlotListMessage\022\014\n\004sl"
+  "ot\030\001 \003(\r\"u\n\020ReadSlotsRequest\022(\n\006header\030\001"
+  " \001(\0132\030.oram_impl.RequestHeader\022\014\n\004path\030\002"
+  " \001(\r\022)\n\005slots\030\003 \003(\0132\032.oram_impl.SlotList"
+  "Message\"\241\001\n\021WriteSlotsRequest\022(\n\006header\030"
+  "\001 \001(\0132\030.oram_impl.RequestHeader\022\014\n\004path\030"
+  "\002 \001(\r\022)\n\005slots\030\003 \003(\0132\032.oram_impl.SlotLis"
+  "tMessage\022)\n\007buckets\030\004 \003(\0132\030.oram_impl.Bu"
+  "cketMessage\"F\n\025BulkLoadBucketMessage\022\r\n\005"
+  "level\030\001 \001(\r\022\016\n\006offset\030\002 \001(\r\022\016\n\006bucket\030\003 "
+  "\003(\014\"~\n\017BulkLoadRequest\022(\n\006header\030\001 \001(\0132\030"
+  ".oram_impl.RequestHeader\0221\n\007buckets\030\002 \003("
+  "\0132 .oram_impl.BulkLoadBucketMessage\022\016\n\006b"
+  "locks\030\003 \003(\014\"\023\n\021WritePathResponse*<\n\004Type"
+  "\022\017\n\013kSequential\020\000\022\013\n\007kRandom\020\001\022\t\n\005kInit\020"
+  "\002\022\013\n\007kNormal\020\0032\347\014\n\013oram_server\022H\n\014InitTr"
+  "eeOram\022\036.oram_impl.InitTreeOramRequest\032\026"
+  ".google.protobuf.Empty\"\000\022H\n\014InitFlatOram"
+  "\022\036.oram_impl.InitFlatOramRequest\032\026.googl"
+  "e.protobuf.Empty\"\000\022H\n\014InitSqrtOram\022\036.ora"
+  "m_impl.InitSqrtOramRequest\032\026.google.prot"
+  "obuf.Empty\"\000\022H\n\014LoadSqrtOram\022\036.oram_impl"
+  ".LoadSqrtOramRequest\032\026.google.protobuf.E"
+  "mpty\"\000\022B\n\010BulkLoad\022\032.oram_impl.BulkLoadR"
+  "equest\032\026.google.protobuf.Empty\"\000(\001\022J\n\rPr"
+  "intOramTree\022\037.oram_impl.PrintOramTreeReq"
+  "uest\032\026.google.protobuf.Empty\"\000\022E\n\010ReadPa"
+  "th\022\032.oram_impl.ReadPathRequest\032\033.oram_im"
+  "pl.ReadPathResponse\"\000\022H\n\tWritePath\022\033.ora"
+  "m_impl.WritePathRequest\032\034.oram_impl.Writ"
+  "ePathResponse\"\000\022Q\n\014ReadFullPath\022\036.oram_i"
+  "mpl.ReadFullPathRequest\032\037.oram_impl.Read"
+  "FullPathResponse\"\000\022P\n\rWriteFullPath\022\037.or"
+  "am_impl.WriteFullPathRequest\032\034.oram_impl"
+  ".WritePathResponse\"\000\022K\n\tReadSlots\022\033.oram"
+  "_impl.ReadSlotsRequest\032\037.oram_impl.ReadF"
+  "ullPathResponse\"\000\022J\n\nWriteSlots\022\034.oram_i"
+  "mpl.WriteSlotsRequest\032\034.oram_impl.WriteP"
+  "athResponse\"\000\022L\n\016ReadFlatMemory\022\032.oram_i"
+  "mpl.ReadFlatRequest\032\034.oram_impl.FlatVect"
+  "orMessage\"\000\022I\n\017WriteFlatMemory\022\034.oram_im"
+  "pl.FlatVectorMessage\032\026.google.protobuf.E"
+  "mpty\"\000\022F\n\016ReadSqrtMemory\022\032.oram_impl.Rea"
+  "dSqrtRequest\032\026.oram_impl.SqrtMessage\"\000\022H"
+  "\n\017WriteSqrtMemory\022\033.oram_impl.WriteSqrtM"
+  "essage\032\026.google.protobuf.Empty\"\000\022C\n\013Sqrt"
+  "Permute\022\032.oram_impl.SqrtPermMessage\032\026.go"
+  "ogle.protobuf.Empty\"\000\022C\n\017CloseConnection"
+  "\022\026.google.protobuf.Empty\032\026.google.protob"
+  "uf.Empty\"\000\022N\n\013KeyExchange\022\035.oram_impl.Ke"
+  "yExchangeRequest\032\036.oram_impl.KeyExchange"
+  "Response\"\000\022>\n\tSendHello\022\027.oram_impl.Hell"
+  "oMessage\032\026.google.protobuf.Empty\"\000\022K\n\027Re"
+  "portServerInformation\022\026.google.protobuf."
+  "Empty\032\026.google.protobuf.Empty\"\000\022\?\n\013Reset"
+  "Server\022\026.google.protobuf.Empty\032\026.google."
+  "protobuf.Empty\"\000b\006proto3"
   ;
 static const ::_pbi::DescriptorTable* const descriptor_table_messages_2eproto_deps[1] = {
   &::descriptor_table_google_2fprotobuf_2fempty_2eproto,
 };
 static ::_pbi::once_flag descriptor_table_messages_2eproto_once;
 const ::_pbi::DescriptorTable descriptor_table_messages_2eproto = {
-    false, false, 2897, descriptor_table_protodef_messages_2eproto,
+    false, false, 4144, descriptor_table_protodef_messages_2eproto,
     "messages.proto",
-    &descriptor_table_messages_2eproto_once, descriptor_table_messages_2eproto_deps, 1, 19,
+    &descriptor_table_messages_2eproto_once, descriptor_table_messages_2eproto_deps, 1, 28,
     schemas, file_default_instances, TableStruct_messages_2eproto::offsets,
     file_level_metadata_messages_2eproto, file_level_enum_descriptors_messages_2eproto,
     file_level_service_descriptors_messages_2eproto,
@@ -5002,49 +5260,2206 @@ void WritePathRequest::InternalSwap(WritePathRequest* other) {
 
 // ===================================================================
 
-class WritePathResponse::_Internal {
+class BucketMessage::_Internal {
  public:
 };
 
-WritePathResponse::WritePathResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+BucketMessage::BucketMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                          bool is_message_owned)
-  : ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase(arena, is_message_owned) {
-  // @@protoc_insertion_point(arena_constructor:oram_impl.WritePathResponse)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:oram_impl.BucketMessage)
 }
-WritePathResponse::WritePathResponse(const WritePathResponse& from)
-  : ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase() {
-  WritePathResponse* const _this = this; (void)_this;
+BucketMessage::BucketMessage(const BucketMessage& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  BucketMessage* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.bucket_){from._impl_.bucket_}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  // @@protoc_insertion_point(copy_constructor:oram_impl.WritePathResponse)
+  // @@protoc_insertion_point(copy_constructor:oram_impl.BucketMessage)
+}
+
+inline void BucketMessage::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.bucket_){arena}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+BucketMessage::~BucketMessage() {
+  // @@protoc_insertion_point(destructor:oram_impl.BucketMessage)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
 }
 
+inline void BucketMessage::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.bucket_.~RepeatedPtrField();
+}
 
+void BucketMessage::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
 
+void BucketMessage::Clear() {
+// @@protoc_insertion_point(message_clear_start:oram_impl.BucketMessage)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
 
+  _impl_.bucket_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
 
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData WritePathResponse::_class_data_ = {
-    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyImpl,
-    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeImpl,
+const char* BucketMessage::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // repeated bytes bucket = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            auto str = _internal_add_bucket();
+            ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* BucketMessage::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:oram_impl.BucketMessage)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // repeated bytes bucket = 1;
+  for (int i = 0, n = this->_internal_bucket_size(); i < n; i++) {
+    const auto& s = this->_internal_bucket(i);
+    target = stream->WriteBytes(1, s, target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:oram_impl.BucketMessage)
+  return target;
+}
+
+size_t BucketMessage::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:oram_impl.BucketMessage)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated bytes bucket = 1;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(_impl_.bucket_.size());
+  for (int i = 0, n = _impl_.bucket_.size(); i < n; i++) {
+    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+      _impl_.bucket_.Get(i));
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData BucketMessage::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    BucketMessage::MergeImpl
 };
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*WritePathResponse::GetClassData() const { return &_class_data_; }
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*BucketMessage::GetClassData() const { return &_class_data_; }
 
 
+void BucketMessage::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<BucketMessage*>(&to_msg);
+  auto& from = static_cast<const BucketMessage&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:oram_impl.BucketMessage)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
 
+  _this->_impl_.bucket_.MergeFrom(from._impl_.bucket_);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
 
+void BucketMessage::CopyFrom(const BucketMessage& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:oram_impl.BucketMessage)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
 
+bool BucketMessage::IsInitialized() const {
+  return true;
+}
 
+void BucketMessage::InternalSwap(BucketMessage* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.bucket_.InternalSwap(&other->_impl_.bucket_);
+}
 
-::PROTOBUF_NAMESPACE_ID::Metadata WritePathResponse::GetMetadata() const {
+::PROTOBUF_NAMESPACE_ID::Metadata BucketMessage::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_messages_2eproto_getter, &descriptor_table_messages_2eproto_once,
       file_level_metadata_messages_2eproto[18]);
 }
 
-// @@protoc_insertion_point(namespace_scope)
-}  // namespace oram_impl
-PROTOBUF_NAMESPACE_OPEN
-template<> PROTOBUF_NOINLINE ::oram_impl::RequestHeader*
-Arena::CreateMaybeMessage< ::oram_impl::RequestHeader >(Arena* arena) {
+// ===================================================================
+
+class ReadFullPathRequest::_Internal {
+ public:
+  static const ::oram_impl::RequestHeader& header(const ReadFullPathRequest* msg);
+};
+
+const ::oram_impl::RequestHeader&
+ReadFullPathRequest::_Internal::header(const ReadFullPathRequest* msg) {
+  return *msg->_impl_.header_;
+}
+ReadFullPathRequest::ReadFullPathRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:oram_impl.ReadFullPathRequest)
+}
+ReadFullPathRequest::ReadFullPathRequest(const ReadFullPathRequest& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ReadFullPathRequest* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.header_){nullptr}
+    , decltype(_impl_.path_){}
+    , decltype(_impl_.start_level_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_header()) {
+    _this->_impl_.header_ = new ::oram_impl::RequestHeader(*from._impl_.header_);
+  }
+  ::memcpy(&_impl_.path_, &from._impl_.path_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.start_level_) -
+    reinterpret_cast<char*>(&_impl_.path_)) + sizeof(_impl_.start_level_));
+  // @@protoc_insertion_point(copy_constructor:oram_impl.ReadFullPathRequest)
+}
+
+inline void ReadFullPathRequest::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.header_){nullptr}
+    , decltype(_impl_.path_){0u}
+    , decltype(_impl_.start_level_){0u}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+ReadFullPathRequest::~ReadFullPathRequest() {
+  // @@protoc_insertion_point(destructor:oram_impl.ReadFullPathRequest)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void ReadFullPathRequest::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  if (this != internal_default_instance()) delete _impl_.header_;
+}
+
+void ReadFullPathRequest::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void ReadFullPathRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:oram_impl.ReadFullPathRequest)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  if (GetArenaForAllocation() == nullptr && _impl_.header_ != nullptr) {
+    delete _impl_.header_;
+  }
+  _impl_.header_ = nullptr;
+  ::memset(&_impl_.path_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.start_level_) -
+      reinterpret_cast<char*>(&_impl_.path_)) + sizeof(_impl_.start_level_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* ReadFullPathRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // .oram_impl.RequestHeader header = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_header(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 path = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.path_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 start_level = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.start_level_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* ReadFullPathRequest::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:oram_impl.ReadFullPathRequest)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // .oram_impl.RequestHeader header = 1;
+  if (this->_internal_has_header()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(1, _Internal::header(this),
+        _Internal::header(this).GetCachedSize(), target, stream);
+  }
+
+  // uint32 path = 2;
+  if (this->_internal_path() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(2, this->_internal_path(), target);
+  }
+
+  // uint32 start_level = 3;
+  if (this->_internal_start_level() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(3, this->_internal_start_level(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:oram_impl.ReadFullPathRequest)
+  return target;
+}
+
+size_t ReadFullPathRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:oram_impl.ReadFullPathRequest)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // .oram_impl.RequestHeader header = 1;
+  if (this->_internal_has_header()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.header_);
+  }
+
+  // uint32 path = 2;
+  if (this->_internal_path() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_path());
+  }
+
+  // uint32 start_level = 3;
+  if (this->_internal_start_level() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_start_level());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ReadFullPathRequest::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    ReadFullPathRequest::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ReadFullPathRequest::GetClassData() const { return &_class_data_; }
+
+
+void ReadFullPathRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ReadFullPathRequest*>(&to_msg);
+  auto& from = static_cast<const ReadFullPathRequest&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:oram_impl.ReadFullPathRequest)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_has_header()) {
+    _this->_internal_mutable_header()->::oram_impl::RequestHeader::MergeFrom(
+        from._internal_header());
+  }
+  if (from._internal_path() != 0) {
+    _this->_internal_set_path(from._internal_path());
+  }
+  if (from._internal_start_level() != 0) {
+    _this->_internal_set_start_level(from._internal_start_level());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void ReadFullPathRequest::CopyFrom(const ReadFullPathRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:oram_impl.ReadFullPathRequest)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool ReadFullPathRequest::IsInitialized() const {
+  return true;
+}
+
+void ReadFullPathRequest::InternalSwap(ReadFullPathRequest* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(ReadFullPathRequest, _impl_.start_level_)
+      + sizeof(ReadFullPathRequest::_impl_.start_level_)
+      - PROTOBUF_FIELD_OFFSET(ReadFullPathRequest, _impl_.header_)>(
+          reinterpret_cast<char*>(&_impl_.header_),
+          reinterpret_cast<char*>(&other->_impl_.header_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata ReadFullPathRequest::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_messages_2eproto_getter, &descriptor_table_messages_2eproto_once,
+      file_level_metadata_messages_2eproto[19]);
+}
+
+// ===================================================================
+
+class ReadFullPathResponse::_Internal {
+ public:
+};
+
+ReadFullPathResponse::ReadFullPathResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:oram_impl.ReadFullPathResponse)
+}
+ReadFullPathResponse::ReadFullPathResponse(const ReadFullPathResponse& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ReadFullPathResponse* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.buckets_){from._impl_.buckets_}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  // @@protoc_insertion_point(copy_constructor:oram_impl.ReadFullPathResponse)
+}
+
+inline void ReadFullPathResponse::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.buckets_){arena}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+ReadFullPathResponse::~ReadFullPathResponse() {
+  // @@protoc_insertion_point(destructor:oram_impl.ReadFullPathResponse)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void ReadFullPathResponse::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.buckets_.~RepeatedPtrField();
+}
+
+void ReadFullPathResponse::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void ReadFullPathResponse::Clear() {
+// @@protoc_insertion_point(message_clear_start:oram_impl.ReadFullPathResponse)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.buckets_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* ReadFullPathResponse::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // repeated .oram_impl.BucketMessage buckets = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_buckets(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* ReadFullPathResponse::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:oram_impl.ReadFullPathResponse)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // repeated .oram_impl.BucketMessage buckets = 1;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_buckets_size()); i < n; i++) {
+    const auto& repfield = this->_internal_buckets(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(1, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:oram_impl.ReadFullPathResponse)
+  return target;
+}
+
+size_t ReadFullPathResponse::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:oram_impl.ReadFullPathResponse)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .oram_impl.BucketMessage buckets = 1;
+  total_size += 1UL * this->_internal_buckets_size();
+  for (const auto& msg : this->_impl_.buckets_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ReadFullPathResponse::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    ReadFullPathResponse::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ReadFullPathResponse::GetClassData() const { return &_class_data_; }
+
+
+void ReadFullPathResponse::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ReadFullPathResponse*>(&to_msg);
+  auto& from = static_cast<const ReadFullPathResponse&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:oram_impl.ReadFullPathResponse)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.buckets_.MergeFrom(from._impl_.buckets_);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void ReadFullPathResponse::CopyFrom(const ReadFullPathResponse& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:oram_impl.ReadFullPathResponse)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool ReadFullPathResponse::IsInitialized() const {
+  return true;
+}
+
+void ReadFullPathResponse::InternalSwap(ReadFullPathResponse* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.buckets_.InternalSwap(&other->_impl_.buckets_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata ReadFullPathResponse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_messages_2eproto_getter, &descriptor_table_messages_2eproto_once,
+      file_level_metadata_messages_2eproto[20]);
+}
+
+// ===================================================================
+
+class WriteFullPathRequest::_Internal {
+ public:
+  static const ::oram_impl::RequestHeader& header(const WriteFullPathRequest* msg);
+};
+
+const ::oram_impl::RequestHeader&
+WriteFullPathRequest::_Internal::header(const WriteFullPathRequest* msg) {
+  return *msg->_impl_.header_;
+}
+WriteFullPathRequest::WriteFullPathRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:oram_impl.WriteFullPathRequest)
+}
+WriteFullPathRequest::WriteFullPathRequest(const WriteFullPathRequest& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  WriteFullPathRequest* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.buckets_){from._impl_.buckets_}
+    , decltype(_impl_.header_){nullptr}
+    , decltype(_impl_.path_){}
+    , decltype(_impl_.start_level_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_header()) {
+    _this->_impl_.header_ = new ::oram_impl::RequestHeader(*from._impl_.header_);
+  }
+  ::memcpy(&_impl_.path_, &from._impl_.path_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.start_level_) -
+    reinterpret_cast<char*>(&_impl_.path_)) + sizeof(_impl_.start_level_));
+  // @@protoc_insertion_point(copy_constructor:oram_impl.WriteFullPathRequest)
+}
+
+inline void WriteFullPathRequest::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.buckets_){arena}
+    , decltype(_impl_.header_){nullptr}
+    , decltype(_impl_.path_){0u}
+    , decltype(_impl_.start_level_){0u}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+WriteFullPathRequest::~WriteFullPathRequest() {
+  // @@protoc_insertion_point(destructor:oram_impl.WriteFullPathRequest)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void WriteFullPathRequest::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.buckets_.~RepeatedPtrField();
+  if (this != internal_default_instance()) delete _impl_.header_;
+}
+
+void WriteFullPathRequest::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void WriteFullPathRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:oram_impl.WriteFullPathRequest)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.buckets_.Clear();
+  if (GetArenaForAllocation() == nullptr && _impl_.header_ != nullptr) {
+    delete _impl_.header_;
+  }
+  _impl_.header_ = nullptr;
+  ::memset(&_impl_.path_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.start_level_) -
+      reinterpret_cast<char*>(&_impl_.path_)) + sizeof(_impl_.start_level_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* WriteFullPathRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // .oram_impl.RequestHeader header = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_header(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 path = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.path_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .oram_impl.BucketMessage buckets = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_buckets(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<26>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 start_level = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.start_level_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* WriteFullPathRequest::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:oram_impl.WriteFullPathRequest)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // .oram_impl.RequestHeader header = 1;
+  if (this->_internal_has_header()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(1, _Internal::header(this),
+        _Internal::header(this).GetCachedSize(), target, stream);
+  }
+
+  // uint32 path = 2;
+  if (this->_internal_path() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(2, this->_internal_path(), target);
+  }
+
+  // repeated .oram_impl.BucketMessage buckets = 3;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_buckets_size()); i < n; i++) {
+    const auto& repfield = this->_internal_buckets(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(3, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  // uint32 start_level = 4;
+  if (this->_internal_start_level() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(4, this->_internal_start_level(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:oram_impl.WriteFullPathRequest)
+  return target;
+}
+
+size_t WriteFullPathRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:oram_impl.WriteFullPathRequest)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .oram_impl.BucketMessage buckets = 3;
+  total_size += 1UL * this->_internal_buckets_size();
+  for (const auto& msg : this->_impl_.buckets_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // .oram_impl.RequestHeader header = 1;
+  if (this->_internal_has_header()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.header_);
+  }
+
+  // uint32 path = 2;
+  if (this->_internal_path() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_path());
+  }
+
+  // uint32 start_level = 4;
+  if (this->_internal_start_level() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_start_level());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData WriteFullPathRequest::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    WriteFullPathRequest::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*WriteFullPathRequest::GetClassData() const { return &_class_data_; }
+
+
+void WriteFullPathRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<WriteFullPathRequest*>(&to_msg);
+  auto& from = static_cast<const WriteFullPathRequest&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:oram_impl.WriteFullPathRequest)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.buckets_.MergeFrom(from._impl_.buckets_);
+  if (from._internal_has_header()) {
+    _this->_internal_mutable_header()->::oram_impl::RequestHeader::MergeFrom(
+        from._internal_header());
+  }
+  if (from._internal_path() != 0) {
+    _this->_internal_set_path(from._internal_path());
+  }
+  if (from._internal_start_level() != 0) {
+    _this->_internal_set_start_level(from._internal_start_level());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void WriteFullPathRequest::CopyFrom(const WriteFullPathRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:oram_impl.WriteFullPathRequest)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool WriteFullPathRequest::IsInitialized() const {
+  return true;
+}
+
+void WriteFullPathRequest::InternalSwap(WriteFullPathRequest* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.buckets_.InternalSwap(&other->_impl_.buckets_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(WriteFullPathRequest, _impl_.start_level_)
+      + sizeof(WriteFullPathRequest::_impl_.start_level_)
+      - PROTOBUF_FIELD_OFFSET(WriteFullPathRequest, _impl_.header_)>(
+          reinterpret_cast<char*>(&_impl_.header_),
+          reinterpret_cast<char*>(&other->_impl_.header_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata WriteFullPathRequest::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_messages_2eproto_getter, &descriptor_table_messages_2eproto_once,
+      file_level_metadata_messages_2eproto[21]);
+}
+
+// ===================================================================
+
+class SlotListMessage::_Internal {
+ public:
+};
+
+SlotListMessage::SlotListMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:oram_impl.SlotListMessage)
+}
+SlotListMessage::SlotListMessage(const SlotListMessage& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  SlotListMessage* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.slot_){from._impl_.slot_}
+    , /*decltype(_impl_._slot_cached_byte_size_)*/{0}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  // @@protoc_insertion_point(copy_constructor:oram_impl.SlotListMessage)
+}
+
+inline void SlotListMessage::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.slot_){arena}
+    , /*decltype(_impl_._slot_cached_byte_size_)*/{0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+SlotListMessage::~SlotListMessage() {
+  // @@protoc_insertion_point(destructor:oram_impl.SlotListMessage)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void SlotListMessage::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.slot_.~RepeatedField();
+}
+
+void SlotListMessage::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void SlotListMessage::Clear() {
+// @@protoc_insertion_point(message_clear_start:oram_impl.SlotListMessage)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.slot_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* SlotListMessage::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // repeated uint32 slot = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedUInt32Parser(_internal_mutable_slot(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 8) {
+          _internal_add_slot(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr));
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* SlotListMessage::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:oram_impl.SlotListMessage)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // repeated uint32 slot = 1;
+  {
+    int byte_size = _impl_._slot_cached_byte_size_.load(std::memory_order_relaxed);
+    if (byte_size > 0) {
+      target = stream->WriteUInt32Packed(
+          1, _internal_slot(), byte_size, target);
+    }
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:oram_impl.SlotListMessage)
+  return target;
+}
+
+size_t SlotListMessage::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:oram_impl.SlotListMessage)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated uint32 slot = 1;
+  {
+    size_t data_size = ::_pbi::WireFormatLite::
+      UInt32Size(this->_impl_.slot_);
+    if (data_size > 0) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
+    }
+    int cached_size = ::_pbi::ToCachedSize(data_size);
+    _impl_._slot_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData SlotListMessage::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    SlotListMessage::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*SlotListMessage::GetClassData() const { return &_class_data_; }
+
+
+void SlotListMessage::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<SlotListMessage*>(&to_msg);
+  auto& from = static_cast<const SlotListMessage&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:oram_impl.SlotListMessage)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.slot_.MergeFrom(from._impl_.slot_);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void SlotListMessage::CopyFrom(const SlotListMessage& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:oram_impl.SlotListMessage)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool SlotListMessage::IsInitialized() const {
+  return true;
+}
+
+void SlotListMessage::InternalSwap(SlotListMessage* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.slot_.InternalSwap(&other->_impl_.slot_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata SlotListMessage::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_messages_2eproto_getter, &descriptor_table_messages_2eproto_once,
+      file_level_metadata_messages_2eproto[22]);
+}
+
+// ===================================================================
+
+class ReadSlotsRequest::_Internal {
+ public:
+  static const ::oram_impl::RequestHeader& header(const ReadSlotsRequest* msg);
+};
+
+const ::oram_impl::RequestHeader&
+ReadSlotsRequest::_Internal::header(const ReadSlotsRequest* msg) {
+  return *msg->_impl_.header_;
+}
+ReadSlotsRequest::ReadSlotsRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:oram_impl.ReadSlotsRequest)
+}
+ReadSlotsRequest::ReadSlotsRequest(const ReadSlotsRequest& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ReadSlotsRequest* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.slots_){from._impl_.slots_}
+    , decltype(_impl_.header_){nullptr}
+    , decltype(_impl_.path_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_header()) {
+    _this->_impl_.header_ = new ::oram_impl::RequestHeader(*from._impl_.header_);
+  }
+  _this->_impl_.path_ = from._impl_.path_;
+  // @@protoc_insertion_point(copy_constructor:oram_impl.ReadSlotsRequest)
+}
+
+inline void ReadSlotsRequest::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.slots_){arena}
+    , decltype(_impl_.header_){nullptr}
+    , decltype(_impl_.path_){0u}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+ReadSlotsRequest::~ReadSlotsRequest() {
+  // @@protoc_insertion_point(destructor:oram_impl.ReadSlotsRequest)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void ReadSlotsRequest::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.slots_.~RepeatedPtrField();
+  if (this != internal_default_instance()) delete _impl_.header_;
+}
+
+void ReadSlotsRequest::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void ReadSlotsRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:oram_impl.ReadSlotsRequest)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.slots_.Clear();
+  if (GetArenaForAllocation() == nullptr && _impl_.header_ != nullptr) {
+    delete _impl_.header_;
+  }
+  _impl_.header_ = nullptr;
+  _impl_.path_ = 0u;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* ReadSlotsRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // .oram_impl.RequestHeader header = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_header(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 path = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.path_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .oram_impl.SlotListMessage slots = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_slots(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<26>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* ReadSlotsRequest::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:oram_impl.ReadSlotsRequest)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // .oram_impl.RequestHeader header = 1;
+  if (this->_internal_has_header()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(1, _Internal::header(this),
+        _Internal::header(this).GetCachedSize(), target, stream);
+  }
+
+  // uint32 path = 2;
+  if (this->_internal_path() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(2, this->_internal_path(), target);
+  }
+
+  // repeated .oram_impl.SlotListMessage slots = 3;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_slots_size()); i < n; i++) {
+    const auto& repfield = this->_internal_slots(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(3, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:oram_impl.ReadSlotsRequest)
+  return target;
+}
+
+size_t ReadSlotsRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:oram_impl.ReadSlotsRequest)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .oram_impl.SlotListMessage slots = 3;
+  total_size += 1UL * this->_internal_slots_size();
+  for (const auto& msg : this->_impl_.slots_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // .oram_impl.RequestHeader header = 1;
+  if (this->_internal_has_header()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.header_);
+  }
+
+  // uint32 path = 2;
+  if (this->_internal_path() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_path());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ReadSlotsRequest::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    ReadSlotsRequest::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ReadSlotsRequest::GetClassData() const { return &_class_data_; }
+
+
+void ReadSlotsRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ReadSlotsRequest*>(&to_msg);
+  auto& from = static_cast<const ReadSlotsRequest&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:oram_impl.ReadSlotsRequest)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.slots_.MergeFrom(from._impl_.slots_);
+  if (from._internal_has_header()) {
+    _this->_internal_mutable_header()->::oram_impl::RequestHeader::MergeFrom(
+        from._internal_header());
+  }
+  if (from._internal_path() != 0) {
+    _this->_internal_set_path(from._internal_path());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void ReadSlotsRequest::CopyFrom(const ReadSlotsRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:oram_impl.ReadSlotsRequest)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool ReadSlotsRequest::IsInitialized() const {
+  return true;
+}
+
+void ReadSlotsRequest::InternalSwap(ReadSlotsRequest* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.slots_.InternalSwap(&other->_impl_.slots_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(ReadSlotsRequest, _impl_.path_)
+      + sizeof(ReadSlotsRequest::_impl_.path_)
+      - PROTOBUF_FIELD_OFFSET(ReadSlotsRequest, _impl_.header_)>(
+          reinterpret_cast<char*>(&_impl_.header_),
+          reinterpret_cast<char*>(&other->_impl_.header_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata ReadSlotsRequest::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_messages_2eproto_getter, &descriptor_table_messages_2eproto_once,
+      file_level_metadata_messages_2eproto[23]);
+}
+
+// ===================================================================
+
+class WriteSlotsRequest::_Internal {
+ public:
+  static const ::oram_impl::RequestHeader& header(const WriteSlotsRequest* msg);
+};
+
+const ::oram_impl::RequestHeader&
+WriteSlotsRequest::_Internal::header(const WriteSlotsRequest* msg) {
+  return *msg->_impl_.header_;
+}
+WriteSlotsRequest::WriteSlotsRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:oram_impl.WriteSlotsRequest)
+}
+WriteSlotsRequest::WriteSlotsRequest(const WriteSlotsRequest& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  WriteSlotsRequest* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.slots_){from._impl_.slots_}
+    , decltype(_impl_.buckets_){from._impl_.buckets_}
+    , decltype(_impl_.header_){nullptr}
+    , decltype(_impl_.path_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_header()) {
+    _this->_impl_.header_ = new ::oram_impl::RequestHeader(*from._impl_.header_);
+  }
+  _this->_impl_.path_ = from._impl_.path_;
+  // @@protoc_insertion_point(copy_constructor:oram_impl.WriteSlotsRequest)
+}
+
+inline void WriteSlotsRequest::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.slots_){arena}
+    , decltype(_impl_.buckets_){arena}
+    , decltype(_impl_.header_){nullptr}
+    , decltype(_impl_.path_){0u}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+WriteSlotsRequest::~WriteSlotsRequest() {
+  // @@protoc_insertion_point(destructor:oram_impl.WriteSlotsRequest)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void WriteSlotsRequest::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.slots_.~RepeatedPtrField();
+  _impl_.buckets_.~RepeatedPtrField();
+  if (this != internal_default_instance()) delete _impl_.header_;
+}
+
+void WriteSlotsRequest::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void WriteSlotsRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:oram_impl.WriteSlotsRequest)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.slots_.Clear();
+  _impl_.buckets_.Clear();
+  if (GetArenaForAllocation() == nullptr && _impl_.header_ != nullptr) {
+    delete _impl_.header_;
+  }
+  _impl_.header_ = nullptr;
+  _impl_.path_ = 0u;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* WriteSlotsRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // .oram_impl.RequestHeader header = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_header(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 path = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.path_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .oram_impl.SlotListMessage slots = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_slots(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<26>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .oram_impl.BucketMessage buckets = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_buckets(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<34>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* WriteSlotsRequest::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:oram_impl.WriteSlotsRequest)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // .oram_impl.RequestHeader header = 1;
+  if (this->_internal_has_header()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(1, _Internal::header(this),
+        _Internal::header(this).GetCachedSize(), target, stream);
+  }
+
+  // uint32 path = 2;
+  if (this->_internal_path() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(2, this->_internal_path(), target);
+  }
+
+  // repeated .oram_impl.SlotListMessage slots = 3;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_slots_size()); i < n; i++) {
+    const auto& repfield = this->_internal_slots(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(3, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  // repeated .oram_impl.BucketMessage buckets = 4;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_buckets_size()); i < n; i++) {
+    const auto& repfield = this->_internal_buckets(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(4, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:oram_impl.WriteSlotsRequest)
+  return target;
+}
+
+size_t WriteSlotsRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:oram_impl.WriteSlotsRequest)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .oram_impl.SlotListMessage slots = 3;
+  total_size += 1UL * this->_internal_slots_size();
+  for (const auto& msg : this->_impl_.slots_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // repeated .oram_impl.BucketMessage buckets = 4;
+  total_size += 1UL * this->_internal_buckets_size();
+  for (const auto& msg : this->_impl_.buckets_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // .oram_impl.RequestHeader header = 1;
+  if (this->_internal_has_header()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.header_);
+  }
+
+  // uint32 path = 2;
+  if (this->_internal_path() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_path());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData WriteSlotsRequest::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    WriteSlotsRequest::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*WriteSlotsRequest::GetClassData() const { return &_class_data_; }
+
+
+void WriteSlotsRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<WriteSlotsRequest*>(&to_msg);
+  auto& from = static_cast<const WriteSlotsRequest&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:oram_impl.WriteSlotsRequest)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.slots_.MergeFrom(from._impl_.slots_);
+  _this->_impl_.buckets_.MergeFrom(from._impl_.buckets_);
+  if (from._internal_has_header()) {
+    _this->_internal_mutable_header()->::oram_impl::RequestHeader::MergeFrom(
+        from._internal_header());
+  }
+  if (from._internal_path() != 0) {
+    _this->_internal_set_path(from._internal_path());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void WriteSlotsRequest::CopyFrom(const WriteSlotsRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:oram_impl.WriteSlotsRequest)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool WriteSlotsRequest::IsInitialized() const {
+  return true;
+}
+
+void WriteSlotsRequest::InternalSwap(WriteSlotsRequest* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.slots_.InternalSwap(&other->_impl_.slots_);
+  _impl_.buckets_.InternalSwap(&other->_impl_.buckets_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(WriteSlotsRequest, _impl_.path_)
+      + sizeof(WriteSlotsRequest::_impl_.path_)
+      - PROTOBUF_FIELD_OFFSET(WriteSlotsRequest, _impl_.header_)>(
+          reinterpret_cast<char*>(&_impl_.header_),
+          reinterpret_cast<char*>(&other->_impl_.header_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata WriteSlotsRequest::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_messages_2eproto_getter, &descriptor_table_messages_2eproto_once,
+      file_level_metadata_messages_2eproto[24]);
+}
+
+// ===================================================================
+
+class BulkLoadBucketMessage::_Internal {
+ public:
+};
+
+BulkLoadBucketMessage::BulkLoadBucketMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:oram_impl.BulkLoadBucketMessage)
+}
+BulkLoadBucketMessage::BulkLoadBucketMessage(const BulkLoadBucketMessage& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  BulkLoadBucketMessage* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.bucket_){from._impl_.bucket_}
+    , decltype(_impl_.level_){}
+    , decltype(_impl_.offset_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.level_, &from._impl_.level_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.offset_) -
+    reinterpret_cast<char*>(&_impl_.level_)) + sizeof(_impl_.offset_));
+  // @@protoc_insertion_point(copy_constructor:oram_impl.BulkLoadBucketMessage)
+}
+
+inline void BulkLoadBucketMessage::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.bucket_){arena}
+    , decltype(_impl_.level_){0u}
+    , decltype(_impl_.offset_){0u}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+BulkLoadBucketMessage::~BulkLoadBucketMessage() {
+  // @@protoc_insertion_point(destructor:oram_impl.BulkLoadBucketMessage)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void BulkLoadBucketMessage::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.bucket_.~RepeatedPtrField();
+}
+
+void BulkLoadBucketMessage::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void BulkLoadBucketMessage::Clear() {
+// @@protoc_insertion_point(message_clear_start:oram_impl.BulkLoadBucketMessage)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.bucket_.Clear();
+  ::memset(&_impl_.level_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.offset_) -
+      reinterpret_cast<char*>(&_impl_.level_)) + sizeof(_impl_.offset_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* BulkLoadBucketMessage::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // uint32 level = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.level_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 offset = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.offset_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated bytes bucket = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            auto str = _internal_add_bucket();
+            ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<26>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* BulkLoadBucketMessage::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:oram_impl.BulkLoadBucketMessage)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // uint32 level = 1;
+  if (this->_internal_level() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(1, this->_internal_level(), target);
+  }
+
+  // uint32 offset = 2;
+  if (this->_internal_offset() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(2, this->_internal_offset(), target);
+  }
+
+  // repeated bytes bucket = 3;
+  for (int i = 0, n = this->_internal_bucket_size(); i < n; i++) {
+    const auto& s = this->_internal_bucket(i);
+    target = stream->WriteBytes(3, s, target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:oram_impl.BulkLoadBucketMessage)
+  return target;
+}
+
+size_t BulkLoadBucketMessage::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:oram_impl.BulkLoadBucketMessage)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated bytes bucket = 3;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(_impl_.bucket_.size());
+  for (int i = 0, n = _impl_.bucket_.size(); i < n; i++) {
+    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+      _impl_.bucket_.Get(i));
+  }
+
+  // uint32 level = 1;
+  if (this->_internal_level() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_level());
+  }
+
+  // uint32 offset = 2;
+  if (this->_internal_offset() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_offset());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData BulkLoadBucketMessage::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    BulkLoadBucketMessage::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*BulkLoadBucketMessage::GetClassData() const { return &_class_data_; }
+
+
+void BulkLoadBucketMessage::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<BulkLoadBucketMessage*>(&to_msg);
+  auto& from = static_cast<const BulkLoadBucketMessage&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:oram_impl.BulkLoadBucketMessage)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.bucket_.MergeFrom(from._impl_.bucket_);
+  if (from._internal_level() != 0) {
+    _this->_internal_set_level(from._internal_level());
+  }
+  if (from._internal_offset() != 0) {
+    _this->_internal_set_offset(from._internal_offset());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void BulkLoadBucketMessage::CopyFrom(const BulkLoadBucketMessage& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:oram_impl.BulkLoadBucketMessage)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool BulkLoadBucketMessage::IsInitialized() const {
+  return true;
+}
+
+void BulkLoadBucketMessage::InternalSwap(BulkLoadBucketMessage* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.bucket_.InternalSwap(&other->_impl_.bucket_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(BulkLoadBucketMessage, _impl_.offset_)
+      + sizeof(BulkLoadBucketMessage::_impl_.offset_)
+      - PROTOBUF_FIELD_OFFSET(BulkLoadBucketMessage, _impl_.level_)>(
+          reinterpret_cast<char*>(&_impl_.level_),
+          reinterpret_cast<char*>(&other->_impl_.level_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata BulkLoadBucketMessage::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_messages_2eproto_getter, &descriptor_table_messages_2eproto_once,
+      file_level_metadata_messages_2eproto[25]);
+}
+
+// ===================================================================
+
+class BulkLoadRequest::_Internal {
+ public:
+  static const ::oram_impl::RequestHeader& header(const BulkLoadRequest* msg);
+};
+
+const ::oram_impl::RequestHeader&
+BulkLoadRequest::_Internal::header(const BulkLoadRequest* msg) {
+  return *msg->_impl_.header_;
+}
+BulkLoadRequest::BulkLoadRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:oram_impl.BulkLoadRequest)
+}
+BulkLoadRequest::BulkLoadRequest(const BulkLoadRequest& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  BulkLoadRequest* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.buckets_){from._impl_.buckets_}
+    , decltype(_impl_.blocks_){from._impl_.blocks_}
+    , decltype(_impl_.header_){nullptr}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_header()) {
+    _this->_impl_.header_ = new ::oram_impl::RequestHeader(*from._impl_.header_);
+  }
+  // @@protoc_insertion_point(copy_constructor:oram_impl.BulkLoadRequest)
+}
+
+inline void BulkLoadRequest::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.buckets_){arena}
+    , decltype(_impl_.blocks_){arena}
+    , decltype(_impl_.header_){nullptr}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+BulkLoadRequest::~BulkLoadRequest() {
+  // @@protoc_insertion_point(destructor:oram_impl.BulkLoadRequest)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void BulkLoadRequest::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.buckets_.~RepeatedPtrField();
+  _impl_.blocks_.~RepeatedPtrField();
+  if (this != internal_default_instance()) delete _impl_.header_;
+}
+
+void BulkLoadRequest::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void BulkLoadRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:oram_impl.BulkLoadRequest)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.buckets_.Clear();
+  _impl_.blocks_.Clear();
+  if (GetArenaForAllocation() == nullptr && _impl_.header_ != nullptr) {
+    delete _impl_.header_;
+  }
+  _impl_.header_ = nullptr;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* BulkLoadRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // .oram_impl.RequestHeader header = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_header(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .oram_impl.BulkLoadBucketMessage buckets = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_buckets(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<18>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated bytes blocks = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            auto str = _internal_add_blocks();
+            ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<26>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* BulkLoadRequest::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:oram_impl.BulkLoadRequest)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // .oram_impl.RequestHeader header = 1;
+  if (this->_internal_has_header()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(1, _Internal::header(this),
+        _Internal::header(this).GetCachedSize(), target, stream);
+  }
+
+  // repeated .oram_impl.BulkLoadBucketMessage buckets = 2;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_buckets_size()); i < n; i++) {
+    const auto& repfield = this->_internal_buckets(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(2, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  // repeated bytes blocks = 3;
+  for (int i = 0, n = this->_internal_blocks_size(); i < n; i++) {
+    const auto& s = this->_internal_blocks(i);
+    target = stream->WriteBytes(3, s, target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:oram_impl.BulkLoadRequest)
+  return target;
+}
+
+size_t BulkLoadRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:oram_impl.BulkLoadRequest)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .oram_impl.BulkLoadBucketMessage buckets = 2;
+  total_size += 1UL * this->_internal_buckets_size();
+  for (const auto& msg : this->_impl_.buckets_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // repeated bytes blocks = 3;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(_impl_.blocks_.size());
+  for (int i = 0, n = _impl_.blocks_.size(); i < n; i++) {
+    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+      _impl_.blocks_.Get(i));
+  }
+
+  // .oram_impl.RequestHeader header = 1;
+  if (this->_internal_has_header()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.header_);
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData BulkLoadRequest::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    BulkLoadRequest::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*BulkLoadRequest::GetClassData() const { return &_class_data_; }
+
+
+void BulkLoadRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<BulkLoadRequest*>(&to_msg);
+  auto& from = static_cast<const BulkLoadRequest&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:oram_impl.BulkLoadRequest)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.buckets_.MergeFrom(from._impl_.buckets_);
+  _this->_impl_.blocks_.MergeFrom(from._impl_.blocks_);
+  if (from._internal_has_header()) {
+    _this->_internal_mutable_header()->::oram_impl::RequestHeader::MergeFrom(
+        from._internal_header());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void BulkLoadRequest::CopyFrom(const BulkLoadRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:oram_impl.BulkLoadRequest)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool BulkLoadRequest::IsInitialized() const {
+  return true;
+}
+
+void BulkLoadRequest::InternalSwap(BulkLoadRequest* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.buckets_.InternalSwap(&other->_impl_.buckets_);
+  _impl_.blocks_.InternalSwap(&other->_impl_.blocks_);
+  swap(_impl_.header_, other->_impl_.header_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata BulkLoadRequest::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_messages_2eproto_getter, &descriptor_table_messages_2eproto_once,
+      file_level_metadata_messages_2eproto[26]);
+}
+
+// ===================================================================
+
+class WritePathResponse::_Internal {
+ public:
+};
+
+WritePathResponse::WritePathResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase(arena, is_message_owned) {
+  // @@protoc_insertion_point(arena_constructor:oram_impl.WritePathResponse)
+}
+WritePathResponse::WritePathResponse(const WritePathResponse& from)
+  : ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase() {
+  WritePathResponse* const _this = this; (void)_this;
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  // @@protoc_insertion_point(copy_constructor:oram_impl.WritePathResponse)
+}
+
+
+
+
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData WritePathResponse::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyImpl,
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeImpl,
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*WritePathResponse::GetClassData() const { return &_class_data_; }
+
+
+
+
+
+
+
+::PROTOBUF_NAMESPACE_ID::Metadata WritePathResponse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_messages_2eproto_getter, &descriptor_table_messages_2eproto_once,
+      file_level_metadata_messages_2eproto[27]);
+}
+
+// @@protoc_insertion_point(namespace_scope)
+}  // namespace oram_impl
+PROTOBUF_NAMESPACE_OPEN
+template<> PROTOBUF_NOINLINE ::oram_impl::RequestHeader*
+Arena::CreateMaybeMessage< ::oram_impl::RequestHeader >(Arena* arena) {
   return Arena::CreateMessageInternal< ::oram_impl::RequestHeader >(arena);
 }
 template<> PROTOBUF_NOINLINE ::oram_impl::PrintOramTreeRequest*
@@ -5115,6 +7530,42 @@ template<> PROTOBUF_NOINLINE ::oram_impl::WritePathRequest*
 Arena::CreateMaybeMessage< ::oram_impl::WritePathRequest >(Arena* arena) {
   return Arena::CreateMessageInternal< ::oram_impl::WritePathRequest >(arena);
 }
+template<> PROTOBUF_NOINLINE ::oram_impl::BucketMessage*
+Arena::CreateMaybeMessage< ::oram_impl::BucketMessage >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::oram_impl::BucketMessage >(arena);
+}
+template<> PROTOBUF_NOINLINE ::oram_impl::ReadFullPathRequest*
+Arena::CreateMaybeMessage< ::oram_impl::ReadFullPathRequest >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::oram_impl::ReadFullPathRequest >(arena);
+}
+template<> PROTOBUF_NOINLINE ::oram_impl::ReadFullPathResponse*
+Arena::CreateMaybeMessage< ::oram_impl::ReadFullPathResponse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::oram_impl::ReadFullPathResponse >(arena);
+}
+template<> PROTOBUF_NOINLINE ::oram_impl::WriteFullPathRequest*
+Arena::CreateMaybeMessage< ::oram_impl::WriteFullPathRequest >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::oram_impl::WriteFullPathRequest >(arena);
+}
+template<> PROTOBUF_NOINLINE ::oram_impl::SlotListMessage*
+Arena::CreateMaybeMessage< ::oram_impl::SlotListMessage >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::oram_impl::SlotListMessage >(arena);
+}
+template<> PROTOBUF_NOINLINE ::oram_impl::ReadSlotsRequest*
+Arena::CreateMaybeMessage< ::oram_impl::ReadSlotsRequest >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::oram_impl::ReadSlotsRequest >(arena);
+}
+template<> PROTOBUF_NOINLINE ::oram_impl::WriteSlotsRequest*
+Arena::CreateMaybeMessage< ::oram_impl::WriteSlotsRequest >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::oram_impl::WriteSlotsRequest >(arena);
+}
+template<> PROTOBUF_NOINLINE ::oram_impl::BulkLoadBucketMessage*
+Arena::CreateMaybeMessage< ::oram_impl::BulkLoadBucketMessage >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::oram_impl::BulkLoadBucketMessage >(arena);
+}
+template<> PROTOBUF_NOINLINE ::oram_impl::BulkLoadRequest*
+Arena::CreateMaybeMessage< ::oram_impl::BulkLoadRequest >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::oram_impl::BulkLoadRequest >(arena);
+}
 template<> PROTOBUF_NOINLINE ::oram_impl::WritePathResponse*
 Arena::CreateMaybeMessage< ::oram_impl::WritePathResponse >(Arena* arena) {
   return Arena::CreateMessageInternal< ::oram_impl::WritePathResponse >(arena);
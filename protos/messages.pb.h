@@ -48,6 +48,15 @@ struct TableStruct_messages_2eproto {
 };
 extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_messages_2eproto;
 namespace oram_impl {
+class BucketMessage;
+struct BucketMessageDefaultTypeInternal;
+extern BucketMessageDefaultTypeInternal _BucketMessage_default_instance_;
+class BulkLoadBucketMessage;
+struct BulkLoadBucketMessageDefaultTypeInternal;
+extern BulkLoadBucketMessageDefaultTypeInternal _BulkLoadBucketMessage_default_instance_;
+class BulkLoadRequest;
+struct BulkLoadRequestDefaultTypeInternal;
+extern BulkLoadRequestDefaultTypeInternal _BulkLoadRequest_default_instance_;
 class FlatVectorMessage;
 struct FlatVectorMessageDefaultTypeInternal;
 extern FlatVectorMessageDefaultTypeInternal _FlatVectorMessage_default_instance_;
@@ -78,35 +87,56 @@ extern PrintOramTreeRequestDefaultTypeInternal _PrintOramTreeRequest_default_ins
 class ReadFlatRequest;
 struct ReadFlatRequestDefaultTypeInternal;
 extern ReadFlatRequestDefaultTypeInternal _ReadFlatRequest_default_instance_;
+class ReadFullPathRequest;
+struct ReadFullPathRequestDefaultTypeInternal;
+extern ReadFullPathRequestDefaultTypeInternal _ReadFullPathRequest_default_instance_;
+class ReadFullPathResponse;
+struct ReadFullPathResponseDefaultTypeInternal;
+extern ReadFullPathResponseDefaultTypeInternal _ReadFullPathResponse_default_instance_;
 class ReadPathRequest;
 struct ReadPathRequestDefaultTypeInternal;
 extern ReadPathRequestDefaultTypeInternal _ReadPathRequest_default_instance_;
 class ReadPathResponse;
 struct ReadPathResponseDefaultTypeInternal;
 extern ReadPathResponseDefaultTypeInternal _ReadPathResponse_default_instance_;
+class ReadSlotsRequest;
+struct ReadSlotsRequestDefaultTypeInternal;
+extern ReadSlotsRequestDefaultTypeInternal _ReadSlotsRequest_default_instance_;
 class ReadSqrtRequest;
 struct ReadSqrtRequestDefaultTypeInternal;
 extern ReadSqrtRequestDefaultTypeInternal _ReadSqrtRequest_default_instance_;
 class RequestHeader;
 struct RequestHeaderDefaultTypeInternal;
 extern RequestHeaderDefaultTypeInternal _RequestHeader_default_instance_;
+class SlotListMessage;
+struct SlotListMessageDefaultTypeInternal;
+extern SlotListMessageDefaultTypeInternal _SlotListMessage_default_instance_;
 class SqrtMessage;
 struct SqrtMessageDefaultTypeInternal;
 extern SqrtMessageDefaultTypeInternal _SqrtMessage_default_instance_;
 class SqrtPermMessage;
 struct SqrtPermMessageDefaultTypeInternal;
 extern SqrtPermMessageDefaultTypeInternal _SqrtPermMessage_default_instance_;
+class WriteFullPathRequest;
+struct WriteFullPathRequestDefaultTypeInternal;
+extern WriteFullPathRequestDefaultTypeInternal _WriteFullPathRequest_default_instance_;
 class WritePathRequest;
 struct WritePathRequestDefaultTypeInternal;
 extern WritePathRequestDefaultTypeInternal _WritePathRequest_default_instance_;
 class WritePathResponse;
 struct WritePathResponseDefaultTypeInternal;
 extern WritePathResponseDefaultTypeInternal _WritePathResponse_default_instance_;
+class WriteSlotsRequest;
+struct WriteSlotsRequestDefaultTypeInternal;
+extern WriteSlotsRequestDefaultTypeInternal _WriteSlotsRequest_default_instance_;
 class WriteSqrtMessage;
 struct WriteSqrtMessageDefaultTypeInternal;
 extern WriteSqrtMessageDefaultTypeInternal _WriteSqrtMessage_default_instance_;
 }  // namespace oram_impl
 PROTOBUF_NAMESPACE_OPEN
+template<> ::oram_impl::BucketMessage* Arena::CreateMaybeMessage<::oram_impl::BucketMessage>(Arena*);
+template<> ::oram_impl::BulkLoadBucketMessage* Arena::CreateMaybeMessage<::oram_impl::BulkLoadBucketMessage>(Arena*);
+template<> ::oram_impl::BulkLoadRequest* Arena::CreateMaybeMessage<::oram_impl::BulkLoadRequest>(Arena*);
 template<> ::oram_impl::FlatVectorMessage* Arena::CreateMaybeMessage<::oram_impl::FlatVectorMessage>(Arena*);
 template<> ::oram_impl::HelloMessage* Arena::CreateMaybeMessage<::oram_impl::HelloMessage>(Arena*);
 template<> ::oram_impl::InitFlatOramRequest* Arena::CreateMaybeMessage<::oram_impl::InitFlatOramRequest>(Arena*);
@@ -117,14 +147,20 @@ template<> ::oram_impl::KeyExchangeResponse* Arena::CreateMaybeMessage<::oram_im
 template<> ::oram_impl::LoadSqrtOramRequest* Arena::CreateMaybeMessage<::oram_impl::LoadSqrtOramRequest>(Arena*);
 template<> ::oram_impl::PrintOramTreeRequest* Arena::CreateMaybeMessage<::oram_impl::PrintOramTreeRequest>(Arena*);
 template<> ::oram_impl::ReadFlatRequest* Arena::CreateMaybeMessage<::oram_impl::ReadFlatRequest>(Arena*);
+template<> ::oram_impl::ReadFullPathRequest* Arena::CreateMaybeMessage<::oram_impl::ReadFullPathRequest>(Arena*);
+template<> ::oram_impl::ReadFullPathResponse* Arena::CreateMaybeMessage<::oram_impl::ReadFullPathResponse>(Arena*);
 template<> ::oram_impl::ReadPathRequest* Arena::CreateMaybeMessage<::oram_impl::ReadPathRequest>(Arena*);
 template<> ::oram_impl::ReadPathResponse* Arena::CreateMaybeMessage<::oram_impl::ReadPathResponse>(Arena*);
+template<> ::oram_impl::ReadSlotsRequest* Arena::CreateMaybeMessage<::oram_impl::ReadSlotsRequest>(Arena*);
 template<> ::oram_impl::ReadSqrtRequest* Arena::CreateMaybeMessage<::oram_impl::ReadSqrtRequest>(Arena*);
 template<> ::oram_impl::RequestHeader* Arena::CreateMaybeMessage<::oram_impl::RequestHeader>(Arena*);
+template<> ::oram_impl::SlotListMessage* Arena::CreateMaybeMessage<::oram_impl::SlotListMessage>(Arena*);
 template<> ::oram_impl::SqrtMessage* Arena::CreateMaybeMessage<::oram_impl::SqrtMessage>(Arena*);
 template<> ::oram_impl::SqrtPermMessage* Arena::CreateMaybeMessage<::oram_impl::SqrtPermMessage>(Arena*);
+template<> ::oram_impl::WriteFullPathRequest* Arena::CreateMaybeMessage<::oram_impl::WriteFullPathRequest>(Arena*);
 template<> ::oram_impl::WritePathRequest* Arena::CreateMaybeMessage<::oram_impl::WritePathRequest>(Arena*);
 template<> ::oram_impl::WritePathResponse* Arena::CreateMaybeMessage<::oram_impl::WritePathResponse>(Arena*);
+template<> ::oram_impl::WriteSlotsRequest* Arena::CreateMaybeMessage<::oram_impl::WriteSlotsRequest>(Arena*);
 template<> ::oram_impl::WriteSqrtMessage* Arena::CreateMaybeMessage<::oram_impl::WriteSqrtMessage>(Arena*);
 PROTOBUF_NAMESPACE_CLOSE
 namespace oram_impl {
@@ -3340,23 +3376,24 @@ class WritePathRequest final :
 };
 // -------------------------------------------------------------------
 
-class WritePathResponse final :
-    public ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase /* @@protoc_insertion_point(class_definition:oram_impl.WritePathResponse) */ {
+class BucketMessage final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:oram_impl.BucketMessage) */ {
  public:
-  inline WritePathResponse() : WritePathResponse(nullptr) {}
-  explicit PROTOBUF_CONSTEXPR WritePathResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  inline BucketMessage() : BucketMessage(nullptr) {}
+  ~BucketMessage() override;
+  explicit PROTOBUF_CONSTEXPR BucketMessage(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  WritePathResponse(const WritePathResponse& from);
-  WritePathResponse(WritePathResponse&& from) noexcept
-    : WritePathResponse() {
+  BucketMessage(const BucketMessage& from);
+  BucketMessage(BucketMessage&& from) noexcept
+    : BucketMessage() {
     *this = ::std::move(from);
   }
 
-  inline WritePathResponse& operator=(const WritePathResponse& from) {
+  inline BucketMessage& operator=(const BucketMessage& from) {
     CopyFrom(from);
     return *this;
   }
-  inline WritePathResponse& operator=(WritePathResponse&& from) noexcept {
+  inline BucketMessage& operator=(BucketMessage&& from) noexcept {
     if (this == &from) return *this;
     if (GetOwningArena() == from.GetOwningArena()
   #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
@@ -3379,20 +3416,20 @@ class WritePathResponse final :
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
     return default_instance().GetMetadata().reflection;
   }
-  static const WritePathResponse& default_instance() {
+  static const BucketMessage& default_instance() {
     return *internal_default_instance();
   }
-  static inline const WritePathResponse* internal_default_instance() {
-    return reinterpret_cast<const WritePathResponse*>(
-               &_WritePathResponse_default_instance_);
+  static inline const BucketMessage* internal_default_instance() {
+    return reinterpret_cast<const BucketMessage*>(
+               &_BucketMessage_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
     18;
 
-  friend void swap(WritePathResponse& a, WritePathResponse& b) {
+  friend void swap(BucketMessage& a, BucketMessage& b) {
     a.Swap(&b);
   }
-  inline void Swap(WritePathResponse* other) {
+  inline void Swap(BucketMessage* other) {
     if (other == this) return;
   #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
     if (GetOwningArena() != nullptr &&
@@ -3405,7 +3442,7 @@ class WritePathResponse final :
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(WritePathResponse* other) {
+  void UnsafeArenaSwap(BucketMessage* other) {
     if (other == this) return;
     GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
@@ -3413,26 +3450,40 @@ class WritePathResponse final :
 
   // implements Message ----------------------------------------------
 
-  WritePathResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
-    return CreateMaybeMessage<WritePathResponse>(arena);
-  }
-  using ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyFrom;
-  inline void CopyFrom(const WritePathResponse& from) {
-    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyImpl(*this, from);
+  BucketMessage* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<BucketMessage>(arena);
   }
-  using ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeFrom;
-  void MergeFrom(const WritePathResponse& from) {
-    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeImpl(*this, from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const BucketMessage& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const BucketMessage& from) {
+    BucketMessage::MergeImpl(*this, from);
   }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
   public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(BucketMessage* other);
 
   private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "oram_impl.WritePathResponse";
+    return "oram_impl.BucketMessage";
   }
   protected:
-  explicit WritePathResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+  explicit BucketMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                        bool is_message_owned = false);
   public:
 
@@ -3445,7 +3496,34 @@ class WritePathResponse final :
 
   // accessors -------------------------------------------------------
 
-  // @@protoc_insertion_point(class_scope:oram_impl.WritePathResponse)
+  enum : int {
+    kBucketFieldNumber = 1,
+  };
+  // repeated bytes bucket = 1;
+  int bucket_size() const;
+  private:
+  int _internal_bucket_size() const;
+  public:
+  void clear_bucket();
+  const std::string& bucket(int index) const;
+  std::string* mutable_bucket(int index);
+  void set_bucket(int index, const std::string& value);
+  void set_bucket(int index, std::string&& value);
+  void set_bucket(int index, const char* value);
+  void set_bucket(int index, const void* value, size_t size);
+  std::string* add_bucket();
+  void add_bucket(const std::string& value);
+  void add_bucket(std::string&& value);
+  void add_bucket(const char* value);
+  void add_bucket(const void* value, size_t size);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>& bucket() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>* mutable_bucket();
+  private:
+  const std::string& _internal_bucket(int index) const;
+  std::string* _internal_add_bucket();
+  public:
+
+  // @@protoc_insertion_point(class_scope:oram_impl.BucketMessage)
  private:
   class _Internal;
 
@@ -3453,204 +3531,2565 @@ class WritePathResponse final :
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
   struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> bucket_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
   };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_messages_2eproto;
 };
-// ===================================================================
-
+// -------------------------------------------------------------------
 
-// ===================================================================
+class ReadFullPathRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:oram_impl.ReadFullPathRequest) */ {
+ public:
+  inline ReadFullPathRequest() : ReadFullPathRequest(nullptr) {}
+  ~ReadFullPathRequest() override;
+  explicit PROTOBUF_CONSTEXPR ReadFullPathRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-#ifdef __GNUC__
-  #pragma GCC diagnostic push
-  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
-#endif  // __GNUC__
-// RequestHeader
+  ReadFullPathRequest(const ReadFullPathRequest& from);
+  ReadFullPathRequest(ReadFullPathRequest&& from) noexcept
+    : ReadFullPathRequest() {
+    *this = ::std::move(from);
+  }
 
-// bytes instance_hash = 1;
-inline void RequestHeader::clear_instance_hash() {
-  _impl_.instance_hash_.ClearToEmpty();
-}
-inline const std::string& RequestHeader::instance_hash() const {
-  // @@protoc_insertion_point(field_get:oram_impl.RequestHeader.instance_hash)
-  return _internal_instance_hash();
-}
-template <typename ArgT0, typename... ArgT>
-inline PROTOBUF_ALWAYS_INLINE
-void RequestHeader::set_instance_hash(ArgT0&& arg0, ArgT... args) {
- 
- _impl_.instance_hash_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:oram_impl.RequestHeader.instance_hash)
-}
-inline std::string* RequestHeader::mutable_instance_hash() {
-  std::string* _s = _internal_mutable_instance_hash();
-  // @@protoc_insertion_point(field_mutable:oram_impl.RequestHeader.instance_hash)
-  return _s;
-}
-inline const std::string& RequestHeader::_internal_instance_hash() const {
-  return _impl_.instance_hash_.Get();
-}
-inline void RequestHeader::_internal_set_instance_hash(const std::string& value) {
-  
-  _impl_.instance_hash_.Set(value, GetArenaForAllocation());
-}
-inline std::string* RequestHeader::_internal_mutable_instance_hash() {
-  
-  return _impl_.instance_hash_.Mutable(GetArenaForAllocation());
-}
-inline std::string* RequestHeader::release_instance_hash() {
-  // @@protoc_insertion_point(field_release:oram_impl.RequestHeader.instance_hash)
-  return _impl_.instance_hash_.Release();
-}
-inline void RequestHeader::set_allocated_instance_hash(std::string* instance_hash) {
-  if (instance_hash != nullptr) {
-    
-  } else {
-    
+  inline ReadFullPathRequest& operator=(const ReadFullPathRequest& from) {
+    CopyFrom(from);
+    return *this;
   }
-  _impl_.instance_hash_.SetAllocated(instance_hash, GetArenaForAllocation());
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (_impl_.instance_hash_.IsDefault()) {
-    _impl_.instance_hash_.Set("", GetArenaForAllocation());
+  inline ReadFullPathRequest& operator=(ReadFullPathRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
   }
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:oram_impl.RequestHeader.instance_hash)
-}
 
-// bytes version = 2;
-inline void RequestHeader::clear_version() {
-  _impl_.version_.ClearToEmpty();
-}
-inline const std::string& RequestHeader::version() const {
-  // @@protoc_insertion_point(field_get:oram_impl.RequestHeader.version)
-  return _internal_version();
-}
-template <typename ArgT0, typename... ArgT>
-inline PROTOBUF_ALWAYS_INLINE
-void RequestHeader::set_version(ArgT0&& arg0, ArgT... args) {
- 
- _impl_.version_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:oram_impl.RequestHeader.version)
-}
-inline std::string* RequestHeader::mutable_version() {
-  std::string* _s = _internal_mutable_version();
-  // @@protoc_insertion_point(field_mutable:oram_impl.RequestHeader.version)
-  return _s;
-}
-inline const std::string& RequestHeader::_internal_version() const {
-  return _impl_.version_.Get();
-}
-inline void RequestHeader::_internal_set_version(const std::string& value) {
-  
-  _impl_.version_.Set(value, GetArenaForAllocation());
-}
-inline std::string* RequestHeader::_internal_mutable_version() {
-  
-  return _impl_.version_.Mutable(GetArenaForAllocation());
-}
-inline std::string* RequestHeader::release_version() {
-  // @@protoc_insertion_point(field_release:oram_impl.RequestHeader.version)
-  return _impl_.version_.Release();
-}
-inline void RequestHeader::set_allocated_version(std::string* version) {
-  if (version != nullptr) {
-    
-  } else {
-    
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
   }
-  _impl_.version_.SetAllocated(version, GetArenaForAllocation());
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (_impl_.version_.IsDefault()) {
-    _impl_.version_.Set("", GetArenaForAllocation());
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
   }
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:oram_impl.RequestHeader.version)
-}
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ReadFullPathRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ReadFullPathRequest* internal_default_instance() {
+    return reinterpret_cast<const ReadFullPathRequest*>(
+               &_ReadFullPathRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    19;
 
-// uint32 id = 3;
-inline void RequestHeader::clear_id() {
-  _impl_.id_ = 0u;
-}
-inline uint32_t RequestHeader::_internal_id() const {
-  return _impl_.id_;
-}
-inline uint32_t RequestHeader::id() const {
-  // @@protoc_insertion_point(field_get:oram_impl.RequestHeader.id)
-  return _internal_id();
-}
-inline void RequestHeader::_internal_set_id(uint32_t value) {
-  
-  _impl_.id_ = value;
-}
-inline void RequestHeader::set_id(uint32_t value) {
-  _internal_set_id(value);
-  // @@protoc_insertion_point(field_set:oram_impl.RequestHeader.id)
-}
+  friend void swap(ReadFullPathRequest& a, ReadFullPathRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ReadFullPathRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ReadFullPathRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
-// -------------------------------------------------------------------
+  // implements Message ----------------------------------------------
 
-// PrintOramTreeRequest
+  ReadFullPathRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ReadFullPathRequest>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ReadFullPathRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ReadFullPathRequest& from) {
+    ReadFullPathRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
 
-// uint32 id = 1;
-inline void PrintOramTreeRequest::clear_id() {
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ReadFullPathRequest* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "oram_impl.ReadFullPathRequest";
+  }
+  protected:
+  explicit ReadFullPathRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kHeaderFieldNumber = 1,
+    kPathFieldNumber = 2,
+    kStartLevelFieldNumber = 3,
+  };
+  // .oram_impl.RequestHeader header = 1;
+  bool has_header() const;
+  private:
+  bool _internal_has_header() const;
+  public:
+  void clear_header();
+  const ::oram_impl::RequestHeader& header() const;
+  PROTOBUF_NODISCARD ::oram_impl::RequestHeader* release_header();
+  ::oram_impl::RequestHeader* mutable_header();
+  void set_allocated_header(::oram_impl::RequestHeader* header);
+  private:
+  const ::oram_impl::RequestHeader& _internal_header() const;
+  ::oram_impl::RequestHeader* _internal_mutable_header();
+  public:
+  void unsafe_arena_set_allocated_header(
+      ::oram_impl::RequestHeader* header);
+  ::oram_impl::RequestHeader* unsafe_arena_release_header();
+
+  // uint32 path = 2;
+  void clear_path();
+  uint32_t path() const;
+  void set_path(uint32_t value);
+  private:
+  uint32_t _internal_path() const;
+  void _internal_set_path(uint32_t value);
+  public:
+
+  // uint32 start_level = 3;
+  void clear_start_level();
+  uint32_t start_level() const;
+  void set_start_level(uint32_t value);
+  private:
+  uint32_t _internal_start_level() const;
+  void _internal_set_start_level(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:oram_impl.ReadFullPathRequest)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::oram_impl::RequestHeader* header_;
+    uint32_t path_;
+    uint32_t start_level_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_messages_2eproto;
+};
+// -------------------------------------------------------------------
+
+class ReadFullPathResponse final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:oram_impl.ReadFullPathResponse) */ {
+ public:
+  inline ReadFullPathResponse() : ReadFullPathResponse(nullptr) {}
+  ~ReadFullPathResponse() override;
+  explicit PROTOBUF_CONSTEXPR ReadFullPathResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ReadFullPathResponse(const ReadFullPathResponse& from);
+  ReadFullPathResponse(ReadFullPathResponse&& from) noexcept
+    : ReadFullPathResponse() {
+    *this = ::std::move(from);
+  }
+
+  inline ReadFullPathResponse& operator=(const ReadFullPathResponse& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ReadFullPathResponse& operator=(ReadFullPathResponse&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ReadFullPathResponse& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ReadFullPathResponse* internal_default_instance() {
+    return reinterpret_cast<const ReadFullPathResponse*>(
+               &_ReadFullPathResponse_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    20;
+
+  friend void swap(ReadFullPathResponse& a, ReadFullPathResponse& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ReadFullPathResponse* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ReadFullPathResponse* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ReadFullPathResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ReadFullPathResponse>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ReadFullPathResponse& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ReadFullPathResponse& from) {
+    ReadFullPathResponse::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ReadFullPathResponse* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "oram_impl.ReadFullPathResponse";
+  }
+  protected:
+  explicit ReadFullPathResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kBucketsFieldNumber = 1,
+  };
+  // repeated .oram_impl.BucketMessage buckets = 1;
+  int buckets_size() const;
+  private:
+  int _internal_buckets_size() const;
+  public:
+  void clear_buckets();
+  ::oram_impl::BucketMessage* mutable_buckets(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::oram_impl::BucketMessage >*
+      mutable_buckets();
+  private:
+  const ::oram_impl::BucketMessage& _internal_buckets(int index) const;
+  ::oram_impl::BucketMessage* _internal_add_buckets();
+  public:
+  const ::oram_impl::BucketMessage& buckets(int index) const;
+  ::oram_impl::BucketMessage* add_buckets();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::oram_impl::BucketMessage >&
+      buckets() const;
+
+  // @@protoc_insertion_point(class_scope:oram_impl.ReadFullPathResponse)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::oram_impl::BucketMessage > buckets_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_messages_2eproto;
+};
+// -------------------------------------------------------------------
+
+class WriteFullPathRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:oram_impl.WriteFullPathRequest) */ {
+ public:
+  inline WriteFullPathRequest() : WriteFullPathRequest(nullptr) {}
+  ~WriteFullPathRequest() override;
+  explicit PROTOBUF_CONSTEXPR WriteFullPathRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  WriteFullPathRequest(const WriteFullPathRequest& from);
+  WriteFullPathRequest(WriteFullPathRequest&& from) noexcept
+    : WriteFullPathRequest() {
+    *this = ::std::move(from);
+  }
+
+  inline WriteFullPathRequest& operator=(const WriteFullPathRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline WriteFullPathRequest& operator=(WriteFullPathRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const WriteFullPathRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const WriteFullPathRequest* internal_default_instance() {
+    return reinterpret_cast<const WriteFullPathRequest*>(
+               &_WriteFullPathRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    21;
+
+  friend void swap(WriteFullPathRequest& a, WriteFullPathRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(WriteFullPathRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(WriteFullPathRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  WriteFullPathRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<WriteFullPathRequest>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const WriteFullPathRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const WriteFullPathRequest& from) {
+    WriteFullPathRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(WriteFullPathRequest* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "oram_impl.WriteFullPathRequest";
+  }
+  protected:
+  explicit WriteFullPathRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kBucketsFieldNumber = 3,
+    kHeaderFieldNumber = 1,
+    kPathFieldNumber = 2,
+    kStartLevelFieldNumber = 4,
+  };
+  // repeated .oram_impl.BucketMessage buckets = 3;
+  int buckets_size() const;
+  private:
+  int _internal_buckets_size() const;
+  public:
+  void clear_buckets();
+  ::oram_impl::BucketMessage* mutable_buckets(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::oram_impl::BucketMessage >*
+      mutable_buckets();
+  private:
+  const ::oram_impl::BucketMessage& _internal_buckets(int index) const;
+  ::oram_impl::BucketMessage* _internal_add_buckets();
+  public:
+  const ::oram_impl::BucketMessage& buckets(int index) const;
+  ::oram_impl::BucketMessage* add_buckets();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::oram_impl::BucketMessage >&
+      buckets() const;
+
+  // .oram_impl.RequestHeader header = 1;
+  bool has_header() const;
+  private:
+  bool _internal_has_header() const;
+  public:
+  void clear_header();
+  const ::oram_impl::RequestHeader& header() const;
+  PROTOBUF_NODISCARD ::oram_impl::RequestHeader* release_header();
+  ::oram_impl::RequestHeader* mutable_header();
+  void set_allocated_header(::oram_impl::RequestHeader* header);
+  private:
+  const ::oram_impl::RequestHeader& _internal_header() const;
+  ::oram_impl::RequestHeader* _internal_mutable_header();
+  public:
+  void unsafe_arena_set_allocated_header(
+      ::oram_impl::RequestHeader* header);
+  ::oram_impl::RequestHeader* unsafe_arena_release_header();
+
+  // uint32 path = 2;
+  void clear_path();
+  uint32_t path() const;
+  void set_path(uint32_t value);
+  private:
+  uint32_t _internal_path() const;
+  void _internal_set_path(uint32_t value);
+  public:
+
+  // uint32 start_level = 4;
+  void clear_start_level();
+  uint32_t start_level() const;
+  void set_start_level(uint32_t value);
+  private:
+  uint32_t _internal_start_level() const;
+  void _internal_set_start_level(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:oram_impl.WriteFullPathRequest)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::oram_impl::BucketMessage > buckets_;
+    ::oram_impl::RequestHeader* header_;
+    uint32_t path_;
+    uint32_t start_level_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_messages_2eproto;
+};
+// -------------------------------------------------------------------
+
+class SlotListMessage final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:oram_impl.SlotListMessage) */ {
+ public:
+  inline SlotListMessage() : SlotListMessage(nullptr) {}
+  ~SlotListMessage() override;
+  explicit PROTOBUF_CONSTEXPR SlotListMessage(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  SlotListMessage(const SlotListMessage& from);
+  SlotListMessage(SlotListMessage&& from) noexcept
+    : SlotListMessage() {
+    *this = ::std::move(from);
+  }
+
+  inline SlotListMessage& operator=(const SlotListMessage& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline SlotListMessage& operator=(SlotListMessage&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const SlotListMessage& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const SlotListMessage* internal_default_instance() {
+    return reinterpret_cast<const SlotListMessage*>(
+               &_SlotListMessage_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    22;
+
+  friend void swap(SlotListMessage& a, SlotListMessage& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(SlotListMessage* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(SlotListMessage* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  SlotListMessage* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<SlotListMessage>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const SlotListMessage& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const SlotListMessage& from) {
+    SlotListMessage::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(SlotListMessage* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "oram_impl.SlotListMessage";
+  }
+  protected:
+  explicit SlotListMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kSlotFieldNumber = 1,
+  };
+  // repeated uint32 slot = 1;
+  int slot_size() const;
+  private:
+  int _internal_slot_size() const;
+  public:
+  void clear_slot();
+  private:
+  uint32_t _internal_slot(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+      _internal_slot() const;
+  void _internal_add_slot(uint32_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+      _internal_mutable_slot();
+  public:
+  uint32_t slot(int index) const;
+  void set_slot(int index, uint32_t value);
+  void add_slot(uint32_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+      slot() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+      mutable_slot();
+
+  // @@protoc_insertion_point(class_scope:oram_impl.SlotListMessage)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t > slot_;
+    mutable std::atomic<int> _slot_cached_byte_size_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_messages_2eproto;
+};
+// -------------------------------------------------------------------
+
+class ReadSlotsRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:oram_impl.ReadSlotsRequest) */ {
+ public:
+  inline ReadSlotsRequest() : ReadSlotsRequest(nullptr) {}
+  ~ReadSlotsRequest() override;
+  explicit PROTOBUF_CONSTEXPR ReadSlotsRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ReadSlotsRequest(const ReadSlotsRequest& from);
+  ReadSlotsRequest(ReadSlotsRequest&& from) noexcept
+    : ReadSlotsRequest() {
+    *this = ::std::move(from);
+  }
+
+  inline ReadSlotsRequest& operator=(const ReadSlotsRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ReadSlotsRequest& operator=(ReadSlotsRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ReadSlotsRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ReadSlotsRequest* internal_default_instance() {
+    return reinterpret_cast<const ReadSlotsRequest*>(
+               &_ReadSlotsRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    23;
+
+  friend void swap(ReadSlotsRequest& a, ReadSlotsRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ReadSlotsRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ReadSlotsRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ReadSlotsRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ReadSlotsRequest>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ReadSlotsRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ReadSlotsRequest& from) {
+    ReadSlotsRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ReadSlotsRequest* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "oram_impl.ReadSlotsRequest";
+  }
+  protected:
+  explicit ReadSlotsRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kSlotsFieldNumber = 3,
+    kHeaderFieldNumber = 1,
+    kPathFieldNumber = 2,
+  };
+  // repeated .oram_impl.SlotListMessage slots = 3;
+  int slots_size() const;
+  private:
+  int _internal_slots_size() const;
+  public:
+  void clear_slots();
+  ::oram_impl::SlotListMessage* mutable_slots(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::oram_impl::SlotListMessage >*
+      mutable_slots();
+  private:
+  const ::oram_impl::SlotListMessage& _internal_slots(int index) const;
+  ::oram_impl::SlotListMessage* _internal_add_slots();
+  public:
+  const ::oram_impl::SlotListMessage& slots(int index) const;
+  ::oram_impl::SlotListMessage* add_slots();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::oram_impl::SlotListMessage >&
+      slots() const;
+
+  // .oram_impl.RequestHeader header = 1;
+  bool has_header() const;
+  private:
+  bool _internal_has_header() const;
+  public:
+  void clear_header();
+  const ::oram_impl::RequestHeader& header() const;
+  PROTOBUF_NODISCARD ::oram_impl::RequestHeader* release_header();
+  ::oram_impl::RequestHeader* mutable_header();
+  void set_allocated_header(::oram_impl::RequestHeader* header);
+  private:
+  const ::oram_impl::RequestHeader& _internal_header() const;
+  ::oram_impl::RequestHeader* _internal_mutable_header();
+  public:
+  void unsafe_arena_set_allocated_header(
+      ::oram_impl::RequestHeader* header);
+  ::oram_impl::RequestHeader* unsafe_arena_release_header();
+
+  // uint32 path = 2;
+  void clear_path();
+  uint32_t path() const;
+  void set_path(uint32_t value);
+  private:
+  uint32_t _internal_path() const;
+  void _internal_set_path(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:oram_impl.ReadSlotsRequest)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::oram_impl::SlotListMessage > slots_;
+    ::oram_impl::RequestHeader* header_;
+    uint32_t path_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_messages_2eproto;
+};
+// -------------------------------------------------------------------
+
+class WriteSlotsRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:oram_impl.WriteSlotsRequest) */ {
+ public:
+  inline WriteSlotsRequest() : WriteSlotsRequest(nullptr) {}
+  ~WriteSlotsRequest() override;
+  explicit PROTOBUF_CONSTEXPR WriteSlotsRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  WriteSlotsRequest(const WriteSlotsRequest& from);
+  WriteSlotsRequest(WriteSlotsRequest&& from) noexcept
+    : WriteSlotsRequest() {
+    *this = ::std::move(from);
+  }
+
+  inline WriteSlotsRequest& operator=(const WriteSlotsRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline WriteSlotsRequest& operator=(WriteSlotsRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const WriteSlotsRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const WriteSlotsRequest* internal_default_instance() {
+    return reinterpret_cast<const WriteSlotsRequest*>(
+               &_WriteSlotsRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    24;
+
+  friend void swap(WriteSlotsRequest& a, WriteSlotsRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(WriteSlotsRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(WriteSlotsRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  WriteSlotsRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<WriteSlotsRequest>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const WriteSlotsRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const WriteSlotsRequest& from) {
+    WriteSlotsRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(WriteSlotsRequest* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "oram_impl.WriteSlotsRequest";
+  }
+  protected:
+  explicit WriteSlotsRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kSlotsFieldNumber = 3,
+    kBucketsFieldNumber = 4,
+    kHeaderFieldNumber = 1,
+    kPathFieldNumber = 2,
+  };
+  // repeated .oram_impl.SlotListMessage slots = 3;
+  int slots_size() const;
+  private:
+  int _internal_slots_size() const;
+  public:
+  void clear_slots();
+  ::oram_impl::SlotListMessage* mutable_slots(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::oram_impl::SlotListMessage >*
+      mutable_slots();
+  private:
+  const ::oram_impl::SlotListMessage& _internal_slots(int index) const;
+  ::oram_impl::SlotListMessage* _internal_add_slots();
+  public:
+  const ::oram_impl::SlotListMessage& slots(int index) const;
+  ::oram_impl::SlotListMessage* add_slots();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::oram_impl::SlotListMessage >&
+      slots() const;
+
+  // repeated .oram_impl.BucketMessage buckets = 4;
+  int buckets_size() const;
+  private:
+  int _internal_buckets_size() const;
+  public:
+  void clear_buckets();
+  ::oram_impl::BucketMessage* mutable_buckets(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::oram_impl::BucketMessage >*
+      mutable_buckets();
+  private:
+  const ::oram_impl::BucketMessage& _internal_buckets(int index) const;
+  ::oram_impl::BucketMessage* _internal_add_buckets();
+  public:
+  const ::oram_impl::BucketMessage& buckets(int index) const;
+  ::oram_impl::BucketMessage* add_buckets();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::oram_impl::BucketMessage >&
+      buckets() const;
+
+  // .oram_impl.RequestHeader header = 1;
+  bool has_header() const;
+  private:
+  bool _internal_has_header() const;
+  public:
+  void clear_header();
+  const ::oram_impl::RequestHeader& header() const;
+  PROTOBUF_NODISCARD ::oram_impl::RequestHeader* release_header();
+  ::oram_impl::RequestHeader* mutable_header();
+  void set_allocated_header(::oram_impl::RequestHeader* header);
+  private:
+  const ::oram_impl::RequestHeader& _internal_header() const;
+  ::oram_impl::RequestHeader* _internal_mutable_header();
+  public:
+  void unsafe_arena_set_allocated_header(
+      ::oram_impl::RequestHeader* header);
+  ::oram_impl::RequestHeader* unsafe_arena_release_header();
+
+  // uint32 path = 2;
+  void clear_path();
+  uint32_t path() const;
+  void set_path(uint32_t value);
+  private:
+  uint32_t _internal_path() const;
+  void _internal_set_path(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:oram_impl.WriteSlotsRequest)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::oram_impl::SlotListMessage > slots_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::oram_impl::BucketMessage > buckets_;
+    ::oram_impl::RequestHeader* header_;
+    uint32_t path_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_messages_2eproto;
+};
+// -------------------------------------------------------------------
+
+class BulkLoadBucketMessage final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:oram_impl.BulkLoadBucketMessage) */ {
+ public:
+  inline BulkLoadBucketMessage() : BulkLoadBucketMessage(nullptr) {}
+  ~BulkLoadBucketMessage() override;
+  explicit PROTOBUF_CONSTEXPR BulkLoadBucketMessage(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  BulkLoadBucketMessage(const BulkLoadBucketMessage& from);
+  BulkLoadBucketMessage(BulkLoadBucketMessage&& from) noexcept
+    : BulkLoadBucketMessage() {
+    *this = ::std::move(from);
+  }
+
+  inline BulkLoadBucketMessage& operator=(const BulkLoadBucketMessage& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline BulkLoadBucketMessage& operator=(BulkLoadBucketMessage&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const BulkLoadBucketMessage& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const BulkLoadBucketMessage* internal_default_instance() {
+    return reinterpret_cast<const BulkLoadBucketMessage*>(
+               &_BulkLoadBucketMessage_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    25;
+
+  friend void swap(BulkLoadBucketMessage& a, BulkLoadBucketMessage& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(BulkLoadBucketMessage* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(BulkLoadBucketMessage* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  BulkLoadBucketMessage* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<BulkLoadBucketMessage>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const BulkLoadBucketMessage& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const BulkLoadBucketMessage& from) {
+    BulkLoadBucketMessage::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(BulkLoadBucketMessage* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "oram_impl.BulkLoadBucketMessage";
+  }
+  protected:
+  explicit BulkLoadBucketMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kBucketFieldNumber = 3,
+    kLevelFieldNumber = 1,
+    kOffsetFieldNumber = 2,
+  };
+  // repeated bytes bucket = 3;
+  int bucket_size() const;
+  private:
+  int _internal_bucket_size() const;
+  public:
+  void clear_bucket();
+  const std::string& bucket(int index) const;
+  std::string* mutable_bucket(int index);
+  void set_bucket(int index, const std::string& value);
+  void set_bucket(int index, std::string&& value);
+  void set_bucket(int index, const char* value);
+  void set_bucket(int index, const void* value, size_t size);
+  std::string* add_bucket();
+  void add_bucket(const std::string& value);
+  void add_bucket(std::string&& value);
+  void add_bucket(const char* value);
+  void add_bucket(const void* value, size_t size);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>& bucket() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>* mutable_bucket();
+  private:
+  const std::string& _internal_bucket(int index) const;
+  std::string* _internal_add_bucket();
+  public:
+
+  // uint32 level = 1;
+  void clear_level();
+  uint32_t level() const;
+  void set_level(uint32_t value);
+  private:
+  uint32_t _internal_level() const;
+  void _internal_set_level(uint32_t value);
+  public:
+
+  // uint32 offset = 2;
+  void clear_offset();
+  uint32_t offset() const;
+  void set_offset(uint32_t value);
+  private:
+  uint32_t _internal_offset() const;
+  void _internal_set_offset(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:oram_impl.BulkLoadBucketMessage)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> bucket_;
+    uint32_t level_;
+    uint32_t offset_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_messages_2eproto;
+};
+// -------------------------------------------------------------------
+
+class BulkLoadRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:oram_impl.BulkLoadRequest) */ {
+ public:
+  inline BulkLoadRequest() : BulkLoadRequest(nullptr) {}
+  ~BulkLoadRequest() override;
+  explicit PROTOBUF_CONSTEXPR BulkLoadRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  BulkLoadRequest(const BulkLoadRequest& from);
+  BulkLoadRequest(BulkLoadRequest&& from) noexcept
+    : BulkLoadRequest() {
+    *this = ::std::move(from);
+  }
+
+  inline BulkLoadRequest& operator=(const BulkLoadRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline BulkLoadRequest& operator=(BulkLoadRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const BulkLoadRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const BulkLoadRequest* internal_default_instance() {
+    return reinterpret_cast<const BulkLoadRequest*>(
+               &_BulkLoadRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    26;
+
+  friend void swap(BulkLoadRequest& a, BulkLoadRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(BulkLoadRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(BulkLoadRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  BulkLoadRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<BulkLoadRequest>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const BulkLoadRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const BulkLoadRequest& from) {
+    BulkLoadRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(BulkLoadRequest* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "oram_impl.BulkLoadRequest";
+  }
+  protected:
+  explicit BulkLoadRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kBucketsFieldNumber = 2,
+    kBlocksFieldNumber = 3,
+    kHeaderFieldNumber = 1,
+  };
+  // repeated .oram_impl.BulkLoadBucketMessage buckets = 2;
+  int buckets_size() const;
+  private:
+  int _internal_buckets_size() const;
+  public:
+  void clear_buckets();
+  ::oram_impl::BulkLoadBucketMessage* mutable_buckets(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::oram_impl::BulkLoadBucketMessage >*
+      mutable_buckets();
+  private:
+  const ::oram_impl::BulkLoadBucketMessage& _internal_buckets(int index) const;
+  ::oram_impl::BulkLoadBucketMessage* _internal_add_buckets();
+  public:
+  const ::oram_impl::BulkLoadBucketMessage& buckets(int index) const;
+  ::oram_impl::BulkLoadBucketMessage* add_buckets();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::oram_impl::BulkLoadBucketMessage >&
+      buckets() const;
+
+  // repeated bytes blocks = 3;
+  int blocks_size() const;
+  private:
+  int _internal_blocks_size() const;
+  public:
+  void clear_blocks();
+  const std::string& blocks(int index) const;
+  std::string* mutable_blocks(int index);
+  void set_blocks(int index, const std::string& value);
+  void set_blocks(int index, std::string&& value);
+  void set_blocks(int index, const char* value);
+  void set_blocks(int index, const void* value, size_t size);
+  std::string* add_blocks();
+  void add_blocks(const std::string& value);
+  void add_blocks(std::string&& value);
+  void add_blocks(const char* value);
+  void add_blocks(const void* value, size_t size);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>& blocks() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>* mutable_blocks();
+  private:
+  const std::string& _internal_blocks(int index) const;
+  std::string* _internal_add_blocks();
+  public:
+
+  // .oram_impl.RequestHeader header = 1;
+  bool has_header() const;
+  private:
+  bool _internal_has_header() const;
+  public:
+  void clear_header();
+  const ::oram_impl::RequestHeader& header() const;
+  PROTOBUF_NODISCARD ::oram_impl::RequestHeader* release_header();
+  ::oram_impl::RequestHeader* mutable_header();
+  void set_allocated_header(::oram_impl::RequestHeader* header);
+  private:
+  const ::oram_impl::RequestHeader& _internal_header() const;
+  ::oram_impl::RequestHeader* _internal_mutable_header();
+  public:
+  void unsafe_arena_set_allocated_header(
+      ::oram_impl::RequestHeader* header);
+  ::oram_impl::RequestHeader* unsafe_arena_release_header();
+
+  // @@protoc_insertion_point(class_scope:oram_impl.BulkLoadRequest)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::oram_impl::BulkLoadBucketMessage > buckets_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> blocks_;
+    ::oram_impl::RequestHeader* header_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_messages_2eproto;
+};
+// -------------------------------------------------------------------
+
+class WritePathResponse final :
+    public ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase /* @@protoc_insertion_point(class_definition:oram_impl.WritePathResponse) */ {
+ public:
+  inline WritePathResponse() : WritePathResponse(nullptr) {}
+  explicit PROTOBUF_CONSTEXPR WritePathResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  WritePathResponse(const WritePathResponse& from);
+  WritePathResponse(WritePathResponse&& from) noexcept
+    : WritePathResponse() {
+    *this = ::std::move(from);
+  }
+
+  inline WritePathResponse& operator=(const WritePathResponse& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline WritePathResponse& operator=(WritePathResponse&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const WritePathResponse& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const WritePathResponse* internal_default_instance() {
+    return reinterpret_cast<const WritePathResponse*>(
+               &_WritePathResponse_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    27;
+
+  friend void swap(WritePathResponse& a, WritePathResponse& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(WritePathResponse* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(WritePathResponse* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  WritePathResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<WritePathResponse>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyFrom;
+  inline void CopyFrom(const WritePathResponse& from) {
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyImpl(*this, from);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeFrom;
+  void MergeFrom(const WritePathResponse& from) {
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeImpl(*this, from);
+  }
+  public:
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "oram_impl.WritePathResponse";
+  }
+  protected:
+  explicit WritePathResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  // @@protoc_insertion_point(class_scope:oram_impl.WritePathResponse)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+  };
+  friend struct ::TableStruct_messages_2eproto;
+};
+// ===================================================================
+
+
+// ===================================================================
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// RequestHeader
+
+// bytes instance_hash = 1;
+inline void RequestHeader::clear_instance_hash() {
+  _impl_.instance_hash_.ClearToEmpty();
+}
+inline const std::string& RequestHeader::instance_hash() const {
+  // @@protoc_insertion_point(field_get:oram_impl.RequestHeader.instance_hash)
+  return _internal_instance_hash();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void RequestHeader::set_instance_hash(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.instance_hash_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:oram_impl.RequestHeader.instance_hash)
+}
+inline std::string* RequestHeader::mutable_instance_hash() {
+  std::string* _s = _internal_mutable_instance_hash();
+  // @@protoc_insertion_point(field_mutable:oram_impl.RequestHeader.instance_hash)
+  return _s;
+}
+inline const std::string& RequestHeader::_internal_instance_hash() const {
+  return _impl_.instance_hash_.Get();
+}
+inline void RequestHeader::_internal_set_instance_hash(const std::string& value) {
+  
+  _impl_.instance_hash_.Set(value, GetArenaForAllocation());
+}
+inline std::string* RequestHeader::_internal_mutable_instance_hash() {
+  
+  return _impl_.instance_hash_.Mutable(GetArenaForAllocation());
+}
+inline std::string* RequestHeader::release_instance_hash() {
+  // @@protoc_insertion_point(field_release:oram_impl.RequestHeader.instance_hash)
+  return _impl_.instance_hash_.Release();
+}
+inline void RequestHeader::set_allocated_instance_hash(std::string* instance_hash) {
+  if (instance_hash != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.instance_hash_.SetAllocated(instance_hash, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.instance_hash_.IsDefault()) {
+    _impl_.instance_hash_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:oram_impl.RequestHeader.instance_hash)
+}
+
+// bytes version = 2;
+inline void RequestHeader::clear_version() {
+  _impl_.version_.ClearToEmpty();
+}
+inline const std::string& RequestHeader::version() const {
+  // @@protoc_insertion_point(field_get:oram_impl.RequestHeader.version)
+  return _internal_version();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void RequestHeader::set_version(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.version_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:oram_impl.RequestHeader.version)
+}
+inline std::string* RequestHeader::mutable_version() {
+  std::string* _s = _internal_mutable_version();
+  // @@protoc_insertion_point(field_mutable:oram_impl.RequestHeader.version)
+  return _s;
+}
+inline const std::string& RequestHeader::_internal_version() const {
+  return _impl_.version_.Get();
+}
+inline void RequestHeader::_internal_set_version(const std::string& value) {
+  
+  _impl_.version_.Set(value, GetArenaForAllocation());
+}
+inline std::string* RequestHeader::_internal_mutable_version() {
+  
+  return _impl_.version_.Mutable(GetArenaForAllocation());
+}
+inline std::string* RequestHeader::release_version() {
+  // @@protoc_insertion_point(field_release:oram_impl.RequestHeader.version)
+  return _impl_.version_.Release();
+}
+inline void RequestHeader::set_allocated_version(std::string* version) {
+  if (version != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.version_.SetAllocated(version, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.version_.IsDefault()) {
+    _impl_.version_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:oram_impl.RequestHeader.version)
+}
+
+// uint32 id = 3;
+inline void RequestHeader::clear_id() {
+  _impl_.id_ = 0u;
+}
+inline uint32_t RequestHeader::_internal_id() const {
+  return _impl_.id_;
+}
+inline uint32_t RequestHeader::id() const {
+  // @@protoc_insertion_point(field_get:oram_impl.RequestHeader.id)
+  return _internal_id();
+}
+inline void RequestHeader::_internal_set_id(uint32_t value) {
+  
+  _impl_.id_ = value;
+}
+inline void RequestHeader::set_id(uint32_t value) {
+  _internal_set_id(value);
+  // @@protoc_insertion_point(field_set:oram_impl.RequestHeader.id)
+}
+
+// -------------------------------------------------------------------
+
+// PrintOramTreeRequest
+
+// uint32 id = 1;
+inline void PrintOramTreeRequest::clear_id() {
   _impl_.id_ = 0u;
 }
-inline uint32_t PrintOramTreeRequest::_internal_id() const {
-  return _impl_.id_;
+inline uint32_t PrintOramTreeRequest::_internal_id() const {
+  return _impl_.id_;
+}
+inline uint32_t PrintOramTreeRequest::id() const {
+  // @@protoc_insertion_point(field_get:oram_impl.PrintOramTreeRequest.id)
+  return _internal_id();
+}
+inline void PrintOramTreeRequest::_internal_set_id(uint32_t value) {
+  
+  _impl_.id_ = value;
+}
+inline void PrintOramTreeRequest::set_id(uint32_t value) {
+  _internal_set_id(value);
+  // @@protoc_insertion_point(field_set:oram_impl.PrintOramTreeRequest.id)
+}
+
+// -------------------------------------------------------------------
+
+// HelloMessage
+
+// bytes content = 1;
+inline void HelloMessage::clear_content() {
+  _impl_.content_.ClearToEmpty();
+}
+inline const std::string& HelloMessage::content() const {
+  // @@protoc_insertion_point(field_get:oram_impl.HelloMessage.content)
+  return _internal_content();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void HelloMessage::set_content(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.content_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:oram_impl.HelloMessage.content)
+}
+inline std::string* HelloMessage::mutable_content() {
+  std::string* _s = _internal_mutable_content();
+  // @@protoc_insertion_point(field_mutable:oram_impl.HelloMessage.content)
+  return _s;
+}
+inline const std::string& HelloMessage::_internal_content() const {
+  return _impl_.content_.Get();
+}
+inline void HelloMessage::_internal_set_content(const std::string& value) {
+  
+  _impl_.content_.Set(value, GetArenaForAllocation());
+}
+inline std::string* HelloMessage::_internal_mutable_content() {
+  
+  return _impl_.content_.Mutable(GetArenaForAllocation());
+}
+inline std::string* HelloMessage::release_content() {
+  // @@protoc_insertion_point(field_release:oram_impl.HelloMessage.content)
+  return _impl_.content_.Release();
+}
+inline void HelloMessage::set_allocated_content(std::string* content) {
+  if (content != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.content_.SetAllocated(content, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.content_.IsDefault()) {
+    _impl_.content_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:oram_impl.HelloMessage.content)
+}
+
+// bytes iv = 2;
+inline void HelloMessage::clear_iv() {
+  _impl_.iv_.ClearToEmpty();
+}
+inline const std::string& HelloMessage::iv() const {
+  // @@protoc_insertion_point(field_get:oram_impl.HelloMessage.iv)
+  return _internal_iv();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void HelloMessage::set_iv(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.iv_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:oram_impl.HelloMessage.iv)
+}
+inline std::string* HelloMessage::mutable_iv() {
+  std::string* _s = _internal_mutable_iv();
+  // @@protoc_insertion_point(field_mutable:oram_impl.HelloMessage.iv)
+  return _s;
+}
+inline const std::string& HelloMessage::_internal_iv() const {
+  return _impl_.iv_.Get();
+}
+inline void HelloMessage::_internal_set_iv(const std::string& value) {
+  
+  _impl_.iv_.Set(value, GetArenaForAllocation());
+}
+inline std::string* HelloMessage::_internal_mutable_iv() {
+  
+  return _impl_.iv_.Mutable(GetArenaForAllocation());
+}
+inline std::string* HelloMessage::release_iv() {
+  // @@protoc_insertion_point(field_release:oram_impl.HelloMessage.iv)
+  return _impl_.iv_.Release();
+}
+inline void HelloMessage::set_allocated_iv(std::string* iv) {
+  if (iv != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.iv_.SetAllocated(iv, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.iv_.IsDefault()) {
+    _impl_.iv_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:oram_impl.HelloMessage.iv)
+}
+
+// -------------------------------------------------------------------
+
+// KeyExchangeRequest
+
+// bytes public_key_client = 1;
+inline void KeyExchangeRequest::clear_public_key_client() {
+  _impl_.public_key_client_.ClearToEmpty();
+}
+inline const std::string& KeyExchangeRequest::public_key_client() const {
+  // @@protoc_insertion_point(field_get:oram_impl.KeyExchangeRequest.public_key_client)
+  return _internal_public_key_client();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void KeyExchangeRequest::set_public_key_client(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.public_key_client_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:oram_impl.KeyExchangeRequest.public_key_client)
+}
+inline std::string* KeyExchangeRequest::mutable_public_key_client() {
+  std::string* _s = _internal_mutable_public_key_client();
+  // @@protoc_insertion_point(field_mutable:oram_impl.KeyExchangeRequest.public_key_client)
+  return _s;
+}
+inline const std::string& KeyExchangeRequest::_internal_public_key_client() const {
+  return _impl_.public_key_client_.Get();
+}
+inline void KeyExchangeRequest::_internal_set_public_key_client(const std::string& value) {
+  
+  _impl_.public_key_client_.Set(value, GetArenaForAllocation());
+}
+inline std::string* KeyExchangeRequest::_internal_mutable_public_key_client() {
+  
+  return _impl_.public_key_client_.Mutable(GetArenaForAllocation());
+}
+inline std::string* KeyExchangeRequest::release_public_key_client() {
+  // @@protoc_insertion_point(field_release:oram_impl.KeyExchangeRequest.public_key_client)
+  return _impl_.public_key_client_.Release();
+}
+inline void KeyExchangeRequest::set_allocated_public_key_client(std::string* public_key_client) {
+  if (public_key_client != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.public_key_client_.SetAllocated(public_key_client, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.public_key_client_.IsDefault()) {
+    _impl_.public_key_client_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:oram_impl.KeyExchangeRequest.public_key_client)
+}
+
+// -------------------------------------------------------------------
+
+// KeyExchangeResponse
+
+// bytes public_key_server = 1;
+inline void KeyExchangeResponse::clear_public_key_server() {
+  _impl_.public_key_server_.ClearToEmpty();
+}
+inline const std::string& KeyExchangeResponse::public_key_server() const {
+  // @@protoc_insertion_point(field_get:oram_impl.KeyExchangeResponse.public_key_server)
+  return _internal_public_key_server();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void KeyExchangeResponse::set_public_key_server(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.public_key_server_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:oram_impl.KeyExchangeResponse.public_key_server)
+}
+inline std::string* KeyExchangeResponse::mutable_public_key_server() {
+  std::string* _s = _internal_mutable_public_key_server();
+  // @@protoc_insertion_point(field_mutable:oram_impl.KeyExchangeResponse.public_key_server)
+  return _s;
+}
+inline const std::string& KeyExchangeResponse::_internal_public_key_server() const {
+  return _impl_.public_key_server_.Get();
+}
+inline void KeyExchangeResponse::_internal_set_public_key_server(const std::string& value) {
+  
+  _impl_.public_key_server_.Set(value, GetArenaForAllocation());
+}
+inline std::string* KeyExchangeResponse::_internal_mutable_public_key_server() {
+  
+  return _impl_.public_key_server_.Mutable(GetArenaForAllocation());
+}
+inline std::string* KeyExchangeResponse::release_public_key_server() {
+  // @@protoc_insertion_point(field_release:oram_impl.KeyExchangeResponse.public_key_server)
+  return _impl_.public_key_server_.Release();
+}
+inline void KeyExchangeResponse::set_allocated_public_key_server(std::string* public_key_server) {
+  if (public_key_server != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.public_key_server_.SetAllocated(public_key_server, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.public_key_server_.IsDefault()) {
+    _impl_.public_key_server_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:oram_impl.KeyExchangeResponse.public_key_server)
+}
+
+// -------------------------------------------------------------------
+
+// InitFlatOramRequest
+
+// .oram_impl.RequestHeader header = 1;
+inline bool InitFlatOramRequest::_internal_has_header() const {
+  return this != internal_default_instance() && _impl_.header_ != nullptr;
+}
+inline bool InitFlatOramRequest::has_header() const {
+  return _internal_has_header();
+}
+inline void InitFlatOramRequest::clear_header() {
+  if (GetArenaForAllocation() == nullptr && _impl_.header_ != nullptr) {
+    delete _impl_.header_;
+  }
+  _impl_.header_ = nullptr;
+}
+inline const ::oram_impl::RequestHeader& InitFlatOramRequest::_internal_header() const {
+  const ::oram_impl::RequestHeader* p = _impl_.header_;
+  return p != nullptr ? *p : reinterpret_cast<const ::oram_impl::RequestHeader&>(
+      ::oram_impl::_RequestHeader_default_instance_);
+}
+inline const ::oram_impl::RequestHeader& InitFlatOramRequest::header() const {
+  // @@protoc_insertion_point(field_get:oram_impl.InitFlatOramRequest.header)
+  return _internal_header();
+}
+inline void InitFlatOramRequest::unsafe_arena_set_allocated_header(
+    ::oram_impl::RequestHeader* header) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.header_);
+  }
+  _impl_.header_ = header;
+  if (header) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:oram_impl.InitFlatOramRequest.header)
+}
+inline ::oram_impl::RequestHeader* InitFlatOramRequest::release_header() {
+  
+  ::oram_impl::RequestHeader* temp = _impl_.header_;
+  _impl_.header_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::oram_impl::RequestHeader* InitFlatOramRequest::unsafe_arena_release_header() {
+  // @@protoc_insertion_point(field_release:oram_impl.InitFlatOramRequest.header)
+  
+  ::oram_impl::RequestHeader* temp = _impl_.header_;
+  _impl_.header_ = nullptr;
+  return temp;
+}
+inline ::oram_impl::RequestHeader* InitFlatOramRequest::_internal_mutable_header() {
+  
+  if (_impl_.header_ == nullptr) {
+    auto* p = CreateMaybeMessage<::oram_impl::RequestHeader>(GetArenaForAllocation());
+    _impl_.header_ = p;
+  }
+  return _impl_.header_;
+}
+inline ::oram_impl::RequestHeader* InitFlatOramRequest::mutable_header() {
+  ::oram_impl::RequestHeader* _msg = _internal_mutable_header();
+  // @@protoc_insertion_point(field_mutable:oram_impl.InitFlatOramRequest.header)
+  return _msg;
+}
+inline void InitFlatOramRequest::set_allocated_header(::oram_impl::RequestHeader* header) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.header_;
+  }
+  if (header) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(header);
+    if (message_arena != submessage_arena) {
+      header = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, header, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.header_ = header;
+  // @@protoc_insertion_point(field_set_allocated:oram_impl.InitFlatOramRequest.header)
+}
+
+// uint32 capacity = 2;
+inline void InitFlatOramRequest::clear_capacity() {
+  _impl_.capacity_ = 0u;
+}
+inline uint32_t InitFlatOramRequest::_internal_capacity() const {
+  return _impl_.capacity_;
+}
+inline uint32_t InitFlatOramRequest::capacity() const {
+  // @@protoc_insertion_point(field_get:oram_impl.InitFlatOramRequest.capacity)
+  return _internal_capacity();
+}
+inline void InitFlatOramRequest::_internal_set_capacity(uint32_t value) {
+  
+  _impl_.capacity_ = value;
+}
+inline void InitFlatOramRequest::set_capacity(uint32_t value) {
+  _internal_set_capacity(value);
+  // @@protoc_insertion_point(field_set:oram_impl.InitFlatOramRequest.capacity)
+}
+
+// uint32 block_size = 3;
+inline void InitFlatOramRequest::clear_block_size() {
+  _impl_.block_size_ = 0u;
+}
+inline uint32_t InitFlatOramRequest::_internal_block_size() const {
+  return _impl_.block_size_;
+}
+inline uint32_t InitFlatOramRequest::block_size() const {
+  // @@protoc_insertion_point(field_get:oram_impl.InitFlatOramRequest.block_size)
+  return _internal_block_size();
+}
+inline void InitFlatOramRequest::_internal_set_block_size(uint32_t value) {
+  
+  _impl_.block_size_ = value;
+}
+inline void InitFlatOramRequest::set_block_size(uint32_t value) {
+  _internal_set_block_size(value);
+  // @@protoc_insertion_point(field_set:oram_impl.InitFlatOramRequest.block_size)
+}
+
+// -------------------------------------------------------------------
+
+// InitSqrtOramRequest
+
+// .oram_impl.RequestHeader header = 1;
+inline bool InitSqrtOramRequest::_internal_has_header() const {
+  return this != internal_default_instance() && _impl_.header_ != nullptr;
+}
+inline bool InitSqrtOramRequest::has_header() const {
+  return _internal_has_header();
+}
+inline void InitSqrtOramRequest::clear_header() {
+  if (GetArenaForAllocation() == nullptr && _impl_.header_ != nullptr) {
+    delete _impl_.header_;
+  }
+  _impl_.header_ = nullptr;
+}
+inline const ::oram_impl::RequestHeader& InitSqrtOramRequest::_internal_header() const {
+  const ::oram_impl::RequestHeader* p = _impl_.header_;
+  return p != nullptr ? *p : reinterpret_cast<const ::oram_impl::RequestHeader&>(
+      ::oram_impl::_RequestHeader_default_instance_);
+}
+inline const ::oram_impl::RequestHeader& InitSqrtOramRequest::header() const {
+  // @@protoc_insertion_point(field_get:oram_impl.InitSqrtOramRequest.header)
+  return _internal_header();
+}
+inline void InitSqrtOramRequest::unsafe_arena_set_allocated_header(
+    ::oram_impl::RequestHeader* header) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.header_);
+  }
+  _impl_.header_ = header;
+  if (header) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:oram_impl.InitSqrtOramRequest.header)
+}
+inline ::oram_impl::RequestHeader* InitSqrtOramRequest::release_header() {
+  
+  ::oram_impl::RequestHeader* temp = _impl_.header_;
+  _impl_.header_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::oram_impl::RequestHeader* InitSqrtOramRequest::unsafe_arena_release_header() {
+  // @@protoc_insertion_point(field_release:oram_impl.InitSqrtOramRequest.header)
+  
+  ::oram_impl::RequestHeader* temp = _impl_.header_;
+  _impl_.header_ = nullptr;
+  return temp;
+}
+inline ::oram_impl::RequestHeader* InitSqrtOramRequest::_internal_mutable_header() {
+  
+  if (_impl_.header_ == nullptr) {
+    auto* p = CreateMaybeMessage<::oram_impl::RequestHeader>(GetArenaForAllocation());
+    _impl_.header_ = p;
+  }
+  return _impl_.header_;
+}
+inline ::oram_impl::RequestHeader* InitSqrtOramRequest::mutable_header() {
+  ::oram_impl::RequestHeader* _msg = _internal_mutable_header();
+  // @@protoc_insertion_point(field_mutable:oram_impl.InitSqrtOramRequest.header)
+  return _msg;
+}
+inline void InitSqrtOramRequest::set_allocated_header(::oram_impl::RequestHeader* header) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.header_;
+  }
+  if (header) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(header);
+    if (message_arena != submessage_arena) {
+      header = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, header, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.header_ = header;
+  // @@protoc_insertion_point(field_set_allocated:oram_impl.InitSqrtOramRequest.header)
+}
+
+// uint32 capacity = 2;
+inline void InitSqrtOramRequest::clear_capacity() {
+  _impl_.capacity_ = 0u;
+}
+inline uint32_t InitSqrtOramRequest::_internal_capacity() const {
+  return _impl_.capacity_;
+}
+inline uint32_t InitSqrtOramRequest::capacity() const {
+  // @@protoc_insertion_point(field_get:oram_impl.InitSqrtOramRequest.capacity)
+  return _internal_capacity();
+}
+inline void InitSqrtOramRequest::_internal_set_capacity(uint32_t value) {
+  
+  _impl_.capacity_ = value;
+}
+inline void InitSqrtOramRequest::set_capacity(uint32_t value) {
+  _internal_set_capacity(value);
+  // @@protoc_insertion_point(field_set:oram_impl.InitSqrtOramRequest.capacity)
+}
+
+// uint32 squared_m = 3;
+inline void InitSqrtOramRequest::clear_squared_m() {
+  _impl_.squared_m_ = 0u;
+}
+inline uint32_t InitSqrtOramRequest::_internal_squared_m() const {
+  return _impl_.squared_m_;
+}
+inline uint32_t InitSqrtOramRequest::squared_m() const {
+  // @@protoc_insertion_point(field_get:oram_impl.InitSqrtOramRequest.squared_m)
+  return _internal_squared_m();
+}
+inline void InitSqrtOramRequest::_internal_set_squared_m(uint32_t value) {
+  
+  _impl_.squared_m_ = value;
+}
+inline void InitSqrtOramRequest::set_squared_m(uint32_t value) {
+  _internal_set_squared_m(value);
+  // @@protoc_insertion_point(field_set:oram_impl.InitSqrtOramRequest.squared_m)
+}
+
+// uint32 block_size = 4;
+inline void InitSqrtOramRequest::clear_block_size() {
+  _impl_.block_size_ = 0u;
+}
+inline uint32_t InitSqrtOramRequest::_internal_block_size() const {
+  return _impl_.block_size_;
+}
+inline uint32_t InitSqrtOramRequest::block_size() const {
+  // @@protoc_insertion_point(field_get:oram_impl.InitSqrtOramRequest.block_size)
+  return _internal_block_size();
 }
-inline uint32_t PrintOramTreeRequest::id() const {
-  // @@protoc_insertion_point(field_get:oram_impl.PrintOramTreeRequest.id)
-  return _internal_id();
+inline void InitSqrtOramRequest::_internal_set_block_size(uint32_t value) {
+  
+  _impl_.block_size_ = value;
 }
-inline void PrintOramTreeRequest::_internal_set_id(uint32_t value) {
+inline void InitSqrtOramRequest::set_block_size(uint32_t value) {
+  _internal_set_block_size(value);
+  // @@protoc_insertion_point(field_set:oram_impl.InitSqrtOramRequest.block_size)
+}
+
+// -------------------------------------------------------------------
+
+// LoadSqrtOramRequest
+
+// .oram_impl.RequestHeader header = 1;
+inline bool LoadSqrtOramRequest::_internal_has_header() const {
+  return this != internal_default_instance() && _impl_.header_ != nullptr;
+}
+inline bool LoadSqrtOramRequest::has_header() const {
+  return _internal_has_header();
+}
+inline void LoadSqrtOramRequest::clear_header() {
+  if (GetArenaForAllocation() == nullptr && _impl_.header_ != nullptr) {
+    delete _impl_.header_;
+  }
+  _impl_.header_ = nullptr;
+}
+inline const ::oram_impl::RequestHeader& LoadSqrtOramRequest::_internal_header() const {
+  const ::oram_impl::RequestHeader* p = _impl_.header_;
+  return p != nullptr ? *p : reinterpret_cast<const ::oram_impl::RequestHeader&>(
+      ::oram_impl::_RequestHeader_default_instance_);
+}
+inline const ::oram_impl::RequestHeader& LoadSqrtOramRequest::header() const {
+  // @@protoc_insertion_point(field_get:oram_impl.LoadSqrtOramRequest.header)
+  return _internal_header();
+}
+inline void LoadSqrtOramRequest::unsafe_arena_set_allocated_header(
+    ::oram_impl::RequestHeader* header) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.header_);
+  }
+  _impl_.header_ = header;
+  if (header) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:oram_impl.LoadSqrtOramRequest.header)
+}
+inline ::oram_impl::RequestHeader* LoadSqrtOramRequest::release_header() {
   
-  _impl_.id_ = value;
+  ::oram_impl::RequestHeader* temp = _impl_.header_;
+  _impl_.header_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::oram_impl::RequestHeader* LoadSqrtOramRequest::unsafe_arena_release_header() {
+  // @@protoc_insertion_point(field_release:oram_impl.LoadSqrtOramRequest.header)
+  
+  ::oram_impl::RequestHeader* temp = _impl_.header_;
+  _impl_.header_ = nullptr;
+  return temp;
+}
+inline ::oram_impl::RequestHeader* LoadSqrtOramRequest::_internal_mutable_header() {
+  
+  if (_impl_.header_ == nullptr) {
+    auto* p = CreateMaybeMessage<::oram_impl::RequestHeader>(GetArenaForAllocation());
+    _impl_.header_ = p;
+  }
+  return _impl_.header_;
+}
+inline ::oram_impl::RequestHeader* LoadSqrtOramRequest::mutable_header() {
+  ::oram_impl::RequestHeader* _msg = _internal_mutable_header();
+  // @@protoc_insertion_point(field_mutable:oram_impl.LoadSqrtOramRequest.header)
+  return _msg;
+}
+inline void LoadSqrtOramRequest::set_allocated_header(::oram_impl::RequestHeader* header) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.header_;
+  }
+  if (header) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(header);
+    if (message_arena != submessage_arena) {
+      header = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, header, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.header_ = header;
+  // @@protoc_insertion_point(field_set_allocated:oram_impl.LoadSqrtOramRequest.header)
+}
+
+// repeated bytes contents = 2;
+inline int LoadSqrtOramRequest::_internal_contents_size() const {
+  return _impl_.contents_.size();
+}
+inline int LoadSqrtOramRequest::contents_size() const {
+  return _internal_contents_size();
+}
+inline void LoadSqrtOramRequest::clear_contents() {
+  _impl_.contents_.Clear();
+}
+inline std::string* LoadSqrtOramRequest::add_contents() {
+  std::string* _s = _internal_add_contents();
+  // @@protoc_insertion_point(field_add_mutable:oram_impl.LoadSqrtOramRequest.contents)
+  return _s;
+}
+inline const std::string& LoadSqrtOramRequest::_internal_contents(int index) const {
+  return _impl_.contents_.Get(index);
+}
+inline const std::string& LoadSqrtOramRequest::contents(int index) const {
+  // @@protoc_insertion_point(field_get:oram_impl.LoadSqrtOramRequest.contents)
+  return _internal_contents(index);
+}
+inline std::string* LoadSqrtOramRequest::mutable_contents(int index) {
+  // @@protoc_insertion_point(field_mutable:oram_impl.LoadSqrtOramRequest.contents)
+  return _impl_.contents_.Mutable(index);
+}
+inline void LoadSqrtOramRequest::set_contents(int index, const std::string& value) {
+  _impl_.contents_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set:oram_impl.LoadSqrtOramRequest.contents)
+}
+inline void LoadSqrtOramRequest::set_contents(int index, std::string&& value) {
+  _impl_.contents_.Mutable(index)->assign(std::move(value));
+  // @@protoc_insertion_point(field_set:oram_impl.LoadSqrtOramRequest.contents)
+}
+inline void LoadSqrtOramRequest::set_contents(int index, const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.contents_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:oram_impl.LoadSqrtOramRequest.contents)
+}
+inline void LoadSqrtOramRequest::set_contents(int index, const void* value, size_t size) {
+  _impl_.contents_.Mutable(index)->assign(
+    reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:oram_impl.LoadSqrtOramRequest.contents)
+}
+inline std::string* LoadSqrtOramRequest::_internal_add_contents() {
+  return _impl_.contents_.Add();
+}
+inline void LoadSqrtOramRequest::add_contents(const std::string& value) {
+  _impl_.contents_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:oram_impl.LoadSqrtOramRequest.contents)
+}
+inline void LoadSqrtOramRequest::add_contents(std::string&& value) {
+  _impl_.contents_.Add(std::move(value));
+  // @@protoc_insertion_point(field_add:oram_impl.LoadSqrtOramRequest.contents)
+}
+inline void LoadSqrtOramRequest::add_contents(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.contents_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:oram_impl.LoadSqrtOramRequest.contents)
+}
+inline void LoadSqrtOramRequest::add_contents(const void* value, size_t size) {
+  _impl_.contents_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:oram_impl.LoadSqrtOramRequest.contents)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
+LoadSqrtOramRequest::contents() const {
+  // @@protoc_insertion_point(field_list:oram_impl.LoadSqrtOramRequest.contents)
+  return _impl_.contents_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
+LoadSqrtOramRequest::mutable_contents() {
+  // @@protoc_insertion_point(field_mutable_list:oram_impl.LoadSqrtOramRequest.contents)
+  return &_impl_.contents_;
+}
+
+// -------------------------------------------------------------------
+
+// FlatVectorMessage
+
+// .oram_impl.RequestHeader header = 1;
+inline bool FlatVectorMessage::_internal_has_header() const {
+  return this != internal_default_instance() && _impl_.header_ != nullptr;
+}
+inline bool FlatVectorMessage::has_header() const {
+  return _internal_has_header();
+}
+inline void FlatVectorMessage::clear_header() {
+  if (GetArenaForAllocation() == nullptr && _impl_.header_ != nullptr) {
+    delete _impl_.header_;
+  }
+  _impl_.header_ = nullptr;
+}
+inline const ::oram_impl::RequestHeader& FlatVectorMessage::_internal_header() const {
+  const ::oram_impl::RequestHeader* p = _impl_.header_;
+  return p != nullptr ? *p : reinterpret_cast<const ::oram_impl::RequestHeader&>(
+      ::oram_impl::_RequestHeader_default_instance_);
+}
+inline const ::oram_impl::RequestHeader& FlatVectorMessage::header() const {
+  // @@protoc_insertion_point(field_get:oram_impl.FlatVectorMessage.header)
+  return _internal_header();
+}
+inline void FlatVectorMessage::unsafe_arena_set_allocated_header(
+    ::oram_impl::RequestHeader* header) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.header_);
+  }
+  _impl_.header_ = header;
+  if (header) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:oram_impl.FlatVectorMessage.header)
+}
+inline ::oram_impl::RequestHeader* FlatVectorMessage::release_header() {
+  
+  ::oram_impl::RequestHeader* temp = _impl_.header_;
+  _impl_.header_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::oram_impl::RequestHeader* FlatVectorMessage::unsafe_arena_release_header() {
+  // @@protoc_insertion_point(field_release:oram_impl.FlatVectorMessage.header)
+  
+  ::oram_impl::RequestHeader* temp = _impl_.header_;
+  _impl_.header_ = nullptr;
+  return temp;
+}
+inline ::oram_impl::RequestHeader* FlatVectorMessage::_internal_mutable_header() {
+  
+  if (_impl_.header_ == nullptr) {
+    auto* p = CreateMaybeMessage<::oram_impl::RequestHeader>(GetArenaForAllocation());
+    _impl_.header_ = p;
+  }
+  return _impl_.header_;
+}
+inline ::oram_impl::RequestHeader* FlatVectorMessage::mutable_header() {
+  ::oram_impl::RequestHeader* _msg = _internal_mutable_header();
+  // @@protoc_insertion_point(field_mutable:oram_impl.FlatVectorMessage.header)
+  return _msg;
 }
-inline void PrintOramTreeRequest::set_id(uint32_t value) {
-  _internal_set_id(value);
-  // @@protoc_insertion_point(field_set:oram_impl.PrintOramTreeRequest.id)
+inline void FlatVectorMessage::set_allocated_header(::oram_impl::RequestHeader* header) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.header_;
+  }
+  if (header) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(header);
+    if (message_arena != submessage_arena) {
+      header = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, header, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.header_ = header;
+  // @@protoc_insertion_point(field_set_allocated:oram_impl.FlatVectorMessage.header)
 }
 
-// -------------------------------------------------------------------
-
-// HelloMessage
-
-// bytes content = 1;
-inline void HelloMessage::clear_content() {
+// bytes content = 2;
+inline void FlatVectorMessage::clear_content() {
   _impl_.content_.ClearToEmpty();
 }
-inline const std::string& HelloMessage::content() const {
-  // @@protoc_insertion_point(field_get:oram_impl.HelloMessage.content)
+inline const std::string& FlatVectorMessage::content() const {
+  // @@protoc_insertion_point(field_get:oram_impl.FlatVectorMessage.content)
   return _internal_content();
 }
 template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
-void HelloMessage::set_content(ArgT0&& arg0, ArgT... args) {
+void FlatVectorMessage::set_content(ArgT0&& arg0, ArgT... args) {
  
  _impl_.content_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:oram_impl.HelloMessage.content)
+  // @@protoc_insertion_point(field_set:oram_impl.FlatVectorMessage.content)
 }
-inline std::string* HelloMessage::mutable_content() {
+inline std::string* FlatVectorMessage::mutable_content() {
   std::string* _s = _internal_mutable_content();
-  // @@protoc_insertion_point(field_mutable:oram_impl.HelloMessage.content)
+  // @@protoc_insertion_point(field_mutable:oram_impl.FlatVectorMessage.content)
   return _s;
 }
-inline const std::string& HelloMessage::_internal_content() const {
+inline const std::string& FlatVectorMessage::_internal_content() const {
   return _impl_.content_.Get();
 }
-inline void HelloMessage::_internal_set_content(const std::string& value) {
+inline void FlatVectorMessage::_internal_set_content(const std::string& value) {
   
   _impl_.content_.Set(value, GetArenaForAllocation());
 }
-inline std::string* HelloMessage::_internal_mutable_content() {
+inline std::string* FlatVectorMessage::_internal_mutable_content() {
   
   return _impl_.content_.Mutable(GetArenaForAllocation());
 }
-inline std::string* HelloMessage::release_content() {
-  // @@protoc_insertion_point(field_release:oram_impl.HelloMessage.content)
+inline std::string* FlatVectorMessage::release_content() {
+  // @@protoc_insertion_point(field_release:oram_impl.FlatVectorMessage.content)
   return _impl_.content_.Release();
 }
-inline void HelloMessage::set_allocated_content(std::string* content) {
+inline void FlatVectorMessage::set_allocated_content(std::string* content) {
   if (content != nullptr) {
     
   } else {
@@ -3662,194 +6101,180 @@ inline void HelloMessage::set_allocated_content(std::string* content) {
     _impl_.content_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:oram_impl.HelloMessage.content)
+  // @@protoc_insertion_point(field_set_allocated:oram_impl.FlatVectorMessage.content)
 }
 
-// bytes iv = 2;
-inline void HelloMessage::clear_iv() {
-  _impl_.iv_.ClearToEmpty();
-}
-inline const std::string& HelloMessage::iv() const {
-  // @@protoc_insertion_point(field_get:oram_impl.HelloMessage.iv)
-  return _internal_iv();
-}
-template <typename ArgT0, typename... ArgT>
-inline PROTOBUF_ALWAYS_INLINE
-void HelloMessage::set_iv(ArgT0&& arg0, ArgT... args) {
- 
- _impl_.iv_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:oram_impl.HelloMessage.iv)
-}
-inline std::string* HelloMessage::mutable_iv() {
-  std::string* _s = _internal_mutable_iv();
-  // @@protoc_insertion_point(field_mutable:oram_impl.HelloMessage.iv)
-  return _s;
+// -------------------------------------------------------------------
+
+// SqrtMessage
+
+// .oram_impl.RequestHeader header = 1;
+inline bool SqrtMessage::_internal_has_header() const {
+  return this != internal_default_instance() && _impl_.header_ != nullptr;
 }
-inline const std::string& HelloMessage::_internal_iv() const {
-  return _impl_.iv_.Get();
+inline bool SqrtMessage::has_header() const {
+  return _internal_has_header();
 }
-inline void HelloMessage::_internal_set_iv(const std::string& value) {
-  
-  _impl_.iv_.Set(value, GetArenaForAllocation());
+inline void SqrtMessage::clear_header() {
+  if (GetArenaForAllocation() == nullptr && _impl_.header_ != nullptr) {
+    delete _impl_.header_;
+  }
+  _impl_.header_ = nullptr;
 }
-inline std::string* HelloMessage::_internal_mutable_iv() {
-  
-  return _impl_.iv_.Mutable(GetArenaForAllocation());
+inline const ::oram_impl::RequestHeader& SqrtMessage::_internal_header() const {
+  const ::oram_impl::RequestHeader* p = _impl_.header_;
+  return p != nullptr ? *p : reinterpret_cast<const ::oram_impl::RequestHeader&>(
+      ::oram_impl::_RequestHeader_default_instance_);
 }
-inline std::string* HelloMessage::release_iv() {
-  // @@protoc_insertion_point(field_release:oram_impl.HelloMessage.iv)
-  return _impl_.iv_.Release();
+inline const ::oram_impl::RequestHeader& SqrtMessage::header() const {
+  // @@protoc_insertion_point(field_get:oram_impl.SqrtMessage.header)
+  return _internal_header();
 }
-inline void HelloMessage::set_allocated_iv(std::string* iv) {
-  if (iv != nullptr) {
+inline void SqrtMessage::unsafe_arena_set_allocated_header(
+    ::oram_impl::RequestHeader* header) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.header_);
+  }
+  _impl_.header_ = header;
+  if (header) {
     
   } else {
     
   }
-  _impl_.iv_.SetAllocated(iv, GetArenaForAllocation());
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (_impl_.iv_.IsDefault()) {
-    _impl_.iv_.Set("", GetArenaForAllocation());
-  }
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:oram_impl.HelloMessage.iv)
-}
-
-// -------------------------------------------------------------------
-
-// KeyExchangeRequest
-
-// bytes public_key_client = 1;
-inline void KeyExchangeRequest::clear_public_key_client() {
-  _impl_.public_key_client_.ClearToEmpty();
-}
-inline const std::string& KeyExchangeRequest::public_key_client() const {
-  // @@protoc_insertion_point(field_get:oram_impl.KeyExchangeRequest.public_key_client)
-  return _internal_public_key_client();
-}
-template <typename ArgT0, typename... ArgT>
-inline PROTOBUF_ALWAYS_INLINE
-void KeyExchangeRequest::set_public_key_client(ArgT0&& arg0, ArgT... args) {
- 
- _impl_.public_key_client_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:oram_impl.KeyExchangeRequest.public_key_client)
-}
-inline std::string* KeyExchangeRequest::mutable_public_key_client() {
-  std::string* _s = _internal_mutable_public_key_client();
-  // @@protoc_insertion_point(field_mutable:oram_impl.KeyExchangeRequest.public_key_client)
-  return _s;
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:oram_impl.SqrtMessage.header)
 }
-inline const std::string& KeyExchangeRequest::_internal_public_key_client() const {
-  return _impl_.public_key_client_.Get();
+inline ::oram_impl::RequestHeader* SqrtMessage::release_header() {
+  
+  ::oram_impl::RequestHeader* temp = _impl_.header_;
+  _impl_.header_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
 }
-inline void KeyExchangeRequest::_internal_set_public_key_client(const std::string& value) {
+inline ::oram_impl::RequestHeader* SqrtMessage::unsafe_arena_release_header() {
+  // @@protoc_insertion_point(field_release:oram_impl.SqrtMessage.header)
   
-  _impl_.public_key_client_.Set(value, GetArenaForAllocation());
+  ::oram_impl::RequestHeader* temp = _impl_.header_;
+  _impl_.header_ = nullptr;
+  return temp;
 }
-inline std::string* KeyExchangeRequest::_internal_mutable_public_key_client() {
+inline ::oram_impl::RequestHeader* SqrtMessage::_internal_mutable_header() {
   
-  return _impl_.public_key_client_.Mutable(GetArenaForAllocation());
+  if (_impl_.header_ == nullptr) {
+    auto* p = CreateMaybeMessage<::oram_impl::RequestHeader>(GetArenaForAllocation());
+    _impl_.header_ = p;
+  }
+  return _impl_.header_;
 }
-inline std::string* KeyExchangeRequest::release_public_key_client() {
-  // @@protoc_insertion_point(field_release:oram_impl.KeyExchangeRequest.public_key_client)
-  return _impl_.public_key_client_.Release();
+inline ::oram_impl::RequestHeader* SqrtMessage::mutable_header() {
+  ::oram_impl::RequestHeader* _msg = _internal_mutable_header();
+  // @@protoc_insertion_point(field_mutable:oram_impl.SqrtMessage.header)
+  return _msg;
 }
-inline void KeyExchangeRequest::set_allocated_public_key_client(std::string* public_key_client) {
-  if (public_key_client != nullptr) {
+inline void SqrtMessage::set_allocated_header(::oram_impl::RequestHeader* header) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.header_;
+  }
+  if (header) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(header);
+    if (message_arena != submessage_arena) {
+      header = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, header, submessage_arena);
+    }
     
   } else {
     
   }
-  _impl_.public_key_client_.SetAllocated(public_key_client, GetArenaForAllocation());
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (_impl_.public_key_client_.IsDefault()) {
-    _impl_.public_key_client_.Set("", GetArenaForAllocation());
-  }
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:oram_impl.KeyExchangeRequest.public_key_client)
+  _impl_.header_ = header;
+  // @@protoc_insertion_point(field_set_allocated:oram_impl.SqrtMessage.header)
 }
 
-// -------------------------------------------------------------------
-
-// KeyExchangeResponse
-
-// bytes public_key_server = 1;
-inline void KeyExchangeResponse::clear_public_key_server() {
-  _impl_.public_key_server_.ClearToEmpty();
+// bytes content = 2;
+inline void SqrtMessage::clear_content() {
+  _impl_.content_.ClearToEmpty();
 }
-inline const std::string& KeyExchangeResponse::public_key_server() const {
-  // @@protoc_insertion_point(field_get:oram_impl.KeyExchangeResponse.public_key_server)
-  return _internal_public_key_server();
+inline const std::string& SqrtMessage::content() const {
+  // @@protoc_insertion_point(field_get:oram_impl.SqrtMessage.content)
+  return _internal_content();
 }
 template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
-void KeyExchangeResponse::set_public_key_server(ArgT0&& arg0, ArgT... args) {
+void SqrtMessage::set_content(ArgT0&& arg0, ArgT... args) {
  
- _impl_.public_key_server_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:oram_impl.KeyExchangeResponse.public_key_server)
+ _impl_.content_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:oram_impl.SqrtMessage.content)
 }
-inline std::string* KeyExchangeResponse::mutable_public_key_server() {
-  std::string* _s = _internal_mutable_public_key_server();
-  // @@protoc_insertion_point(field_mutable:oram_impl.KeyExchangeResponse.public_key_server)
+inline std::string* SqrtMessage::mutable_content() {
+  std::string* _s = _internal_mutable_content();
+  // @@protoc_insertion_point(field_mutable:oram_impl.SqrtMessage.content)
   return _s;
 }
-inline const std::string& KeyExchangeResponse::_internal_public_key_server() const {
-  return _impl_.public_key_server_.Get();
+inline const std::string& SqrtMessage::_internal_content() const {
+  return _impl_.content_.Get();
 }
-inline void KeyExchangeResponse::_internal_set_public_key_server(const std::string& value) {
+inline void SqrtMessage::_internal_set_content(const std::string& value) {
   
-  _impl_.public_key_server_.Set(value, GetArenaForAllocation());
+  _impl_.content_.Set(value, GetArenaForAllocation());
 }
-inline std::string* KeyExchangeResponse::_internal_mutable_public_key_server() {
+inline std::string* SqrtMessage::_internal_mutable_content() {
   
-  return _impl_.public_key_server_.Mutable(GetArenaForAllocation());
+  return _impl_.content_.Mutable(GetArenaForAllocation());
 }
-inline std::string* KeyExchangeResponse::release_public_key_server() {
-  // @@protoc_insertion_point(field_release:oram_impl.KeyExchangeResponse.public_key_server)
-  return _impl_.public_key_server_.Release();
+inline std::string* SqrtMessage::release_content() {
+  // @@protoc_insertion_point(field_release:oram_impl.SqrtMessage.content)
+  return _impl_.content_.Release();
 }
-inline void KeyExchangeResponse::set_allocated_public_key_server(std::string* public_key_server) {
-  if (public_key_server != nullptr) {
+inline void SqrtMessage::set_allocated_content(std::string* content) {
+  if (content != nullptr) {
     
   } else {
     
   }
-  _impl_.public_key_server_.SetAllocated(public_key_server, GetArenaForAllocation());
+  _impl_.content_.SetAllocated(content, GetArenaForAllocation());
 #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (_impl_.public_key_server_.IsDefault()) {
-    _impl_.public_key_server_.Set("", GetArenaForAllocation());
+  if (_impl_.content_.IsDefault()) {
+    _impl_.content_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:oram_impl.KeyExchangeResponse.public_key_server)
+  // @@protoc_insertion_point(field_set_allocated:oram_impl.SqrtMessage.content)
 }
 
 // -------------------------------------------------------------------
 
-// InitFlatOramRequest
+// WriteSqrtMessage
 
 // .oram_impl.RequestHeader header = 1;
-inline bool InitFlatOramRequest::_internal_has_header() const {
+inline bool WriteSqrtMessage::_internal_has_header() const {
   return this != internal_default_instance() && _impl_.header_ != nullptr;
 }
-inline bool InitFlatOramRequest::has_header() const {
+inline bool WriteSqrtMessage::has_header() const {
   return _internal_has_header();
 }
-inline void InitFlatOramRequest::clear_header() {
+inline void WriteSqrtMessage::clear_header() {
   if (GetArenaForAllocation() == nullptr && _impl_.header_ != nullptr) {
     delete _impl_.header_;
   }
   _impl_.header_ = nullptr;
 }
-inline const ::oram_impl::RequestHeader& InitFlatOramRequest::_internal_header() const {
+inline const ::oram_impl::RequestHeader& WriteSqrtMessage::_internal_header() const {
   const ::oram_impl::RequestHeader* p = _impl_.header_;
   return p != nullptr ? *p : reinterpret_cast<const ::oram_impl::RequestHeader&>(
       ::oram_impl::_RequestHeader_default_instance_);
 }
-inline const ::oram_impl::RequestHeader& InitFlatOramRequest::header() const {
-  // @@protoc_insertion_point(field_get:oram_impl.InitFlatOramRequest.header)
+inline const ::oram_impl::RequestHeader& WriteSqrtMessage::header() const {
+  // @@protoc_insertion_point(field_get:oram_impl.WriteSqrtMessage.header)
   return _internal_header();
 }
-inline void InitFlatOramRequest::unsafe_arena_set_allocated_header(
+inline void WriteSqrtMessage::unsafe_arena_set_allocated_header(
     ::oram_impl::RequestHeader* header) {
   if (GetArenaForAllocation() == nullptr) {
     delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.header_);
@@ -3860,9 +6285,9 @@ inline void InitFlatOramRequest::unsafe_arena_set_allocated_header(
   } else {
     
   }
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:oram_impl.InitFlatOramRequest.header)
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:oram_impl.WriteSqrtMessage.header)
 }
-inline ::oram_impl::RequestHeader* InitFlatOramRequest::release_header() {
+inline ::oram_impl::RequestHeader* WriteSqrtMessage::release_header() {
   
   ::oram_impl::RequestHeader* temp = _impl_.header_;
   _impl_.header_ = nullptr;
@@ -3877,14 +6302,14 @@ inline ::oram_impl::RequestHeader* InitFlatOramRequest::release_header() {
 #endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
   return temp;
 }
-inline ::oram_impl::RequestHeader* InitFlatOramRequest::unsafe_arena_release_header() {
-  // @@protoc_insertion_point(field_release:oram_impl.InitFlatOramRequest.header)
+inline ::oram_impl::RequestHeader* WriteSqrtMessage::unsafe_arena_release_header() {
+  // @@protoc_insertion_point(field_release:oram_impl.WriteSqrtMessage.header)
   
   ::oram_impl::RequestHeader* temp = _impl_.header_;
   _impl_.header_ = nullptr;
   return temp;
 }
-inline ::oram_impl::RequestHeader* InitFlatOramRequest::_internal_mutable_header() {
+inline ::oram_impl::RequestHeader* WriteSqrtMessage::_internal_mutable_header() {
   
   if (_impl_.header_ == nullptr) {
     auto* p = CreateMaybeMessage<::oram_impl::RequestHeader>(GetArenaForAllocation());
@@ -3892,12 +6317,12 @@ inline ::oram_impl::RequestHeader* InitFlatOramRequest::_internal_mutable_header
   }
   return _impl_.header_;
 }
-inline ::oram_impl::RequestHeader* InitFlatOramRequest::mutable_header() {
+inline ::oram_impl::RequestHeader* WriteSqrtMessage::mutable_header() {
   ::oram_impl::RequestHeader* _msg = _internal_mutable_header();
-  // @@protoc_insertion_point(field_mutable:oram_impl.InitFlatOramRequest.header)
+  // @@protoc_insertion_point(field_mutable:oram_impl.WriteSqrtMessage.header)
   return _msg;
 }
-inline void InitFlatOramRequest::set_allocated_header(::oram_impl::RequestHeader* header) {
+inline void WriteSqrtMessage::set_allocated_header(::oram_impl::RequestHeader* header) {
   ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
   if (message_arena == nullptr) {
     delete _impl_.header_;
@@ -3914,76 +6339,126 @@ inline void InitFlatOramRequest::set_allocated_header(::oram_impl::RequestHeader
     
   }
   _impl_.header_ = header;
-  // @@protoc_insertion_point(field_set_allocated:oram_impl.InitFlatOramRequest.header)
+  // @@protoc_insertion_point(field_set_allocated:oram_impl.WriteSqrtMessage.header)
 }
 
-// uint32 capacity = 2;
-inline void InitFlatOramRequest::clear_capacity() {
-  _impl_.capacity_ = 0u;
+// bytes content = 2;
+inline void WriteSqrtMessage::clear_content() {
+  _impl_.content_.ClearToEmpty();
 }
-inline uint32_t InitFlatOramRequest::_internal_capacity() const {
-  return _impl_.capacity_;
+inline const std::string& WriteSqrtMessage::content() const {
+  // @@protoc_insertion_point(field_get:oram_impl.WriteSqrtMessage.content)
+  return _internal_content();
 }
-inline uint32_t InitFlatOramRequest::capacity() const {
-  // @@protoc_insertion_point(field_get:oram_impl.InitFlatOramRequest.capacity)
-  return _internal_capacity();
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void WriteSqrtMessage::set_content(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.content_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:oram_impl.WriteSqrtMessage.content)
 }
-inline void InitFlatOramRequest::_internal_set_capacity(uint32_t value) {
+inline std::string* WriteSqrtMessage::mutable_content() {
+  std::string* _s = _internal_mutable_content();
+  // @@protoc_insertion_point(field_mutable:oram_impl.WriteSqrtMessage.content)
+  return _s;
+}
+inline const std::string& WriteSqrtMessage::_internal_content() const {
+  return _impl_.content_.Get();
+}
+inline void WriteSqrtMessage::_internal_set_content(const std::string& value) {
   
-  _impl_.capacity_ = value;
+  _impl_.content_.Set(value, GetArenaForAllocation());
 }
-inline void InitFlatOramRequest::set_capacity(uint32_t value) {
-  _internal_set_capacity(value);
-  // @@protoc_insertion_point(field_set:oram_impl.InitFlatOramRequest.capacity)
+inline std::string* WriteSqrtMessage::_internal_mutable_content() {
+  
+  return _impl_.content_.Mutable(GetArenaForAllocation());
+}
+inline std::string* WriteSqrtMessage::release_content() {
+  // @@protoc_insertion_point(field_release:oram_impl.WriteSqrtMessage.content)
+  return _impl_.content_.Release();
+}
+inline void WriteSqrtMessage::set_allocated_content(std::string* content) {
+  if (content != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.content_.SetAllocated(content, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.content_.IsDefault()) {
+    _impl_.content_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:oram_impl.WriteSqrtMessage.content)
 }
 
-// uint32 block_size = 3;
-inline void InitFlatOramRequest::clear_block_size() {
-  _impl_.block_size_ = 0u;
+// bool write_to_cache = 3;
+inline void WriteSqrtMessage::clear_write_to_cache() {
+  _impl_.write_to_cache_ = false;
 }
-inline uint32_t InitFlatOramRequest::_internal_block_size() const {
-  return _impl_.block_size_;
+inline bool WriteSqrtMessage::_internal_write_to_cache() const {
+  return _impl_.write_to_cache_;
 }
-inline uint32_t InitFlatOramRequest::block_size() const {
-  // @@protoc_insertion_point(field_get:oram_impl.InitFlatOramRequest.block_size)
-  return _internal_block_size();
+inline bool WriteSqrtMessage::write_to_cache() const {
+  // @@protoc_insertion_point(field_get:oram_impl.WriteSqrtMessage.write_to_cache)
+  return _internal_write_to_cache();
 }
-inline void InitFlatOramRequest::_internal_set_block_size(uint32_t value) {
+inline void WriteSqrtMessage::_internal_set_write_to_cache(bool value) {
   
-  _impl_.block_size_ = value;
+  _impl_.write_to_cache_ = value;
 }
-inline void InitFlatOramRequest::set_block_size(uint32_t value) {
-  _internal_set_block_size(value);
-  // @@protoc_insertion_point(field_set:oram_impl.InitFlatOramRequest.block_size)
+inline void WriteSqrtMessage::set_write_to_cache(bool value) {
+  _internal_set_write_to_cache(value);
+  // @@protoc_insertion_point(field_set:oram_impl.WriteSqrtMessage.write_to_cache)
+}
+
+// uint32 pos = 4;
+inline void WriteSqrtMessage::clear_pos() {
+  _impl_.pos_ = 0u;
+}
+inline uint32_t WriteSqrtMessage::_internal_pos() const {
+  return _impl_.pos_;
+}
+inline uint32_t WriteSqrtMessage::pos() const {
+  // @@protoc_insertion_point(field_get:oram_impl.WriteSqrtMessage.pos)
+  return _internal_pos();
+}
+inline void WriteSqrtMessage::_internal_set_pos(uint32_t value) {
+  
+  _impl_.pos_ = value;
+}
+inline void WriteSqrtMessage::set_pos(uint32_t value) {
+  _internal_set_pos(value);
+  // @@protoc_insertion_point(field_set:oram_impl.WriteSqrtMessage.pos)
 }
 
 // -------------------------------------------------------------------
 
-// InitSqrtOramRequest
+// SqrtPermMessage
 
 // .oram_impl.RequestHeader header = 1;
-inline bool InitSqrtOramRequest::_internal_has_header() const {
+inline bool SqrtPermMessage::_internal_has_header() const {
   return this != internal_default_instance() && _impl_.header_ != nullptr;
 }
-inline bool InitSqrtOramRequest::has_header() const {
+inline bool SqrtPermMessage::has_header() const {
   return _internal_has_header();
 }
-inline void InitSqrtOramRequest::clear_header() {
+inline void SqrtPermMessage::clear_header() {
   if (GetArenaForAllocation() == nullptr && _impl_.header_ != nullptr) {
     delete _impl_.header_;
   }
   _impl_.header_ = nullptr;
 }
-inline const ::oram_impl::RequestHeader& InitSqrtOramRequest::_internal_header() const {
+inline const ::oram_impl::RequestHeader& SqrtPermMessage::_internal_header() const {
   const ::oram_impl::RequestHeader* p = _impl_.header_;
   return p != nullptr ? *p : reinterpret_cast<const ::oram_impl::RequestHeader&>(
       ::oram_impl::_RequestHeader_default_instance_);
 }
-inline const ::oram_impl::RequestHeader& InitSqrtOramRequest::header() const {
-  // @@protoc_insertion_point(field_get:oram_impl.InitSqrtOramRequest.header)
+inline const ::oram_impl::RequestHeader& SqrtPermMessage::header() const {
+  // @@protoc_insertion_point(field_get:oram_impl.SqrtPermMessage.header)
   return _internal_header();
 }
-inline void InitSqrtOramRequest::unsafe_arena_set_allocated_header(
+inline void SqrtPermMessage::unsafe_arena_set_allocated_header(
     ::oram_impl::RequestHeader* header) {
   if (GetArenaForAllocation() == nullptr) {
     delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.header_);
@@ -3994,9 +6469,9 @@ inline void InitSqrtOramRequest::unsafe_arena_set_allocated_header(
   } else {
     
   }
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:oram_impl.InitSqrtOramRequest.header)
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:oram_impl.SqrtPermMessage.header)
 }
-inline ::oram_impl::RequestHeader* InitSqrtOramRequest::release_header() {
+inline ::oram_impl::RequestHeader* SqrtPermMessage::release_header() {
   
   ::oram_impl::RequestHeader* temp = _impl_.header_;
   _impl_.header_ = nullptr;
@@ -4011,14 +6486,14 @@ inline ::oram_impl::RequestHeader* InitSqrtOramRequest::release_header() {
 #endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
   return temp;
 }
-inline ::oram_impl::RequestHeader* InitSqrtOramRequest::unsafe_arena_release_header() {
-  // @@protoc_insertion_point(field_release:oram_impl.InitSqrtOramRequest.header)
+inline ::oram_impl::RequestHeader* SqrtPermMessage::unsafe_arena_release_header() {
+  // @@protoc_insertion_point(field_release:oram_impl.SqrtPermMessage.header)
   
   ::oram_impl::RequestHeader* temp = _impl_.header_;
   _impl_.header_ = nullptr;
   return temp;
 }
-inline ::oram_impl::RequestHeader* InitSqrtOramRequest::_internal_mutable_header() {
+inline ::oram_impl::RequestHeader* SqrtPermMessage::_internal_mutable_header() {
   
   if (_impl_.header_ == nullptr) {
     auto* p = CreateMaybeMessage<::oram_impl::RequestHeader>(GetArenaForAllocation());
@@ -4026,12 +6501,12 @@ inline ::oram_impl::RequestHeader* InitSqrtOramRequest::_internal_mutable_header
   }
   return _impl_.header_;
 }
-inline ::oram_impl::RequestHeader* InitSqrtOramRequest::mutable_header() {
+inline ::oram_impl::RequestHeader* SqrtPermMessage::mutable_header() {
   ::oram_impl::RequestHeader* _msg = _internal_mutable_header();
-  // @@protoc_insertion_point(field_mutable:oram_impl.InitSqrtOramRequest.header)
+  // @@protoc_insertion_point(field_mutable:oram_impl.SqrtPermMessage.header)
   return _msg;
 }
-inline void InitSqrtOramRequest::set_allocated_header(::oram_impl::RequestHeader* header) {
+inline void SqrtPermMessage::set_allocated_header(::oram_impl::RequestHeader* header) {
   ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
   if (message_arena == nullptr) {
     delete _impl_.header_;
@@ -4048,96 +6523,83 @@ inline void InitSqrtOramRequest::set_allocated_header(::oram_impl::RequestHeader
     
   }
   _impl_.header_ = header;
-  // @@protoc_insertion_point(field_set_allocated:oram_impl.InitSqrtOramRequest.header)
+  // @@protoc_insertion_point(field_set_allocated:oram_impl.SqrtPermMessage.header)
 }
 
-// uint32 capacity = 2;
-inline void InitSqrtOramRequest::clear_capacity() {
-  _impl_.capacity_ = 0u;
-}
-inline uint32_t InitSqrtOramRequest::_internal_capacity() const {
-  return _impl_.capacity_;
-}
-inline uint32_t InitSqrtOramRequest::capacity() const {
-  // @@protoc_insertion_point(field_get:oram_impl.InitSqrtOramRequest.capacity)
-  return _internal_capacity();
-}
-inline void InitSqrtOramRequest::_internal_set_capacity(uint32_t value) {
-  
-  _impl_.capacity_ = value;
-}
-inline void InitSqrtOramRequest::set_capacity(uint32_t value) {
-  _internal_set_capacity(value);
-  // @@protoc_insertion_point(field_set:oram_impl.InitSqrtOramRequest.capacity)
+// repeated uint32 perms = 2;
+inline int SqrtPermMessage::_internal_perms_size() const {
+  return _impl_.perms_.size();
 }
-
-// uint32 squared_m = 3;
-inline void InitSqrtOramRequest::clear_squared_m() {
-  _impl_.squared_m_ = 0u;
+inline int SqrtPermMessage::perms_size() const {
+  return _internal_perms_size();
 }
-inline uint32_t InitSqrtOramRequest::_internal_squared_m() const {
-  return _impl_.squared_m_;
+inline void SqrtPermMessage::clear_perms() {
+  _impl_.perms_.Clear();
 }
-inline uint32_t InitSqrtOramRequest::squared_m() const {
-  // @@protoc_insertion_point(field_get:oram_impl.InitSqrtOramRequest.squared_m)
-  return _internal_squared_m();
+inline uint32_t SqrtPermMessage::_internal_perms(int index) const {
+  return _impl_.perms_.Get(index);
 }
-inline void InitSqrtOramRequest::_internal_set_squared_m(uint32_t value) {
-  
-  _impl_.squared_m_ = value;
+inline uint32_t SqrtPermMessage::perms(int index) const {
+  // @@protoc_insertion_point(field_get:oram_impl.SqrtPermMessage.perms)
+  return _internal_perms(index);
 }
-inline void InitSqrtOramRequest::set_squared_m(uint32_t value) {
-  _internal_set_squared_m(value);
-  // @@protoc_insertion_point(field_set:oram_impl.InitSqrtOramRequest.squared_m)
+inline void SqrtPermMessage::set_perms(int index, uint32_t value) {
+  _impl_.perms_.Set(index, value);
+  // @@protoc_insertion_point(field_set:oram_impl.SqrtPermMessage.perms)
 }
-
-// uint32 block_size = 4;
-inline void InitSqrtOramRequest::clear_block_size() {
-  _impl_.block_size_ = 0u;
+inline void SqrtPermMessage::_internal_add_perms(uint32_t value) {
+  _impl_.perms_.Add(value);
 }
-inline uint32_t InitSqrtOramRequest::_internal_block_size() const {
-  return _impl_.block_size_;
+inline void SqrtPermMessage::add_perms(uint32_t value) {
+  _internal_add_perms(value);
+  // @@protoc_insertion_point(field_add:oram_impl.SqrtPermMessage.perms)
 }
-inline uint32_t InitSqrtOramRequest::block_size() const {
-  // @@protoc_insertion_point(field_get:oram_impl.InitSqrtOramRequest.block_size)
-  return _internal_block_size();
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+SqrtPermMessage::_internal_perms() const {
+  return _impl_.perms_;
 }
-inline void InitSqrtOramRequest::_internal_set_block_size(uint32_t value) {
-  
-  _impl_.block_size_ = value;
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+SqrtPermMessage::perms() const {
+  // @@protoc_insertion_point(field_list:oram_impl.SqrtPermMessage.perms)
+  return _internal_perms();
 }
-inline void InitSqrtOramRequest::set_block_size(uint32_t value) {
-  _internal_set_block_size(value);
-  // @@protoc_insertion_point(field_set:oram_impl.InitSqrtOramRequest.block_size)
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+SqrtPermMessage::_internal_mutable_perms() {
+  return &_impl_.perms_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+SqrtPermMessage::mutable_perms() {
+  // @@protoc_insertion_point(field_mutable_list:oram_impl.SqrtPermMessage.perms)
+  return _internal_mutable_perms();
 }
 
 // -------------------------------------------------------------------
 
-// LoadSqrtOramRequest
+// InitTreeOramRequest
 
 // .oram_impl.RequestHeader header = 1;
-inline bool LoadSqrtOramRequest::_internal_has_header() const {
+inline bool InitTreeOramRequest::_internal_has_header() const {
   return this != internal_default_instance() && _impl_.header_ != nullptr;
 }
-inline bool LoadSqrtOramRequest::has_header() const {
+inline bool InitTreeOramRequest::has_header() const {
   return _internal_has_header();
 }
-inline void LoadSqrtOramRequest::clear_header() {
+inline void InitTreeOramRequest::clear_header() {
   if (GetArenaForAllocation() == nullptr && _impl_.header_ != nullptr) {
     delete _impl_.header_;
   }
   _impl_.header_ = nullptr;
 }
-inline const ::oram_impl::RequestHeader& LoadSqrtOramRequest::_internal_header() const {
+inline const ::oram_impl::RequestHeader& InitTreeOramRequest::_internal_header() const {
   const ::oram_impl::RequestHeader* p = _impl_.header_;
   return p != nullptr ? *p : reinterpret_cast<const ::oram_impl::RequestHeader&>(
       ::oram_impl::_RequestHeader_default_instance_);
 }
-inline const ::oram_impl::RequestHeader& LoadSqrtOramRequest::header() const {
-  // @@protoc_insertion_point(field_get:oram_impl.LoadSqrtOramRequest.header)
+inline const ::oram_impl::RequestHeader& InitTreeOramRequest::header() const {
+  // @@protoc_insertion_point(field_get:oram_impl.InitTreeOramRequest.header)
   return _internal_header();
 }
-inline void LoadSqrtOramRequest::unsafe_arena_set_allocated_header(
+inline void InitTreeOramRequest::unsafe_arena_set_allocated_header(
     ::oram_impl::RequestHeader* header) {
   if (GetArenaForAllocation() == nullptr) {
     delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.header_);
@@ -4148,9 +6610,9 @@ inline void LoadSqrtOramRequest::unsafe_arena_set_allocated_header(
   } else {
     
   }
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:oram_impl.LoadSqrtOramRequest.header)
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:oram_impl.InitTreeOramRequest.header)
 }
-inline ::oram_impl::RequestHeader* LoadSqrtOramRequest::release_header() {
+inline ::oram_impl::RequestHeader* InitTreeOramRequest::release_header() {
   
   ::oram_impl::RequestHeader* temp = _impl_.header_;
   _impl_.header_ = nullptr;
@@ -4165,14 +6627,14 @@ inline ::oram_impl::RequestHeader* LoadSqrtOramRequest::release_header() {
 #endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
   return temp;
 }
-inline ::oram_impl::RequestHeader* LoadSqrtOramRequest::unsafe_arena_release_header() {
-  // @@protoc_insertion_point(field_release:oram_impl.LoadSqrtOramRequest.header)
+inline ::oram_impl::RequestHeader* InitTreeOramRequest::unsafe_arena_release_header() {
+  // @@protoc_insertion_point(field_release:oram_impl.InitTreeOramRequest.header)
   
   ::oram_impl::RequestHeader* temp = _impl_.header_;
   _impl_.header_ = nullptr;
   return temp;
 }
-inline ::oram_impl::RequestHeader* LoadSqrtOramRequest::_internal_mutable_header() {
+inline ::oram_impl::RequestHeader* InitTreeOramRequest::_internal_mutable_header() {
   
   if (_impl_.header_ == nullptr) {
     auto* p = CreateMaybeMessage<::oram_impl::RequestHeader>(GetArenaForAllocation());
@@ -4180,12 +6642,12 @@ inline ::oram_impl::RequestHeader* LoadSqrtOramRequest::_internal_mutable_header
   }
   return _impl_.header_;
 }
-inline ::oram_impl::RequestHeader* LoadSqrtOramRequest::mutable_header() {
+inline ::oram_impl::RequestHeader* InitTreeOramRequest::mutable_header() {
   ::oram_impl::RequestHeader* _msg = _internal_mutable_header();
-  // @@protoc_insertion_point(field_mutable:oram_impl.LoadSqrtOramRequest.header)
+  // @@protoc_insertion_point(field_mutable:oram_impl.InitTreeOramRequest.header)
   return _msg;
 }
-inline void LoadSqrtOramRequest::set_allocated_header(::oram_impl::RequestHeader* header) {
+inline void InitTreeOramRequest::set_allocated_header(::oram_impl::RequestHeader* header) {
   ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
   if (message_arena == nullptr) {
     delete _impl_.header_;
@@ -4202,111 +6664,96 @@ inline void LoadSqrtOramRequest::set_allocated_header(::oram_impl::RequestHeader
     
   }
   _impl_.header_ = header;
-  // @@protoc_insertion_point(field_set_allocated:oram_impl.LoadSqrtOramRequest.header)
+  // @@protoc_insertion_point(field_set_allocated:oram_impl.InitTreeOramRequest.header)
 }
 
-// repeated bytes contents = 2;
-inline int LoadSqrtOramRequest::_internal_contents_size() const {
-  return _impl_.contents_.size();
-}
-inline int LoadSqrtOramRequest::contents_size() const {
-  return _internal_contents_size();
-}
-inline void LoadSqrtOramRequest::clear_contents() {
-  _impl_.contents_.Clear();
-}
-inline std::string* LoadSqrtOramRequest::add_contents() {
-  std::string* _s = _internal_add_contents();
-  // @@protoc_insertion_point(field_add_mutable:oram_impl.LoadSqrtOramRequest.contents)
-  return _s;
+// uint32 bucket_size = 2;
+inline void InitTreeOramRequest::clear_bucket_size() {
+  _impl_.bucket_size_ = 0u;
 }
-inline const std::string& LoadSqrtOramRequest::_internal_contents(int index) const {
-  return _impl_.contents_.Get(index);
+inline uint32_t InitTreeOramRequest::_internal_bucket_size() const {
+  return _impl_.bucket_size_;
 }
-inline const std::string& LoadSqrtOramRequest::contents(int index) const {
-  // @@protoc_insertion_point(field_get:oram_impl.LoadSqrtOramRequest.contents)
-  return _internal_contents(index);
+inline uint32_t InitTreeOramRequest::bucket_size() const {
+  // @@protoc_insertion_point(field_get:oram_impl.InitTreeOramRequest.bucket_size)
+  return _internal_bucket_size();
 }
-inline std::string* LoadSqrtOramRequest::mutable_contents(int index) {
-  // @@protoc_insertion_point(field_mutable:oram_impl.LoadSqrtOramRequest.contents)
-  return _impl_.contents_.Mutable(index);
+inline void InitTreeOramRequest::_internal_set_bucket_size(uint32_t value) {
+  
+  _impl_.bucket_size_ = value;
 }
-inline void LoadSqrtOramRequest::set_contents(int index, const std::string& value) {
-  _impl_.contents_.Mutable(index)->assign(value);
-  // @@protoc_insertion_point(field_set:oram_impl.LoadSqrtOramRequest.contents)
+inline void InitTreeOramRequest::set_bucket_size(uint32_t value) {
+  _internal_set_bucket_size(value);
+  // @@protoc_insertion_point(field_set:oram_impl.InitTreeOramRequest.bucket_size)
 }
-inline void LoadSqrtOramRequest::set_contents(int index, std::string&& value) {
-  _impl_.contents_.Mutable(index)->assign(std::move(value));
-  // @@protoc_insertion_point(field_set:oram_impl.LoadSqrtOramRequest.contents)
+
+// uint32 bucket_num = 3;
+inline void InitTreeOramRequest::clear_bucket_num() {
+  _impl_.bucket_num_ = 0u;
 }
-inline void LoadSqrtOramRequest::set_contents(int index, const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  _impl_.contents_.Mutable(index)->assign(value);
-  // @@protoc_insertion_point(field_set_char:oram_impl.LoadSqrtOramRequest.contents)
+inline uint32_t InitTreeOramRequest::_internal_bucket_num() const {
+  return _impl_.bucket_num_;
 }
-inline void LoadSqrtOramRequest::set_contents(int index, const void* value, size_t size) {
-  _impl_.contents_.Mutable(index)->assign(
-    reinterpret_cast<const char*>(value), size);
-  // @@protoc_insertion_point(field_set_pointer:oram_impl.LoadSqrtOramRequest.contents)
+inline uint32_t InitTreeOramRequest::bucket_num() const {
+  // @@protoc_insertion_point(field_get:oram_impl.InitTreeOramRequest.bucket_num)
+  return _internal_bucket_num();
 }
-inline std::string* LoadSqrtOramRequest::_internal_add_contents() {
-  return _impl_.contents_.Add();
+inline void InitTreeOramRequest::_internal_set_bucket_num(uint32_t value) {
+  
+  _impl_.bucket_num_ = value;
 }
-inline void LoadSqrtOramRequest::add_contents(const std::string& value) {
-  _impl_.contents_.Add()->assign(value);
-  // @@protoc_insertion_point(field_add:oram_impl.LoadSqrtOramRequest.contents)
+inline void InitTreeOramRequest::set_bucket_num(uint32_t value) {
+  _internal_set_bucket_num(value);
+  // @@protoc_insertion_point(field_set:oram_impl.InitTreeOramRequest.bucket_num)
 }
-inline void LoadSqrtOramRequest::add_contents(std::string&& value) {
-  _impl_.contents_.Add(std::move(value));
-  // @@protoc_insertion_point(field_add:oram_impl.LoadSqrtOramRequest.contents)
+
+// uint32 block_size = 4;
+inline void InitTreeOramRequest::clear_block_size() {
+  _impl_.block_size_ = 0u;
 }
-inline void LoadSqrtOramRequest::add_contents(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  _impl_.contents_.Add()->assign(value);
-  // @@protoc_insertion_point(field_add_char:oram_impl.LoadSqrtOramRequest.contents)
+inline uint32_t InitTreeOramRequest::_internal_block_size() const {
+  return _impl_.block_size_;
 }
-inline void LoadSqrtOramRequest::add_contents(const void* value, size_t size) {
-  _impl_.contents_.Add()->assign(reinterpret_cast<const char*>(value), size);
-  // @@protoc_insertion_point(field_add_pointer:oram_impl.LoadSqrtOramRequest.contents)
+inline uint32_t InitTreeOramRequest::block_size() const {
+  // @@protoc_insertion_point(field_get:oram_impl.InitTreeOramRequest.block_size)
+  return _internal_block_size();
 }
-inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
-LoadSqrtOramRequest::contents() const {
-  // @@protoc_insertion_point(field_list:oram_impl.LoadSqrtOramRequest.contents)
-  return _impl_.contents_;
+inline void InitTreeOramRequest::_internal_set_block_size(uint32_t value) {
+  
+  _impl_.block_size_ = value;
 }
-inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
-LoadSqrtOramRequest::mutable_contents() {
-  // @@protoc_insertion_point(field_mutable_list:oram_impl.LoadSqrtOramRequest.contents)
-  return &_impl_.contents_;
+inline void InitTreeOramRequest::set_block_size(uint32_t value) {
+  _internal_set_block_size(value);
+  // @@protoc_insertion_point(field_set:oram_impl.InitTreeOramRequest.block_size)
 }
 
 // -------------------------------------------------------------------
 
-// FlatVectorMessage
+// ReadFlatRequest
 
 // .oram_impl.RequestHeader header = 1;
-inline bool FlatVectorMessage::_internal_has_header() const {
+inline bool ReadFlatRequest::_internal_has_header() const {
   return this != internal_default_instance() && _impl_.header_ != nullptr;
 }
-inline bool FlatVectorMessage::has_header() const {
+inline bool ReadFlatRequest::has_header() const {
   return _internal_has_header();
 }
-inline void FlatVectorMessage::clear_header() {
+inline void ReadFlatRequest::clear_header() {
   if (GetArenaForAllocation() == nullptr && _impl_.header_ != nullptr) {
     delete _impl_.header_;
   }
   _impl_.header_ = nullptr;
 }
-inline const ::oram_impl::RequestHeader& FlatVectorMessage::_internal_header() const {
+inline const ::oram_impl::RequestHeader& ReadFlatRequest::_internal_header() const {
   const ::oram_impl::RequestHeader* p = _impl_.header_;
   return p != nullptr ? *p : reinterpret_cast<const ::oram_impl::RequestHeader&>(
       ::oram_impl::_RequestHeader_default_instance_);
 }
-inline const ::oram_impl::RequestHeader& FlatVectorMessage::header() const {
-  // @@protoc_insertion_point(field_get:oram_impl.FlatVectorMessage.header)
+inline const ::oram_impl::RequestHeader& ReadFlatRequest::header() const {
+  // @@protoc_insertion_point(field_get:oram_impl.ReadFlatRequest.header)
   return _internal_header();
 }
-inline void FlatVectorMessage::unsafe_arena_set_allocated_header(
+inline void ReadFlatRequest::unsafe_arena_set_allocated_header(
     ::oram_impl::RequestHeader* header) {
   if (GetArenaForAllocation() == nullptr) {
     delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.header_);
@@ -4317,9 +6764,9 @@ inline void FlatVectorMessage::unsafe_arena_set_allocated_header(
   } else {
     
   }
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:oram_impl.FlatVectorMessage.header)
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:oram_impl.ReadFlatRequest.header)
 }
-inline ::oram_impl::RequestHeader* FlatVectorMessage::release_header() {
+inline ::oram_impl::RequestHeader* ReadFlatRequest::release_header() {
   
   ::oram_impl::RequestHeader* temp = _impl_.header_;
   _impl_.header_ = nullptr;
@@ -4334,14 +6781,14 @@ inline ::oram_impl::RequestHeader* FlatVectorMessage::release_header() {
 #endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
   return temp;
 }
-inline ::oram_impl::RequestHeader* FlatVectorMessage::unsafe_arena_release_header() {
-  // @@protoc_insertion_point(field_release:oram_impl.FlatVectorMessage.header)
+inline ::oram_impl::RequestHeader* ReadFlatRequest::unsafe_arena_release_header() {
+  // @@protoc_insertion_point(field_release:oram_impl.ReadFlatRequest.header)
   
   ::oram_impl::RequestHeader* temp = _impl_.header_;
   _impl_.header_ = nullptr;
   return temp;
 }
-inline ::oram_impl::RequestHeader* FlatVectorMessage::_internal_mutable_header() {
+inline ::oram_impl::RequestHeader* ReadFlatRequest::_internal_mutable_header() {
   
   if (_impl_.header_ == nullptr) {
     auto* p = CreateMaybeMessage<::oram_impl::RequestHeader>(GetArenaForAllocation());
@@ -4349,12 +6796,12 @@ inline ::oram_impl::RequestHeader* FlatVectorMessage::_internal_mutable_header()
   }
   return _impl_.header_;
 }
-inline ::oram_impl::RequestHeader* FlatVectorMessage::mutable_header() {
+inline ::oram_impl::RequestHeader* ReadFlatRequest::mutable_header() {
   ::oram_impl::RequestHeader* _msg = _internal_mutable_header();
-  // @@protoc_insertion_point(field_mutable:oram_impl.FlatVectorMessage.header)
+  // @@protoc_insertion_point(field_mutable:oram_impl.ReadFlatRequest.header)
   return _msg;
 }
-inline void FlatVectorMessage::set_allocated_header(::oram_impl::RequestHeader* header) {
+inline void ReadFlatRequest::set_allocated_header(::oram_impl::RequestHeader* header) {
   ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
   if (message_arena == nullptr) {
     delete _impl_.header_;
@@ -4371,86 +6818,36 @@ inline void FlatVectorMessage::set_allocated_header(::oram_impl::RequestHeader*
     
   }
   _impl_.header_ = header;
-  // @@protoc_insertion_point(field_set_allocated:oram_impl.FlatVectorMessage.header)
-}
-
-// bytes content = 2;
-inline void FlatVectorMessage::clear_content() {
-  _impl_.content_.ClearToEmpty();
-}
-inline const std::string& FlatVectorMessage::content() const {
-  // @@protoc_insertion_point(field_get:oram_impl.FlatVectorMessage.content)
-  return _internal_content();
-}
-template <typename ArgT0, typename... ArgT>
-inline PROTOBUF_ALWAYS_INLINE
-void FlatVectorMessage::set_content(ArgT0&& arg0, ArgT... args) {
- 
- _impl_.content_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:oram_impl.FlatVectorMessage.content)
-}
-inline std::string* FlatVectorMessage::mutable_content() {
-  std::string* _s = _internal_mutable_content();
-  // @@protoc_insertion_point(field_mutable:oram_impl.FlatVectorMessage.content)
-  return _s;
-}
-inline const std::string& FlatVectorMessage::_internal_content() const {
-  return _impl_.content_.Get();
-}
-inline void FlatVectorMessage::_internal_set_content(const std::string& value) {
-  
-  _impl_.content_.Set(value, GetArenaForAllocation());
-}
-inline std::string* FlatVectorMessage::_internal_mutable_content() {
-  
-  return _impl_.content_.Mutable(GetArenaForAllocation());
-}
-inline std::string* FlatVectorMessage::release_content() {
-  // @@protoc_insertion_point(field_release:oram_impl.FlatVectorMessage.content)
-  return _impl_.content_.Release();
-}
-inline void FlatVectorMessage::set_allocated_content(std::string* content) {
-  if (content != nullptr) {
-    
-  } else {
-    
-  }
-  _impl_.content_.SetAllocated(content, GetArenaForAllocation());
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (_impl_.content_.IsDefault()) {
-    _impl_.content_.Set("", GetArenaForAllocation());
-  }
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:oram_impl.FlatVectorMessage.content)
+  // @@protoc_insertion_point(field_set_allocated:oram_impl.ReadFlatRequest.header)
 }
 
 // -------------------------------------------------------------------
 
-// SqrtMessage
+// ReadSqrtRequest
 
 // .oram_impl.RequestHeader header = 1;
-inline bool SqrtMessage::_internal_has_header() const {
+inline bool ReadSqrtRequest::_internal_has_header() const {
   return this != internal_default_instance() && _impl_.header_ != nullptr;
 }
-inline bool SqrtMessage::has_header() const {
+inline bool ReadSqrtRequest::has_header() const {
   return _internal_has_header();
 }
-inline void SqrtMessage::clear_header() {
+inline void ReadSqrtRequest::clear_header() {
   if (GetArenaForAllocation() == nullptr && _impl_.header_ != nullptr) {
     delete _impl_.header_;
   }
   _impl_.header_ = nullptr;
 }
-inline const ::oram_impl::RequestHeader& SqrtMessage::_internal_header() const {
+inline const ::oram_impl::RequestHeader& ReadSqrtRequest::_internal_header() const {
   const ::oram_impl::RequestHeader* p = _impl_.header_;
   return p != nullptr ? *p : reinterpret_cast<const ::oram_impl::RequestHeader&>(
       ::oram_impl::_RequestHeader_default_instance_);
 }
-inline const ::oram_impl::RequestHeader& SqrtMessage::header() const {
-  // @@protoc_insertion_point(field_get:oram_impl.SqrtMessage.header)
+inline const ::oram_impl::RequestHeader& ReadSqrtRequest::header() const {
+  // @@protoc_insertion_point(field_get:oram_impl.ReadSqrtRequest.header)
   return _internal_header();
 }
-inline void SqrtMessage::unsafe_arena_set_allocated_header(
+inline void ReadSqrtRequest::unsafe_arena_set_allocated_header(
     ::oram_impl::RequestHeader* header) {
   if (GetArenaForAllocation() == nullptr) {
     delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.header_);
@@ -4461,9 +6858,9 @@ inline void SqrtMessage::unsafe_arena_set_allocated_header(
   } else {
     
   }
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:oram_impl.SqrtMessage.header)
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:oram_impl.ReadSqrtRequest.header)
 }
-inline ::oram_impl::RequestHeader* SqrtMessage::release_header() {
+inline ::oram_impl::RequestHeader* ReadSqrtRequest::release_header() {
   
   ::oram_impl::RequestHeader* temp = _impl_.header_;
   _impl_.header_ = nullptr;
@@ -4477,15 +6874,15 @@ inline ::oram_impl::RequestHeader* SqrtMessage::release_header() {
   }
 #endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
   return temp;
-}
-inline ::oram_impl::RequestHeader* SqrtMessage::unsafe_arena_release_header() {
-  // @@protoc_insertion_point(field_release:oram_impl.SqrtMessage.header)
+}
+inline ::oram_impl::RequestHeader* ReadSqrtRequest::unsafe_arena_release_header() {
+  // @@protoc_insertion_point(field_release:oram_impl.ReadSqrtRequest.header)
   
   ::oram_impl::RequestHeader* temp = _impl_.header_;
   _impl_.header_ = nullptr;
   return temp;
 }
-inline ::oram_impl::RequestHeader* SqrtMessage::_internal_mutable_header() {
+inline ::oram_impl::RequestHeader* ReadSqrtRequest::_internal_mutable_header() {
   
   if (_impl_.header_ == nullptr) {
     auto* p = CreateMaybeMessage<::oram_impl::RequestHeader>(GetArenaForAllocation());
@@ -4493,12 +6890,12 @@ inline ::oram_impl::RequestHeader* SqrtMessage::_internal_mutable_header() {
   }
   return _impl_.header_;
 }
-inline ::oram_impl::RequestHeader* SqrtMessage::mutable_header() {
+inline ::oram_impl::RequestHeader* ReadSqrtRequest::mutable_header() {
   ::oram_impl::RequestHeader* _msg = _internal_mutable_header();
-  // @@protoc_insertion_point(field_mutable:oram_impl.SqrtMessage.header)
+  // @@protoc_insertion_point(field_mutable:oram_impl.ReadSqrtRequest.header)
   return _msg;
 }
-inline void SqrtMessage::set_allocated_header(::oram_impl::RequestHeader* header) {
+inline void ReadSqrtRequest::set_allocated_header(::oram_impl::RequestHeader* header) {
   ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
   if (message_arena == nullptr) {
     delete _impl_.header_;
@@ -4515,86 +6912,76 @@ inline void SqrtMessage::set_allocated_header(::oram_impl::RequestHeader* header
     
   }
   _impl_.header_ = header;
-  // @@protoc_insertion_point(field_set_allocated:oram_impl.SqrtMessage.header)
+  // @@protoc_insertion_point(field_set_allocated:oram_impl.ReadSqrtRequest.header)
 }
 
-// bytes content = 2;
-inline void SqrtMessage::clear_content() {
-  _impl_.content_.ClearToEmpty();
+// uint32 tag = 2;
+inline void ReadSqrtRequest::clear_tag() {
+  _impl_.tag_ = 0u;
 }
-inline const std::string& SqrtMessage::content() const {
-  // @@protoc_insertion_point(field_get:oram_impl.SqrtMessage.content)
-  return _internal_content();
+inline uint32_t ReadSqrtRequest::_internal_tag() const {
+  return _impl_.tag_;
 }
-template <typename ArgT0, typename... ArgT>
-inline PROTOBUF_ALWAYS_INLINE
-void SqrtMessage::set_content(ArgT0&& arg0, ArgT... args) {
- 
- _impl_.content_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:oram_impl.SqrtMessage.content)
+inline uint32_t ReadSqrtRequest::tag() const {
+  // @@protoc_insertion_point(field_get:oram_impl.ReadSqrtRequest.tag)
+  return _internal_tag();
 }
-inline std::string* SqrtMessage::mutable_content() {
-  std::string* _s = _internal_mutable_content();
-  // @@protoc_insertion_point(field_mutable:oram_impl.SqrtMessage.content)
-  return _s;
+inline void ReadSqrtRequest::_internal_set_tag(uint32_t value) {
+  
+  _impl_.tag_ = value;
 }
-inline const std::string& SqrtMessage::_internal_content() const {
-  return _impl_.content_.Get();
+inline void ReadSqrtRequest::set_tag(uint32_t value) {
+  _internal_set_tag(value);
+  // @@protoc_insertion_point(field_set:oram_impl.ReadSqrtRequest.tag)
 }
-inline void SqrtMessage::_internal_set_content(const std::string& value) {
-  
-  _impl_.content_.Set(value, GetArenaForAllocation());
+
+// uint32 read_from = 3;
+inline void ReadSqrtRequest::clear_read_from() {
+  _impl_.read_from_ = 0u;
 }
-inline std::string* SqrtMessage::_internal_mutable_content() {
-  
-  return _impl_.content_.Mutable(GetArenaForAllocation());
+inline uint32_t ReadSqrtRequest::_internal_read_from() const {
+  return _impl_.read_from_;
 }
-inline std::string* SqrtMessage::release_content() {
-  // @@protoc_insertion_point(field_release:oram_impl.SqrtMessage.content)
-  return _impl_.content_.Release();
+inline uint32_t ReadSqrtRequest::read_from() const {
+  // @@protoc_insertion_point(field_get:oram_impl.ReadSqrtRequest.read_from)
+  return _internal_read_from();
 }
-inline void SqrtMessage::set_allocated_content(std::string* content) {
-  if (content != nullptr) {
-    
-  } else {
-    
-  }
-  _impl_.content_.SetAllocated(content, GetArenaForAllocation());
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (_impl_.content_.IsDefault()) {
-    _impl_.content_.Set("", GetArenaForAllocation());
-  }
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:oram_impl.SqrtMessage.content)
+inline void ReadSqrtRequest::_internal_set_read_from(uint32_t value) {
+  
+  _impl_.read_from_ = value;
+}
+inline void ReadSqrtRequest::set_read_from(uint32_t value) {
+  _internal_set_read_from(value);
+  // @@protoc_insertion_point(field_set:oram_impl.ReadSqrtRequest.read_from)
 }
 
 // -------------------------------------------------------------------
 
-// WriteSqrtMessage
+// ReadPathRequest
 
 // .oram_impl.RequestHeader header = 1;
-inline bool WriteSqrtMessage::_internal_has_header() const {
+inline bool ReadPathRequest::_internal_has_header() const {
   return this != internal_default_instance() && _impl_.header_ != nullptr;
 }
-inline bool WriteSqrtMessage::has_header() const {
+inline bool ReadPathRequest::has_header() const {
   return _internal_has_header();
 }
-inline void WriteSqrtMessage::clear_header() {
+inline void ReadPathRequest::clear_header() {
   if (GetArenaForAllocation() == nullptr && _impl_.header_ != nullptr) {
     delete _impl_.header_;
   }
   _impl_.header_ = nullptr;
 }
-inline const ::oram_impl::RequestHeader& WriteSqrtMessage::_internal_header() const {
+inline const ::oram_impl::RequestHeader& ReadPathRequest::_internal_header() const {
   const ::oram_impl::RequestHeader* p = _impl_.header_;
   return p != nullptr ? *p : reinterpret_cast<const ::oram_impl::RequestHeader&>(
       ::oram_impl::_RequestHeader_default_instance_);
 }
-inline const ::oram_impl::RequestHeader& WriteSqrtMessage::header() const {
-  // @@protoc_insertion_point(field_get:oram_impl.WriteSqrtMessage.header)
+inline const ::oram_impl::RequestHeader& ReadPathRequest::header() const {
+  // @@protoc_insertion_point(field_get:oram_impl.ReadPathRequest.header)
   return _internal_header();
 }
-inline void WriteSqrtMessage::unsafe_arena_set_allocated_header(
+inline void ReadPathRequest::unsafe_arena_set_allocated_header(
     ::oram_impl::RequestHeader* header) {
   if (GetArenaForAllocation() == nullptr) {
     delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.header_);
@@ -4605,9 +6992,9 @@ inline void WriteSqrtMessage::unsafe_arena_set_allocated_header(
   } else {
     
   }
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:oram_impl.WriteSqrtMessage.header)
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:oram_impl.ReadPathRequest.header)
 }
-inline ::oram_impl::RequestHeader* WriteSqrtMessage::release_header() {
+inline ::oram_impl::RequestHeader* ReadPathRequest::release_header() {
   
   ::oram_impl::RequestHeader* temp = _impl_.header_;
   _impl_.header_ = nullptr;
@@ -4622,14 +7009,14 @@ inline ::oram_impl::RequestHeader* WriteSqrtMessage::release_header() {
 #endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
   return temp;
 }
-inline ::oram_impl::RequestHeader* WriteSqrtMessage::unsafe_arena_release_header() {
-  // @@protoc_insertion_point(field_release:oram_impl.WriteSqrtMessage.header)
+inline ::oram_impl::RequestHeader* ReadPathRequest::unsafe_arena_release_header() {
+  // @@protoc_insertion_point(field_release:oram_impl.ReadPathRequest.header)
   
   ::oram_impl::RequestHeader* temp = _impl_.header_;
   _impl_.header_ = nullptr;
   return temp;
 }
-inline ::oram_impl::RequestHeader* WriteSqrtMessage::_internal_mutable_header() {
+inline ::oram_impl::RequestHeader* ReadPathRequest::_internal_mutable_header() {
   
   if (_impl_.header_ == nullptr) {
     auto* p = CreateMaybeMessage<::oram_impl::RequestHeader>(GetArenaForAllocation());
@@ -4637,12 +7024,12 @@ inline ::oram_impl::RequestHeader* WriteSqrtMessage::_internal_mutable_header()
   }
   return _impl_.header_;
 }
-inline ::oram_impl::RequestHeader* WriteSqrtMessage::mutable_header() {
+inline ::oram_impl::RequestHeader* ReadPathRequest::mutable_header() {
   ::oram_impl::RequestHeader* _msg = _internal_mutable_header();
-  // @@protoc_insertion_point(field_mutable:oram_impl.WriteSqrtMessage.header)
+  // @@protoc_insertion_point(field_mutable:oram_impl.ReadPathRequest.header)
   return _msg;
 }
-inline void WriteSqrtMessage::set_allocated_header(::oram_impl::RequestHeader* header) {
+inline void ReadPathRequest::set_allocated_header(::oram_impl::RequestHeader* header) {
   ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
   if (message_arena == nullptr) {
     delete _impl_.header_;
@@ -4659,126 +7046,155 @@ inline void WriteSqrtMessage::set_allocated_header(::oram_impl::RequestHeader* h
     
   }
   _impl_.header_ = header;
-  // @@protoc_insertion_point(field_set_allocated:oram_impl.WriteSqrtMessage.header)
+  // @@protoc_insertion_point(field_set_allocated:oram_impl.ReadPathRequest.header)
 }
 
-// bytes content = 2;
-inline void WriteSqrtMessage::clear_content() {
-  _impl_.content_.ClearToEmpty();
+// uint32 path = 2;
+inline void ReadPathRequest::clear_path() {
+  _impl_.path_ = 0u;
 }
-inline const std::string& WriteSqrtMessage::content() const {
-  // @@protoc_insertion_point(field_get:oram_impl.WriteSqrtMessage.content)
-  return _internal_content();
+inline uint32_t ReadPathRequest::_internal_path() const {
+  return _impl_.path_;
 }
-template <typename ArgT0, typename... ArgT>
-inline PROTOBUF_ALWAYS_INLINE
-void WriteSqrtMessage::set_content(ArgT0&& arg0, ArgT... args) {
- 
- _impl_.content_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:oram_impl.WriteSqrtMessage.content)
+inline uint32_t ReadPathRequest::path() const {
+  // @@protoc_insertion_point(field_get:oram_impl.ReadPathRequest.path)
+  return _internal_path();
 }
-inline std::string* WriteSqrtMessage::mutable_content() {
-  std::string* _s = _internal_mutable_content();
-  // @@protoc_insertion_point(field_mutable:oram_impl.WriteSqrtMessage.content)
-  return _s;
+inline void ReadPathRequest::_internal_set_path(uint32_t value) {
+  
+  _impl_.path_ = value;
 }
-inline const std::string& WriteSqrtMessage::_internal_content() const {
-  return _impl_.content_.Get();
+inline void ReadPathRequest::set_path(uint32_t value) {
+  _internal_set_path(value);
+  // @@protoc_insertion_point(field_set:oram_impl.ReadPathRequest.path)
 }
-inline void WriteSqrtMessage::_internal_set_content(const std::string& value) {
-  
-  _impl_.content_.Set(value, GetArenaForAllocation());
+
+// uint32 level = 3;
+inline void ReadPathRequest::clear_level() {
+  _impl_.level_ = 0u;
 }
-inline std::string* WriteSqrtMessage::_internal_mutable_content() {
-  
-  return _impl_.content_.Mutable(GetArenaForAllocation());
+inline uint32_t ReadPathRequest::_internal_level() const {
+  return _impl_.level_;
 }
-inline std::string* WriteSqrtMessage::release_content() {
-  // @@protoc_insertion_point(field_release:oram_impl.WriteSqrtMessage.content)
-  return _impl_.content_.Release();
+inline uint32_t ReadPathRequest::level() const {
+  // @@protoc_insertion_point(field_get:oram_impl.ReadPathRequest.level)
+  return _internal_level();
 }
-inline void WriteSqrtMessage::set_allocated_content(std::string* content) {
-  if (content != nullptr) {
-    
-  } else {
-    
-  }
-  _impl_.content_.SetAllocated(content, GetArenaForAllocation());
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (_impl_.content_.IsDefault()) {
-    _impl_.content_.Set("", GetArenaForAllocation());
-  }
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:oram_impl.WriteSqrtMessage.content)
+inline void ReadPathRequest::_internal_set_level(uint32_t value) {
+  
+  _impl_.level_ = value;
+}
+inline void ReadPathRequest::set_level(uint32_t value) {
+  _internal_set_level(value);
+  // @@protoc_insertion_point(field_set:oram_impl.ReadPathRequest.level)
 }
 
-// bool write_to_cache = 3;
-inline void WriteSqrtMessage::clear_write_to_cache() {
-  _impl_.write_to_cache_ = false;
+// -------------------------------------------------------------------
+
+// ReadPathResponse
+
+// repeated bytes bucket = 1;
+inline int ReadPathResponse::_internal_bucket_size() const {
+  return _impl_.bucket_.size();
 }
-inline bool WriteSqrtMessage::_internal_write_to_cache() const {
-  return _impl_.write_to_cache_;
+inline int ReadPathResponse::bucket_size() const {
+  return _internal_bucket_size();
 }
-inline bool WriteSqrtMessage::write_to_cache() const {
-  // @@protoc_insertion_point(field_get:oram_impl.WriteSqrtMessage.write_to_cache)
-  return _internal_write_to_cache();
+inline void ReadPathResponse::clear_bucket() {
+  _impl_.bucket_.Clear();
 }
-inline void WriteSqrtMessage::_internal_set_write_to_cache(bool value) {
-  
-  _impl_.write_to_cache_ = value;
+inline std::string* ReadPathResponse::add_bucket() {
+  std::string* _s = _internal_add_bucket();
+  // @@protoc_insertion_point(field_add_mutable:oram_impl.ReadPathResponse.bucket)
+  return _s;
 }
-inline void WriteSqrtMessage::set_write_to_cache(bool value) {
-  _internal_set_write_to_cache(value);
-  // @@protoc_insertion_point(field_set:oram_impl.WriteSqrtMessage.write_to_cache)
+inline const std::string& ReadPathResponse::_internal_bucket(int index) const {
+  return _impl_.bucket_.Get(index);
 }
-
-// uint32 pos = 4;
-inline void WriteSqrtMessage::clear_pos() {
-  _impl_.pos_ = 0u;
+inline const std::string& ReadPathResponse::bucket(int index) const {
+  // @@protoc_insertion_point(field_get:oram_impl.ReadPathResponse.bucket)
+  return _internal_bucket(index);
+}
+inline std::string* ReadPathResponse::mutable_bucket(int index) {
+  // @@protoc_insertion_point(field_mutable:oram_impl.ReadPathResponse.bucket)
+  return _impl_.bucket_.Mutable(index);
+}
+inline void ReadPathResponse::set_bucket(int index, const std::string& value) {
+  _impl_.bucket_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set:oram_impl.ReadPathResponse.bucket)
+}
+inline void ReadPathResponse::set_bucket(int index, std::string&& value) {
+  _impl_.bucket_.Mutable(index)->assign(std::move(value));
+  // @@protoc_insertion_point(field_set:oram_impl.ReadPathResponse.bucket)
+}
+inline void ReadPathResponse::set_bucket(int index, const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.bucket_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:oram_impl.ReadPathResponse.bucket)
+}
+inline void ReadPathResponse::set_bucket(int index, const void* value, size_t size) {
+  _impl_.bucket_.Mutable(index)->assign(
+    reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:oram_impl.ReadPathResponse.bucket)
+}
+inline std::string* ReadPathResponse::_internal_add_bucket() {
+  return _impl_.bucket_.Add();
+}
+inline void ReadPathResponse::add_bucket(const std::string& value) {
+  _impl_.bucket_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:oram_impl.ReadPathResponse.bucket)
+}
+inline void ReadPathResponse::add_bucket(std::string&& value) {
+  _impl_.bucket_.Add(std::move(value));
+  // @@protoc_insertion_point(field_add:oram_impl.ReadPathResponse.bucket)
 }
-inline uint32_t WriteSqrtMessage::_internal_pos() const {
-  return _impl_.pos_;
+inline void ReadPathResponse::add_bucket(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.bucket_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:oram_impl.ReadPathResponse.bucket)
 }
-inline uint32_t WriteSqrtMessage::pos() const {
-  // @@protoc_insertion_point(field_get:oram_impl.WriteSqrtMessage.pos)
-  return _internal_pos();
+inline void ReadPathResponse::add_bucket(const void* value, size_t size) {
+  _impl_.bucket_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:oram_impl.ReadPathResponse.bucket)
 }
-inline void WriteSqrtMessage::_internal_set_pos(uint32_t value) {
-  
-  _impl_.pos_ = value;
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
+ReadPathResponse::bucket() const {
+  // @@protoc_insertion_point(field_list:oram_impl.ReadPathResponse.bucket)
+  return _impl_.bucket_;
 }
-inline void WriteSqrtMessage::set_pos(uint32_t value) {
-  _internal_set_pos(value);
-  // @@protoc_insertion_point(field_set:oram_impl.WriteSqrtMessage.pos)
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
+ReadPathResponse::mutable_bucket() {
+  // @@protoc_insertion_point(field_mutable_list:oram_impl.ReadPathResponse.bucket)
+  return &_impl_.bucket_;
 }
 
 // -------------------------------------------------------------------
 
-// SqrtPermMessage
+// WritePathRequest
 
 // .oram_impl.RequestHeader header = 1;
-inline bool SqrtPermMessage::_internal_has_header() const {
+inline bool WritePathRequest::_internal_has_header() const {
   return this != internal_default_instance() && _impl_.header_ != nullptr;
 }
-inline bool SqrtPermMessage::has_header() const {
+inline bool WritePathRequest::has_header() const {
   return _internal_has_header();
 }
-inline void SqrtPermMessage::clear_header() {
+inline void WritePathRequest::clear_header() {
   if (GetArenaForAllocation() == nullptr && _impl_.header_ != nullptr) {
     delete _impl_.header_;
   }
   _impl_.header_ = nullptr;
 }
-inline const ::oram_impl::RequestHeader& SqrtPermMessage::_internal_header() const {
+inline const ::oram_impl::RequestHeader& WritePathRequest::_internal_header() const {
   const ::oram_impl::RequestHeader* p = _impl_.header_;
   return p != nullptr ? *p : reinterpret_cast<const ::oram_impl::RequestHeader&>(
       ::oram_impl::_RequestHeader_default_instance_);
 }
-inline const ::oram_impl::RequestHeader& SqrtPermMessage::header() const {
-  // @@protoc_insertion_point(field_get:oram_impl.SqrtPermMessage.header)
+inline const ::oram_impl::RequestHeader& WritePathRequest::header() const {
+  // @@protoc_insertion_point(field_get:oram_impl.WritePathRequest.header)
   return _internal_header();
 }
-inline void SqrtPermMessage::unsafe_arena_set_allocated_header(
+inline void WritePathRequest::unsafe_arena_set_allocated_header(
     ::oram_impl::RequestHeader* header) {
   if (GetArenaForAllocation() == nullptr) {
     delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.header_);
@@ -4789,9 +7205,9 @@ inline void SqrtPermMessage::unsafe_arena_set_allocated_header(
   } else {
     
   }
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:oram_impl.SqrtPermMessage.header)
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:oram_impl.WritePathRequest.header)
 }
-inline ::oram_impl::RequestHeader* SqrtPermMessage::release_header() {
+inline ::oram_impl::RequestHeader* WritePathRequest::release_header() {
   
   ::oram_impl::RequestHeader* temp = _impl_.header_;
   _impl_.header_ = nullptr;
@@ -4806,14 +7222,14 @@ inline ::oram_impl::RequestHeader* SqrtPermMessage::release_header() {
 #endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
   return temp;
 }
-inline ::oram_impl::RequestHeader* SqrtPermMessage::unsafe_arena_release_header() {
-  // @@protoc_insertion_point(field_release:oram_impl.SqrtPermMessage.header)
+inline ::oram_impl::RequestHeader* WritePathRequest::unsafe_arena_release_header() {
+  // @@protoc_insertion_point(field_release:oram_impl.WritePathRequest.header)
   
   ::oram_impl::RequestHeader* temp = _impl_.header_;
   _impl_.header_ = nullptr;
   return temp;
 }
-inline ::oram_impl::RequestHeader* SqrtPermMessage::_internal_mutable_header() {
+inline ::oram_impl::RequestHeader* WritePathRequest::_internal_mutable_header() {
   
   if (_impl_.header_ == nullptr) {
     auto* p = CreateMaybeMessage<::oram_impl::RequestHeader>(GetArenaForAllocation());
@@ -4821,12 +7237,12 @@ inline ::oram_impl::RequestHeader* SqrtPermMessage::_internal_mutable_header() {
   }
   return _impl_.header_;
 }
-inline ::oram_impl::RequestHeader* SqrtPermMessage::mutable_header() {
+inline ::oram_impl::RequestHeader* WritePathRequest::mutable_header() {
   ::oram_impl::RequestHeader* _msg = _internal_mutable_header();
-  // @@protoc_insertion_point(field_mutable:oram_impl.SqrtPermMessage.header)
+  // @@protoc_insertion_point(field_mutable:oram_impl.WritePathRequest.header)
   return _msg;
 }
-inline void SqrtPermMessage::set_allocated_header(::oram_impl::RequestHeader* header) {
+inline void WritePathRequest::set_allocated_header(::oram_impl::RequestHeader* header) {
   ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
   if (message_arena == nullptr) {
     delete _impl_.header_;
@@ -4843,83 +7259,286 @@ inline void SqrtPermMessage::set_allocated_header(::oram_impl::RequestHeader* he
     
   }
   _impl_.header_ = header;
-  // @@protoc_insertion_point(field_set_allocated:oram_impl.SqrtPermMessage.header)
+  // @@protoc_insertion_point(field_set_allocated:oram_impl.WritePathRequest.header)
 }
 
-// repeated uint32 perms = 2;
-inline int SqrtPermMessage::_internal_perms_size() const {
-  return _impl_.perms_.size();
+// uint32 path = 2;
+inline void WritePathRequest::clear_path() {
+  _impl_.path_ = 0u;
 }
-inline int SqrtPermMessage::perms_size() const {
-  return _internal_perms_size();
+inline uint32_t WritePathRequest::_internal_path() const {
+  return _impl_.path_;
+}
+inline uint32_t WritePathRequest::path() const {
+  // @@protoc_insertion_point(field_get:oram_impl.WritePathRequest.path)
+  return _internal_path();
+}
+inline void WritePathRequest::_internal_set_path(uint32_t value) {
+  
+  _impl_.path_ = value;
+}
+inline void WritePathRequest::set_path(uint32_t value) {
+  _internal_set_path(value);
+  // @@protoc_insertion_point(field_set:oram_impl.WritePathRequest.path)
+}
+
+// uint32 level = 3;
+inline void WritePathRequest::clear_level() {
+  _impl_.level_ = 0u;
+}
+inline uint32_t WritePathRequest::_internal_level() const {
+  return _impl_.level_;
+}
+inline uint32_t WritePathRequest::level() const {
+  // @@protoc_insertion_point(field_get:oram_impl.WritePathRequest.level)
+  return _internal_level();
+}
+inline void WritePathRequest::_internal_set_level(uint32_t value) {
+  
+  _impl_.level_ = value;
+}
+inline void WritePathRequest::set_level(uint32_t value) {
+  _internal_set_level(value);
+  // @@protoc_insertion_point(field_set:oram_impl.WritePathRequest.level)
+}
+
+// repeated bytes bucket = 4;
+inline int WritePathRequest::_internal_bucket_size() const {
+  return _impl_.bucket_.size();
+}
+inline int WritePathRequest::bucket_size() const {
+  return _internal_bucket_size();
+}
+inline void WritePathRequest::clear_bucket() {
+  _impl_.bucket_.Clear();
+}
+inline std::string* WritePathRequest::add_bucket() {
+  std::string* _s = _internal_add_bucket();
+  // @@protoc_insertion_point(field_add_mutable:oram_impl.WritePathRequest.bucket)
+  return _s;
+}
+inline const std::string& WritePathRequest::_internal_bucket(int index) const {
+  return _impl_.bucket_.Get(index);
+}
+inline const std::string& WritePathRequest::bucket(int index) const {
+  // @@protoc_insertion_point(field_get:oram_impl.WritePathRequest.bucket)
+  return _internal_bucket(index);
+}
+inline std::string* WritePathRequest::mutable_bucket(int index) {
+  // @@protoc_insertion_point(field_mutable:oram_impl.WritePathRequest.bucket)
+  return _impl_.bucket_.Mutable(index);
+}
+inline void WritePathRequest::set_bucket(int index, const std::string& value) {
+  _impl_.bucket_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set:oram_impl.WritePathRequest.bucket)
+}
+inline void WritePathRequest::set_bucket(int index, std::string&& value) {
+  _impl_.bucket_.Mutable(index)->assign(std::move(value));
+  // @@protoc_insertion_point(field_set:oram_impl.WritePathRequest.bucket)
+}
+inline void WritePathRequest::set_bucket(int index, const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.bucket_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:oram_impl.WritePathRequest.bucket)
+}
+inline void WritePathRequest::set_bucket(int index, const void* value, size_t size) {
+  _impl_.bucket_.Mutable(index)->assign(
+    reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:oram_impl.WritePathRequest.bucket)
+}
+inline std::string* WritePathRequest::_internal_add_bucket() {
+  return _impl_.bucket_.Add();
+}
+inline void WritePathRequest::add_bucket(const std::string& value) {
+  _impl_.bucket_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:oram_impl.WritePathRequest.bucket)
+}
+inline void WritePathRequest::add_bucket(std::string&& value) {
+  _impl_.bucket_.Add(std::move(value));
+  // @@protoc_insertion_point(field_add:oram_impl.WritePathRequest.bucket)
+}
+inline void WritePathRequest::add_bucket(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.bucket_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:oram_impl.WritePathRequest.bucket)
+}
+inline void WritePathRequest::add_bucket(const void* value, size_t size) {
+  _impl_.bucket_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:oram_impl.WritePathRequest.bucket)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
+WritePathRequest::bucket() const {
+  // @@protoc_insertion_point(field_list:oram_impl.WritePathRequest.bucket)
+  return _impl_.bucket_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
+WritePathRequest::mutable_bucket() {
+  // @@protoc_insertion_point(field_mutable_list:oram_impl.WritePathRequest.bucket)
+  return &_impl_.bucket_;
+}
+
+// optional .oram_impl.Type type = 5;
+inline bool WritePathRequest::_internal_has_type() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool WritePathRequest::has_type() const {
+  return _internal_has_type();
+}
+inline void WritePathRequest::clear_type() {
+  _impl_.type_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline ::oram_impl::Type WritePathRequest::_internal_type() const {
+  return static_cast< ::oram_impl::Type >(_impl_.type_);
+}
+inline ::oram_impl::Type WritePathRequest::type() const {
+  // @@protoc_insertion_point(field_get:oram_impl.WritePathRequest.type)
+  return _internal_type();
+}
+inline void WritePathRequest::_internal_set_type(::oram_impl::Type value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.type_ = value;
+}
+inline void WritePathRequest::set_type(::oram_impl::Type value) {
+  _internal_set_type(value);
+  // @@protoc_insertion_point(field_set:oram_impl.WritePathRequest.type)
+}
+
+// optional uint32 offset = 6;
+inline bool WritePathRequest::_internal_has_offset() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool WritePathRequest::has_offset() const {
+  return _internal_has_offset();
+}
+inline void WritePathRequest::clear_offset() {
+  _impl_.offset_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline uint32_t WritePathRequest::_internal_offset() const {
+  return _impl_.offset_;
+}
+inline uint32_t WritePathRequest::offset() const {
+  // @@protoc_insertion_point(field_get:oram_impl.WritePathRequest.offset)
+  return _internal_offset();
+}
+inline void WritePathRequest::_internal_set_offset(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.offset_ = value;
+}
+inline void WritePathRequest::set_offset(uint32_t value) {
+  _internal_set_offset(value);
+  // @@protoc_insertion_point(field_set:oram_impl.WritePathRequest.offset)
+}
+
+// -------------------------------------------------------------------
+
+// BucketMessage
+
+// repeated bytes bucket = 1;
+inline int BucketMessage::_internal_bucket_size() const {
+  return _impl_.bucket_.size();
+}
+inline int BucketMessage::bucket_size() const {
+  return _internal_bucket_size();
+}
+inline void BucketMessage::clear_bucket() {
+  _impl_.bucket_.Clear();
+}
+inline std::string* BucketMessage::add_bucket() {
+  std::string* _s = _internal_add_bucket();
+  // @@protoc_insertion_point(field_add_mutable:oram_impl.BucketMessage.bucket)
+  return _s;
+}
+inline const std::string& BucketMessage::_internal_bucket(int index) const {
+  return _impl_.bucket_.Get(index);
+}
+inline const std::string& BucketMessage::bucket(int index) const {
+  // @@protoc_insertion_point(field_get:oram_impl.BucketMessage.bucket)
+  return _internal_bucket(index);
+}
+inline std::string* BucketMessage::mutable_bucket(int index) {
+  // @@protoc_insertion_point(field_mutable:oram_impl.BucketMessage.bucket)
+  return _impl_.bucket_.Mutable(index);
+}
+inline void BucketMessage::set_bucket(int index, const std::string& value) {
+  _impl_.bucket_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set:oram_impl.BucketMessage.bucket)
 }
-inline void SqrtPermMessage::clear_perms() {
-  _impl_.perms_.Clear();
+inline void BucketMessage::set_bucket(int index, std::string&& value) {
+  _impl_.bucket_.Mutable(index)->assign(std::move(value));
+  // @@protoc_insertion_point(field_set:oram_impl.BucketMessage.bucket)
 }
-inline uint32_t SqrtPermMessage::_internal_perms(int index) const {
-  return _impl_.perms_.Get(index);
+inline void BucketMessage::set_bucket(int index, const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.bucket_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:oram_impl.BucketMessage.bucket)
 }
-inline uint32_t SqrtPermMessage::perms(int index) const {
-  // @@protoc_insertion_point(field_get:oram_impl.SqrtPermMessage.perms)
-  return _internal_perms(index);
+inline void BucketMessage::set_bucket(int index, const void* value, size_t size) {
+  _impl_.bucket_.Mutable(index)->assign(
+    reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:oram_impl.BucketMessage.bucket)
 }
-inline void SqrtPermMessage::set_perms(int index, uint32_t value) {
-  _impl_.perms_.Set(index, value);
-  // @@protoc_insertion_point(field_set:oram_impl.SqrtPermMessage.perms)
+inline std::string* BucketMessage::_internal_add_bucket() {
+  return _impl_.bucket_.Add();
 }
-inline void SqrtPermMessage::_internal_add_perms(uint32_t value) {
-  _impl_.perms_.Add(value);
+inline void BucketMessage::add_bucket(const std::string& value) {
+  _impl_.bucket_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:oram_impl.BucketMessage.bucket)
 }
-inline void SqrtPermMessage::add_perms(uint32_t value) {
-  _internal_add_perms(value);
-  // @@protoc_insertion_point(field_add:oram_impl.SqrtPermMessage.perms)
+inline void BucketMessage::add_bucket(std::string&& value) {
+  _impl_.bucket_.Add(std::move(value));
+  // @@protoc_insertion_point(field_add:oram_impl.BucketMessage.bucket)
 }
-inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
-SqrtPermMessage::_internal_perms() const {
-  return _impl_.perms_;
+inline void BucketMessage::add_bucket(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.bucket_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:oram_impl.BucketMessage.bucket)
 }
-inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
-SqrtPermMessage::perms() const {
-  // @@protoc_insertion_point(field_list:oram_impl.SqrtPermMessage.perms)
-  return _internal_perms();
+inline void BucketMessage::add_bucket(const void* value, size_t size) {
+  _impl_.bucket_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:oram_impl.BucketMessage.bucket)
 }
-inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
-SqrtPermMessage::_internal_mutable_perms() {
-  return &_impl_.perms_;
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
+BucketMessage::bucket() const {
+  // @@protoc_insertion_point(field_list:oram_impl.BucketMessage.bucket)
+  return _impl_.bucket_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
-SqrtPermMessage::mutable_perms() {
-  // @@protoc_insertion_point(field_mutable_list:oram_impl.SqrtPermMessage.perms)
-  return _internal_mutable_perms();
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
+BucketMessage::mutable_bucket() {
+  // @@protoc_insertion_point(field_mutable_list:oram_impl.BucketMessage.bucket)
+  return &_impl_.bucket_;
 }
 
 // -------------------------------------------------------------------
 
-// InitTreeOramRequest
+// ReadFullPathRequest
 
 // .oram_impl.RequestHeader header = 1;
-inline bool InitTreeOramRequest::_internal_has_header() const {
+inline bool ReadFullPathRequest::_internal_has_header() const {
   return this != internal_default_instance() && _impl_.header_ != nullptr;
 }
-inline bool InitTreeOramRequest::has_header() const {
+inline bool ReadFullPathRequest::has_header() const {
   return _internal_has_header();
 }
-inline void InitTreeOramRequest::clear_header() {
+inline void ReadFullPathRequest::clear_header() {
   if (GetArenaForAllocation() == nullptr && _impl_.header_ != nullptr) {
     delete _impl_.header_;
   }
   _impl_.header_ = nullptr;
 }
-inline const ::oram_impl::RequestHeader& InitTreeOramRequest::_internal_header() const {
+inline const ::oram_impl::RequestHeader& ReadFullPathRequest::_internal_header() const {
   const ::oram_impl::RequestHeader* p = _impl_.header_;
   return p != nullptr ? *p : reinterpret_cast<const ::oram_impl::RequestHeader&>(
       ::oram_impl::_RequestHeader_default_instance_);
 }
-inline const ::oram_impl::RequestHeader& InitTreeOramRequest::header() const {
-  // @@protoc_insertion_point(field_get:oram_impl.InitTreeOramRequest.header)
+inline const ::oram_impl::RequestHeader& ReadFullPathRequest::header() const {
+  // @@protoc_insertion_point(field_get:oram_impl.ReadFullPathRequest.header)
   return _internal_header();
 }
-inline void InitTreeOramRequest::unsafe_arena_set_allocated_header(
+inline void ReadFullPathRequest::unsafe_arena_set_allocated_header(
     ::oram_impl::RequestHeader* header) {
   if (GetArenaForAllocation() == nullptr) {
     delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.header_);
@@ -4930,9 +7549,9 @@ inline void InitTreeOramRequest::unsafe_arena_set_allocated_header(
   } else {
     
   }
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:oram_impl.InitTreeOramRequest.header)
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:oram_impl.ReadFullPathRequest.header)
 }
-inline ::oram_impl::RequestHeader* InitTreeOramRequest::release_header() {
+inline ::oram_impl::RequestHeader* ReadFullPathRequest::release_header() {
   
   ::oram_impl::RequestHeader* temp = _impl_.header_;
   _impl_.header_ = nullptr;
@@ -4947,14 +7566,14 @@ inline ::oram_impl::RequestHeader* InitTreeOramRequest::release_header() {
 #endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
   return temp;
 }
-inline ::oram_impl::RequestHeader* InitTreeOramRequest::unsafe_arena_release_header() {
-  // @@protoc_insertion_point(field_release:oram_impl.InitTreeOramRequest.header)
+inline ::oram_impl::RequestHeader* ReadFullPathRequest::unsafe_arena_release_header() {
+  // @@protoc_insertion_point(field_release:oram_impl.ReadFullPathRequest.header)
   
   ::oram_impl::RequestHeader* temp = _impl_.header_;
   _impl_.header_ = nullptr;
   return temp;
 }
-inline ::oram_impl::RequestHeader* InitTreeOramRequest::_internal_mutable_header() {
+inline ::oram_impl::RequestHeader* ReadFullPathRequest::_internal_mutable_header() {
   
   if (_impl_.header_ == nullptr) {
     auto* p = CreateMaybeMessage<::oram_impl::RequestHeader>(GetArenaForAllocation());
@@ -4962,12 +7581,12 @@ inline ::oram_impl::RequestHeader* InitTreeOramRequest::_internal_mutable_header
   }
   return _impl_.header_;
 }
-inline ::oram_impl::RequestHeader* InitTreeOramRequest::mutable_header() {
+inline ::oram_impl::RequestHeader* ReadFullPathRequest::mutable_header() {
   ::oram_impl::RequestHeader* _msg = _internal_mutable_header();
-  // @@protoc_insertion_point(field_mutable:oram_impl.InitTreeOramRequest.header)
+  // @@protoc_insertion_point(field_mutable:oram_impl.ReadFullPathRequest.header)
   return _msg;
 }
-inline void InitTreeOramRequest::set_allocated_header(::oram_impl::RequestHeader* header) {
+inline void ReadFullPathRequest::set_allocated_header(::oram_impl::RequestHeader* header) {
   ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
   if (message_arena == nullptr) {
     delete _impl_.header_;
@@ -4984,96 +7603,120 @@ inline void InitTreeOramRequest::set_allocated_header(::oram_impl::RequestHeader
     
   }
   _impl_.header_ = header;
-  // @@protoc_insertion_point(field_set_allocated:oram_impl.InitTreeOramRequest.header)
+  // @@protoc_insertion_point(field_set_allocated:oram_impl.ReadFullPathRequest.header)
 }
 
-// uint32 bucket_size = 2;
-inline void InitTreeOramRequest::clear_bucket_size() {
-  _impl_.bucket_size_ = 0u;
+// uint32 path = 2;
+inline void ReadFullPathRequest::clear_path() {
+  _impl_.path_ = 0u;
 }
-inline uint32_t InitTreeOramRequest::_internal_bucket_size() const {
-  return _impl_.bucket_size_;
+inline uint32_t ReadFullPathRequest::_internal_path() const {
+  return _impl_.path_;
 }
-inline uint32_t InitTreeOramRequest::bucket_size() const {
-  // @@protoc_insertion_point(field_get:oram_impl.InitTreeOramRequest.bucket_size)
-  return _internal_bucket_size();
+inline uint32_t ReadFullPathRequest::path() const {
+  // @@protoc_insertion_point(field_get:oram_impl.ReadFullPathRequest.path)
+  return _internal_path();
 }
-inline void InitTreeOramRequest::_internal_set_bucket_size(uint32_t value) {
+inline void ReadFullPathRequest::_internal_set_path(uint32_t value) {
   
-  _impl_.bucket_size_ = value;
+  _impl_.path_ = value;
 }
-inline void InitTreeOramRequest::set_bucket_size(uint32_t value) {
-  _internal_set_bucket_size(value);
-  // @@protoc_insertion_point(field_set:oram_impl.InitTreeOramRequest.bucket_size)
+inline void ReadFullPathRequest::set_path(uint32_t value) {
+  _internal_set_path(value);
+  // @@protoc_insertion_point(field_set:oram_impl.ReadFullPathRequest.path)
 }
 
-// uint32 bucket_num = 3;
-inline void InitTreeOramRequest::clear_bucket_num() {
-  _impl_.bucket_num_ = 0u;
+// uint32 start_level = 3;
+inline void ReadFullPathRequest::clear_start_level() {
+  _impl_.start_level_ = 0u;
 }
-inline uint32_t InitTreeOramRequest::_internal_bucket_num() const {
-  return _impl_.bucket_num_;
+inline uint32_t ReadFullPathRequest::_internal_start_level() const {
+  return _impl_.start_level_;
 }
-inline uint32_t InitTreeOramRequest::bucket_num() const {
-  // @@protoc_insertion_point(field_get:oram_impl.InitTreeOramRequest.bucket_num)
-  return _internal_bucket_num();
+inline uint32_t ReadFullPathRequest::start_level() const {
+  // @@protoc_insertion_point(field_get:oram_impl.ReadFullPathRequest.start_level)
+  return _internal_start_level();
 }
-inline void InitTreeOramRequest::_internal_set_bucket_num(uint32_t value) {
+inline void ReadFullPathRequest::_internal_set_start_level(uint32_t value) {
   
-  _impl_.bucket_num_ = value;
+  _impl_.start_level_ = value;
 }
-inline void InitTreeOramRequest::set_bucket_num(uint32_t value) {
-  _internal_set_bucket_num(value);
-  // @@protoc_insertion_point(field_set:oram_impl.InitTreeOramRequest.bucket_num)
+inline void ReadFullPathRequest::set_start_level(uint32_t value) {
+  _internal_set_start_level(value);
+  // @@protoc_insertion_point(field_set:oram_impl.ReadFullPathRequest.start_level)
 }
 
-// uint32 block_size = 4;
-inline void InitTreeOramRequest::clear_block_size() {
-  _impl_.block_size_ = 0u;
+// -------------------------------------------------------------------
+
+// ReadFullPathResponse
+
+// repeated .oram_impl.BucketMessage buckets = 1;
+inline int ReadFullPathResponse::_internal_buckets_size() const {
+  return _impl_.buckets_.size();
 }
-inline uint32_t InitTreeOramRequest::_internal_block_size() const {
-  return _impl_.block_size_;
+inline int ReadFullPathResponse::buckets_size() const {
+  return _internal_buckets_size();
 }
-inline uint32_t InitTreeOramRequest::block_size() const {
-  // @@protoc_insertion_point(field_get:oram_impl.InitTreeOramRequest.block_size)
-  return _internal_block_size();
+inline void ReadFullPathResponse::clear_buckets() {
+  _impl_.buckets_.Clear();
 }
-inline void InitTreeOramRequest::_internal_set_block_size(uint32_t value) {
-  
-  _impl_.block_size_ = value;
+inline ::oram_impl::BucketMessage* ReadFullPathResponse::mutable_buckets(int index) {
+  // @@protoc_insertion_point(field_mutable:oram_impl.ReadFullPathResponse.buckets)
+  return _impl_.buckets_.Mutable(index);
 }
-inline void InitTreeOramRequest::set_block_size(uint32_t value) {
-  _internal_set_block_size(value);
-  // @@protoc_insertion_point(field_set:oram_impl.InitTreeOramRequest.block_size)
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::oram_impl::BucketMessage >*
+ReadFullPathResponse::mutable_buckets() {
+  // @@protoc_insertion_point(field_mutable_list:oram_impl.ReadFullPathResponse.buckets)
+  return &_impl_.buckets_;
+}
+inline const ::oram_impl::BucketMessage& ReadFullPathResponse::_internal_buckets(int index) const {
+  return _impl_.buckets_.Get(index);
+}
+inline const ::oram_impl::BucketMessage& ReadFullPathResponse::buckets(int index) const {
+  // @@protoc_insertion_point(field_get:oram_impl.ReadFullPathResponse.buckets)
+  return _internal_buckets(index);
+}
+inline ::oram_impl::BucketMessage* ReadFullPathResponse::_internal_add_buckets() {
+  return _impl_.buckets_.Add();
+}
+inline ::oram_impl::BucketMessage* ReadFullPathResponse::add_buckets() {
+  ::oram_impl::BucketMessage* _add = _internal_add_buckets();
+  // @@protoc_insertion_point(field_add:oram_impl.ReadFullPathResponse.buckets)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::oram_impl::BucketMessage >&
+ReadFullPathResponse::buckets() const {
+  // @@protoc_insertion_point(field_list:oram_impl.ReadFullPathResponse.buckets)
+  return _impl_.buckets_;
 }
 
 // -------------------------------------------------------------------
 
-// ReadFlatRequest
+// WriteFullPathRequest
 
 // .oram_impl.RequestHeader header = 1;
-inline bool ReadFlatRequest::_internal_has_header() const {
+inline bool WriteFullPathRequest::_internal_has_header() const {
   return this != internal_default_instance() && _impl_.header_ != nullptr;
 }
-inline bool ReadFlatRequest::has_header() const {
+inline bool WriteFullPathRequest::has_header() const {
   return _internal_has_header();
 }
-inline void ReadFlatRequest::clear_header() {
+inline void WriteFullPathRequest::clear_header() {
   if (GetArenaForAllocation() == nullptr && _impl_.header_ != nullptr) {
     delete _impl_.header_;
   }
   _impl_.header_ = nullptr;
 }
-inline const ::oram_impl::RequestHeader& ReadFlatRequest::_internal_header() const {
+inline const ::oram_impl::RequestHeader& WriteFullPathRequest::_internal_header() const {
   const ::oram_impl::RequestHeader* p = _impl_.header_;
   return p != nullptr ? *p : reinterpret_cast<const ::oram_impl::RequestHeader&>(
       ::oram_impl::_RequestHeader_default_instance_);
 }
-inline const ::oram_impl::RequestHeader& ReadFlatRequest::header() const {
-  // @@protoc_insertion_point(field_get:oram_impl.ReadFlatRequest.header)
+inline const ::oram_impl::RequestHeader& WriteFullPathRequest::header() const {
+  // @@protoc_insertion_point(field_get:oram_impl.WriteFullPathRequest.header)
   return _internal_header();
 }
-inline void ReadFlatRequest::unsafe_arena_set_allocated_header(
+inline void WriteFullPathRequest::unsafe_arena_set_allocated_header(
     ::oram_impl::RequestHeader* header) {
   if (GetArenaForAllocation() == nullptr) {
     delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.header_);
@@ -5084,9 +7727,9 @@ inline void ReadFlatRequest::unsafe_arena_set_allocated_header(
   } else {
     
   }
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:oram_impl.ReadFlatRequest.header)
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:oram_impl.WriteFullPathRequest.header)
 }
-inline ::oram_impl::RequestHeader* ReadFlatRequest::release_header() {
+inline ::oram_impl::RequestHeader* WriteFullPathRequest::release_header() {
   
   ::oram_impl::RequestHeader* temp = _impl_.header_;
   _impl_.header_ = nullptr;
@@ -5101,14 +7744,14 @@ inline ::oram_impl::RequestHeader* ReadFlatRequest::release_header() {
 #endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
   return temp;
 }
-inline ::oram_impl::RequestHeader* ReadFlatRequest::unsafe_arena_release_header() {
-  // @@protoc_insertion_point(field_release:oram_impl.ReadFlatRequest.header)
+inline ::oram_impl::RequestHeader* WriteFullPathRequest::unsafe_arena_release_header() {
+  // @@protoc_insertion_point(field_release:oram_impl.WriteFullPathRequest.header)
   
   ::oram_impl::RequestHeader* temp = _impl_.header_;
   _impl_.header_ = nullptr;
   return temp;
 }
-inline ::oram_impl::RequestHeader* ReadFlatRequest::_internal_mutable_header() {
+inline ::oram_impl::RequestHeader* WriteFullPathRequest::_internal_mutable_header() {
   
   if (_impl_.header_ == nullptr) {
     auto* p = CreateMaybeMessage<::oram_impl::RequestHeader>(GetArenaForAllocation());
@@ -5116,12 +7759,12 @@ inline ::oram_impl::RequestHeader* ReadFlatRequest::_internal_mutable_header() {
   }
   return _impl_.header_;
 }
-inline ::oram_impl::RequestHeader* ReadFlatRequest::mutable_header() {
+inline ::oram_impl::RequestHeader* WriteFullPathRequest::mutable_header() {
   ::oram_impl::RequestHeader* _msg = _internal_mutable_header();
-  // @@protoc_insertion_point(field_mutable:oram_impl.ReadFlatRequest.header)
+  // @@protoc_insertion_point(field_mutable:oram_impl.WriteFullPathRequest.header)
   return _msg;
 }
-inline void ReadFlatRequest::set_allocated_header(::oram_impl::RequestHeader* header) {
+inline void WriteFullPathRequest::set_allocated_header(::oram_impl::RequestHeader* header) {
   ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
   if (message_arena == nullptr) {
     delete _impl_.header_;
@@ -5138,36 +7781,167 @@ inline void ReadFlatRequest::set_allocated_header(::oram_impl::RequestHeader* he
     
   }
   _impl_.header_ = header;
-  // @@protoc_insertion_point(field_set_allocated:oram_impl.ReadFlatRequest.header)
+  // @@protoc_insertion_point(field_set_allocated:oram_impl.WriteFullPathRequest.header)
+}
+
+// uint32 path = 2;
+inline void WriteFullPathRequest::clear_path() {
+  _impl_.path_ = 0u;
+}
+inline uint32_t WriteFullPathRequest::_internal_path() const {
+  return _impl_.path_;
+}
+inline uint32_t WriteFullPathRequest::path() const {
+  // @@protoc_insertion_point(field_get:oram_impl.WriteFullPathRequest.path)
+  return _internal_path();
+}
+inline void WriteFullPathRequest::_internal_set_path(uint32_t value) {
+  
+  _impl_.path_ = value;
+}
+inline void WriteFullPathRequest::set_path(uint32_t value) {
+  _internal_set_path(value);
+  // @@protoc_insertion_point(field_set:oram_impl.WriteFullPathRequest.path)
+}
+
+// repeated .oram_impl.BucketMessage buckets = 3;
+inline int WriteFullPathRequest::_internal_buckets_size() const {
+  return _impl_.buckets_.size();
+}
+inline int WriteFullPathRequest::buckets_size() const {
+  return _internal_buckets_size();
+}
+inline void WriteFullPathRequest::clear_buckets() {
+  _impl_.buckets_.Clear();
+}
+inline ::oram_impl::BucketMessage* WriteFullPathRequest::mutable_buckets(int index) {
+  // @@protoc_insertion_point(field_mutable:oram_impl.WriteFullPathRequest.buckets)
+  return _impl_.buckets_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::oram_impl::BucketMessage >*
+WriteFullPathRequest::mutable_buckets() {
+  // @@protoc_insertion_point(field_mutable_list:oram_impl.WriteFullPathRequest.buckets)
+  return &_impl_.buckets_;
+}
+inline const ::oram_impl::BucketMessage& WriteFullPathRequest::_internal_buckets(int index) const {
+  return _impl_.buckets_.Get(index);
+}
+inline const ::oram_impl::BucketMessage& WriteFullPathRequest::buckets(int index) const {
+  // @@protoc_insertion_point(field_get:oram_impl.WriteFullPathRequest.buckets)
+  return _internal_buckets(index);
+}
+inline ::oram_impl::BucketMessage* WriteFullPathRequest::_internal_add_buckets() {
+  return _impl_.buckets_.Add();
+}
+inline ::oram_impl::BucketMessage* WriteFullPathRequest::add_buckets() {
+  ::oram_impl::BucketMessage* _add = _internal_add_buckets();
+  // @@protoc_insertion_point(field_add:oram_impl.WriteFullPathRequest.buckets)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::oram_impl::BucketMessage >&
+WriteFullPathRequest::buckets() const {
+  // @@protoc_insertion_point(field_list:oram_impl.WriteFullPathRequest.buckets)
+  return _impl_.buckets_;
+}
+
+// uint32 start_level = 4;
+inline void WriteFullPathRequest::clear_start_level() {
+  _impl_.start_level_ = 0u;
+}
+inline uint32_t WriteFullPathRequest::_internal_start_level() const {
+  return _impl_.start_level_;
+}
+inline uint32_t WriteFullPathRequest::start_level() const {
+  // @@protoc_insertion_point(field_get:oram_impl.WriteFullPathRequest.start_level)
+  return _internal_start_level();
+}
+inline void WriteFullPathRequest::_internal_set_start_level(uint32_t value) {
+  
+  _impl_.start_level_ = value;
+}
+inline void WriteFullPathRequest::set_start_level(uint32_t value) {
+  _internal_set_start_level(value);
+  // @@protoc_insertion_point(field_set:oram_impl.WriteFullPathRequest.start_level)
 }
 
 // -------------------------------------------------------------------
 
-// ReadSqrtRequest
+// SlotListMessage
+
+// repeated uint32 slot = 1;
+inline int SlotListMessage::_internal_slot_size() const {
+  return _impl_.slot_.size();
+}
+inline int SlotListMessage::slot_size() const {
+  return _internal_slot_size();
+}
+inline void SlotListMessage::clear_slot() {
+  _impl_.slot_.Clear();
+}
+inline uint32_t SlotListMessage::_internal_slot(int index) const {
+  return _impl_.slot_.Get(index);
+}
+inline uint32_t SlotListMessage::slot(int index) const {
+  // @@protoc_insertion_point(field_get:oram_impl.SlotListMessage.slot)
+  return _internal_slot(index);
+}
+inline void SlotListMessage::set_slot(int index, uint32_t value) {
+  _impl_.slot_.Set(index, value);
+  // @@protoc_insertion_point(field_set:oram_impl.SlotListMessage.slot)
+}
+inline void SlotListMessage::_internal_add_slot(uint32_t value) {
+  _impl_.slot_.Add(value);
+}
+inline void SlotListMessage::add_slot(uint32_t value) {
+  _internal_add_slot(value);
+  // @@protoc_insertion_point(field_add:oram_impl.SlotListMessage.slot)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+SlotListMessage::_internal_slot() const {
+  return _impl_.slot_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+SlotListMessage::slot() const {
+  // @@protoc_insertion_point(field_list:oram_impl.SlotListMessage.slot)
+  return _internal_slot();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+SlotListMessage::_internal_mutable_slot() {
+  return &_impl_.slot_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+SlotListMessage::mutable_slot() {
+  // @@protoc_insertion_point(field_mutable_list:oram_impl.SlotListMessage.slot)
+  return _internal_mutable_slot();
+}
+
+// -------------------------------------------------------------------
+
+// ReadSlotsRequest
 
 // .oram_impl.RequestHeader header = 1;
-inline bool ReadSqrtRequest::_internal_has_header() const {
+inline bool ReadSlotsRequest::_internal_has_header() const {
   return this != internal_default_instance() && _impl_.header_ != nullptr;
 }
-inline bool ReadSqrtRequest::has_header() const {
+inline bool ReadSlotsRequest::has_header() const {
   return _internal_has_header();
 }
-inline void ReadSqrtRequest::clear_header() {
+inline void ReadSlotsRequest::clear_header() {
   if (GetArenaForAllocation() == nullptr && _impl_.header_ != nullptr) {
     delete _impl_.header_;
   }
   _impl_.header_ = nullptr;
 }
-inline const ::oram_impl::RequestHeader& ReadSqrtRequest::_internal_header() const {
+inline const ::oram_impl::RequestHeader& ReadSlotsRequest::_internal_header() const {
   const ::oram_impl::RequestHeader* p = _impl_.header_;
   return p != nullptr ? *p : reinterpret_cast<const ::oram_impl::RequestHeader&>(
       ::oram_impl::_RequestHeader_default_instance_);
 }
-inline const ::oram_impl::RequestHeader& ReadSqrtRequest::header() const {
-  // @@protoc_insertion_point(field_get:oram_impl.ReadSqrtRequest.header)
+inline const ::oram_impl::RequestHeader& ReadSlotsRequest::header() const {
+  // @@protoc_insertion_point(field_get:oram_impl.ReadSlotsRequest.header)
   return _internal_header();
 }
-inline void ReadSqrtRequest::unsafe_arena_set_allocated_header(
+inline void ReadSlotsRequest::unsafe_arena_set_allocated_header(
     ::oram_impl::RequestHeader* header) {
   if (GetArenaForAllocation() == nullptr) {
     delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.header_);
@@ -5178,9 +7952,9 @@ inline void ReadSqrtRequest::unsafe_arena_set_allocated_header(
   } else {
     
   }
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:oram_impl.ReadSqrtRequest.header)
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:oram_impl.ReadSlotsRequest.header)
 }
-inline ::oram_impl::RequestHeader* ReadSqrtRequest::release_header() {
+inline ::oram_impl::RequestHeader* ReadSlotsRequest::release_header() {
   
   ::oram_impl::RequestHeader* temp = _impl_.header_;
   _impl_.header_ = nullptr;
@@ -5195,14 +7969,14 @@ inline ::oram_impl::RequestHeader* ReadSqrtRequest::release_header() {
 #endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
   return temp;
 }
-inline ::oram_impl::RequestHeader* ReadSqrtRequest::unsafe_arena_release_header() {
-  // @@protoc_insertion_point(field_release:oram_impl.ReadSqrtRequest.header)
+inline ::oram_impl::RequestHeader* ReadSlotsRequest::unsafe_arena_release_header() {
+  // @@protoc_insertion_point(field_release:oram_impl.ReadSlotsRequest.header)
   
   ::oram_impl::RequestHeader* temp = _impl_.header_;
   _impl_.header_ = nullptr;
   return temp;
 }
-inline ::oram_impl::RequestHeader* ReadSqrtRequest::_internal_mutable_header() {
+inline ::oram_impl::RequestHeader* ReadSlotsRequest::_internal_mutable_header() {
   
   if (_impl_.header_ == nullptr) {
     auto* p = CreateMaybeMessage<::oram_impl::RequestHeader>(GetArenaForAllocation());
@@ -5210,12 +7984,12 @@ inline ::oram_impl::RequestHeader* ReadSqrtRequest::_internal_mutable_header() {
   }
   return _impl_.header_;
 }
-inline ::oram_impl::RequestHeader* ReadSqrtRequest::mutable_header() {
+inline ::oram_impl::RequestHeader* ReadSlotsRequest::mutable_header() {
   ::oram_impl::RequestHeader* _msg = _internal_mutable_header();
-  // @@protoc_insertion_point(field_mutable:oram_impl.ReadSqrtRequest.header)
+  // @@protoc_insertion_point(field_mutable:oram_impl.ReadSlotsRequest.header)
   return _msg;
 }
-inline void ReadSqrtRequest::set_allocated_header(::oram_impl::RequestHeader* header) {
+inline void ReadSlotsRequest::set_allocated_header(::oram_impl::RequestHeader* header) {
   ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
   if (message_arena == nullptr) {
     delete _impl_.header_;
@@ -5232,76 +8006,96 @@ inline void ReadSqrtRequest::set_allocated_header(::oram_impl::RequestHeader* he
     
   }
   _impl_.header_ = header;
-  // @@protoc_insertion_point(field_set_allocated:oram_impl.ReadSqrtRequest.header)
+  // @@protoc_insertion_point(field_set_allocated:oram_impl.ReadSlotsRequest.header)
 }
 
-// uint32 tag = 2;
-inline void ReadSqrtRequest::clear_tag() {
-  _impl_.tag_ = 0u;
+// uint32 path = 2;
+inline void ReadSlotsRequest::clear_path() {
+  _impl_.path_ = 0u;
 }
-inline uint32_t ReadSqrtRequest::_internal_tag() const {
-  return _impl_.tag_;
+inline uint32_t ReadSlotsRequest::_internal_path() const {
+  return _impl_.path_;
 }
-inline uint32_t ReadSqrtRequest::tag() const {
-  // @@protoc_insertion_point(field_get:oram_impl.ReadSqrtRequest.tag)
-  return _internal_tag();
+inline uint32_t ReadSlotsRequest::path() const {
+  // @@protoc_insertion_point(field_get:oram_impl.ReadSlotsRequest.path)
+  return _internal_path();
 }
-inline void ReadSqrtRequest::_internal_set_tag(uint32_t value) {
+inline void ReadSlotsRequest::_internal_set_path(uint32_t value) {
   
-  _impl_.tag_ = value;
+  _impl_.path_ = value;
 }
-inline void ReadSqrtRequest::set_tag(uint32_t value) {
-  _internal_set_tag(value);
-  // @@protoc_insertion_point(field_set:oram_impl.ReadSqrtRequest.tag)
+inline void ReadSlotsRequest::set_path(uint32_t value) {
+  _internal_set_path(value);
+  // @@protoc_insertion_point(field_set:oram_impl.ReadSlotsRequest.path)
 }
 
-// uint32 read_from = 3;
-inline void ReadSqrtRequest::clear_read_from() {
-  _impl_.read_from_ = 0u;
+// repeated .oram_impl.SlotListMessage slots = 3;
+inline int ReadSlotsRequest::_internal_slots_size() const {
+  return _impl_.slots_.size();
 }
-inline uint32_t ReadSqrtRequest::_internal_read_from() const {
-  return _impl_.read_from_;
+inline int ReadSlotsRequest::slots_size() const {
+  return _internal_slots_size();
 }
-inline uint32_t ReadSqrtRequest::read_from() const {
-  // @@protoc_insertion_point(field_get:oram_impl.ReadSqrtRequest.read_from)
-  return _internal_read_from();
+inline void ReadSlotsRequest::clear_slots() {
+  _impl_.slots_.Clear();
 }
-inline void ReadSqrtRequest::_internal_set_read_from(uint32_t value) {
-  
-  _impl_.read_from_ = value;
+inline ::oram_impl::SlotListMessage* ReadSlotsRequest::mutable_slots(int index) {
+  // @@protoc_insertion_point(field_mutable:oram_impl.ReadSlotsRequest.slots)
+  return _impl_.slots_.Mutable(index);
 }
-inline void ReadSqrtRequest::set_read_from(uint32_t value) {
-  _internal_set_read_from(value);
-  // @@protoc_insertion_point(field_set:oram_impl.ReadSqrtRequest.read_from)
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::oram_impl::SlotListMessage >*
+ReadSlotsRequest::mutable_slots() {
+  // @@protoc_insertion_point(field_mutable_list:oram_impl.ReadSlotsRequest.slots)
+  return &_impl_.slots_;
+}
+inline const ::oram_impl::SlotListMessage& ReadSlotsRequest::_internal_slots(int index) const {
+  return _impl_.slots_.Get(index);
+}
+inline const ::oram_impl::SlotListMessage& ReadSlotsRequest::slots(int index) const {
+  // @@protoc_insertion_point(field_get:oram_impl.ReadSlotsRequest.slots)
+  return _internal_slots(index);
+}
+inline ::oram_impl::SlotListMessage* ReadSlotsRequest::_internal_add_slots() {
+  return _impl_.slots_.Add();
+}
+inline ::oram_impl::SlotListMessage* ReadSlotsRequest::add_slots() {
+  ::oram_impl::SlotListMessage* _add = _internal_add_slots();
+  // @@protoc_insertion_point(field_add:oram_impl.ReadSlotsRequest.slots)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::oram_impl::SlotListMessage >&
+ReadSlotsRequest::slots() const {
+  // @@protoc_insertion_point(field_list:oram_impl.ReadSlotsRequest.slots)
+  return _impl_.slots_;
 }
 
 // -------------------------------------------------------------------
 
-// ReadPathRequest
+// WriteSlotsRequest
 
 // .oram_impl.RequestHeader header = 1;
-inline bool ReadPathRequest::_internal_has_header() const {
+inline bool WriteSlotsRequest::_internal_has_header() const {
   return this != internal_default_instance() && _impl_.header_ != nullptr;
 }
-inline bool ReadPathRequest::has_header() const {
+inline bool WriteSlotsRequest::has_header() const {
   return _internal_has_header();
 }
-inline void ReadPathRequest::clear_header() {
+inline void WriteSlotsRequest::clear_header() {
   if (GetArenaForAllocation() == nullptr && _impl_.header_ != nullptr) {
     delete _impl_.header_;
   }
   _impl_.header_ = nullptr;
 }
-inline const ::oram_impl::RequestHeader& ReadPathRequest::_internal_header() const {
+inline const ::oram_impl::RequestHeader& WriteSlotsRequest::_internal_header() const {
   const ::oram_impl::RequestHeader* p = _impl_.header_;
   return p != nullptr ? *p : reinterpret_cast<const ::oram_impl::RequestHeader&>(
       ::oram_impl::_RequestHeader_default_instance_);
 }
-inline const ::oram_impl::RequestHeader& ReadPathRequest::header() const {
-  // @@protoc_insertion_point(field_get:oram_impl.ReadPathRequest.header)
+inline const ::oram_impl::RequestHeader& WriteSlotsRequest::header() const {
+  // @@protoc_insertion_point(field_get:oram_impl.WriteSlotsRequest.header)
   return _internal_header();
 }
-inline void ReadPathRequest::unsafe_arena_set_allocated_header(
+inline void WriteSlotsRequest::unsafe_arena_set_allocated_header(
     ::oram_impl::RequestHeader* header) {
   if (GetArenaForAllocation() == nullptr) {
     delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.header_);
@@ -5312,9 +8106,9 @@ inline void ReadPathRequest::unsafe_arena_set_allocated_header(
   } else {
     
   }
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:oram_impl.ReadPathRequest.header)
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:oram_impl.WriteSlotsRequest.header)
 }
-inline ::oram_impl::RequestHeader* ReadPathRequest::release_header() {
+inline ::oram_impl::RequestHeader* WriteSlotsRequest::release_header() {
   
   ::oram_impl::RequestHeader* temp = _impl_.header_;
   _impl_.header_ = nullptr;
@@ -5329,14 +8123,14 @@ inline ::oram_impl::RequestHeader* ReadPathRequest::release_header() {
 #endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
   return temp;
 }
-inline ::oram_impl::RequestHeader* ReadPathRequest::unsafe_arena_release_header() {
-  // @@protoc_insertion_point(field_release:oram_impl.ReadPathRequest.header)
+inline ::oram_impl::RequestHeader* WriteSlotsRequest::unsafe_arena_release_header() {
+  // @@protoc_insertion_point(field_release:oram_impl.WriteSlotsRequest.header)
   
   ::oram_impl::RequestHeader* temp = _impl_.header_;
   _impl_.header_ = nullptr;
   return temp;
 }
-inline ::oram_impl::RequestHeader* ReadPathRequest::_internal_mutable_header() {
+inline ::oram_impl::RequestHeader* WriteSlotsRequest::_internal_mutable_header() {
   
   if (_impl_.header_ == nullptr) {
     auto* p = CreateMaybeMessage<::oram_impl::RequestHeader>(GetArenaForAllocation());
@@ -5344,12 +8138,12 @@ inline ::oram_impl::RequestHeader* ReadPathRequest::_internal_mutable_header() {
   }
   return _impl_.header_;
 }
-inline ::oram_impl::RequestHeader* ReadPathRequest::mutable_header() {
+inline ::oram_impl::RequestHeader* WriteSlotsRequest::mutable_header() {
   ::oram_impl::RequestHeader* _msg = _internal_mutable_header();
-  // @@protoc_insertion_point(field_mutable:oram_impl.ReadPathRequest.header)
+  // @@protoc_insertion_point(field_mutable:oram_impl.WriteSlotsRequest.header)
   return _msg;
 }
-inline void ReadPathRequest::set_allocated_header(::oram_impl::RequestHeader* header) {
+inline void WriteSlotsRequest::set_allocated_header(::oram_impl::RequestHeader* header) {
   ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
   if (message_arena == nullptr) {
     delete _impl_.header_;
@@ -5366,155 +8160,255 @@ inline void ReadPathRequest::set_allocated_header(::oram_impl::RequestHeader* he
     
   }
   _impl_.header_ = header;
-  // @@protoc_insertion_point(field_set_allocated:oram_impl.ReadPathRequest.header)
+  // @@protoc_insertion_point(field_set_allocated:oram_impl.WriteSlotsRequest.header)
 }
 
 // uint32 path = 2;
-inline void ReadPathRequest::clear_path() {
+inline void WriteSlotsRequest::clear_path() {
   _impl_.path_ = 0u;
 }
-inline uint32_t ReadPathRequest::_internal_path() const {
+inline uint32_t WriteSlotsRequest::_internal_path() const {
   return _impl_.path_;
 }
-inline uint32_t ReadPathRequest::path() const {
-  // @@protoc_insertion_point(field_get:oram_impl.ReadPathRequest.path)
+inline uint32_t WriteSlotsRequest::path() const {
+  // @@protoc_insertion_point(field_get:oram_impl.WriteSlotsRequest.path)
   return _internal_path();
 }
-inline void ReadPathRequest::_internal_set_path(uint32_t value) {
+inline void WriteSlotsRequest::_internal_set_path(uint32_t value) {
   
   _impl_.path_ = value;
 }
-inline void ReadPathRequest::set_path(uint32_t value) {
+inline void WriteSlotsRequest::set_path(uint32_t value) {
   _internal_set_path(value);
-  // @@protoc_insertion_point(field_set:oram_impl.ReadPathRequest.path)
+  // @@protoc_insertion_point(field_set:oram_impl.WriteSlotsRequest.path)
 }
 
-// uint32 level = 3;
-inline void ReadPathRequest::clear_level() {
+// repeated .oram_impl.SlotListMessage slots = 3;
+inline int WriteSlotsRequest::_internal_slots_size() const {
+  return _impl_.slots_.size();
+}
+inline int WriteSlotsRequest::slots_size() const {
+  return _internal_slots_size();
+}
+inline void WriteSlotsRequest::clear_slots() {
+  _impl_.slots_.Clear();
+}
+inline ::oram_impl::SlotListMessage* WriteSlotsRequest::mutable_slots(int index) {
+  // @@protoc_insertion_point(field_mutable:oram_impl.WriteSlotsRequest.slots)
+  return _impl_.slots_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::oram_impl::SlotListMessage >*
+WriteSlotsRequest::mutable_slots() {
+  // @@protoc_insertion_point(field_mutable_list:oram_impl.WriteSlotsRequest.slots)
+  return &_impl_.slots_;
+}
+inline const ::oram_impl::SlotListMessage& WriteSlotsRequest::_internal_slots(int index) const {
+  return _impl_.slots_.Get(index);
+}
+inline const ::oram_impl::SlotListMessage& WriteSlotsRequest::slots(int index) const {
+  // @@protoc_insertion_point(field_get:oram_impl.WriteSlotsRequest.slots)
+  return _internal_slots(index);
+}
+inline ::oram_impl::SlotListMessage* WriteSlotsRequest::_internal_add_slots() {
+  return _impl_.slots_.Add();
+}
+inline ::oram_impl::SlotListMessage* WriteSlotsRequest::add_slots() {
+  ::oram_impl::SlotListMessage* _add = _internal_add_slots();
+  // @@protoc_insertion_point(field_add:oram_impl.WriteSlotsRequest.slots)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::oram_impl::SlotListMessage >&
+WriteSlotsRequest::slots() const {
+  // @@protoc_insertion_point(field_list:oram_impl.WriteSlotsRequest.slots)
+  return _impl_.slots_;
+}
+
+// repeated .oram_impl.BucketMessage buckets = 4;
+inline int WriteSlotsRequest::_internal_buckets_size() const {
+  return _impl_.buckets_.size();
+}
+inline int WriteSlotsRequest::buckets_size() const {
+  return _internal_buckets_size();
+}
+inline void WriteSlotsRequest::clear_buckets() {
+  _impl_.buckets_.Clear();
+}
+inline ::oram_impl::BucketMessage* WriteSlotsRequest::mutable_buckets(int index) {
+  // @@protoc_insertion_point(field_mutable:oram_impl.WriteSlotsRequest.buckets)
+  return _impl_.buckets_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::oram_impl::BucketMessage >*
+WriteSlotsRequest::mutable_buckets() {
+  // @@protoc_insertion_point(field_mutable_list:oram_impl.WriteSlotsRequest.buckets)
+  return &_impl_.buckets_;
+}
+inline const ::oram_impl::BucketMessage& WriteSlotsRequest::_internal_buckets(int index) const {
+  return _impl_.buckets_.Get(index);
+}
+inline const ::oram_impl::BucketMessage& WriteSlotsRequest::buckets(int index) const {
+  // @@protoc_insertion_point(field_get:oram_impl.WriteSlotsRequest.buckets)
+  return _internal_buckets(index);
+}
+inline ::oram_impl::BucketMessage* WriteSlotsRequest::_internal_add_buckets() {
+  return _impl_.buckets_.Add();
+}
+inline ::oram_impl::BucketMessage* WriteSlotsRequest::add_buckets() {
+  ::oram_impl::BucketMessage* _add = _internal_add_buckets();
+  // @@protoc_insertion_point(field_add:oram_impl.WriteSlotsRequest.buckets)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::oram_impl::BucketMessage >&
+WriteSlotsRequest::buckets() const {
+  // @@protoc_insertion_point(field_list:oram_impl.WriteSlotsRequest.buckets)
+  return _impl_.buckets_;
+}
+
+// -------------------------------------------------------------------
+
+// BulkLoadBucketMessage
+
+// uint32 level = 1;
+inline void BulkLoadBucketMessage::clear_level() {
   _impl_.level_ = 0u;
 }
-inline uint32_t ReadPathRequest::_internal_level() const {
+inline uint32_t BulkLoadBucketMessage::_internal_level() const {
   return _impl_.level_;
 }
-inline uint32_t ReadPathRequest::level() const {
-  // @@protoc_insertion_point(field_get:oram_impl.ReadPathRequest.level)
+inline uint32_t BulkLoadBucketMessage::level() const {
+  // @@protoc_insertion_point(field_get:oram_impl.BulkLoadBucketMessage.level)
   return _internal_level();
 }
-inline void ReadPathRequest::_internal_set_level(uint32_t value) {
+inline void BulkLoadBucketMessage::_internal_set_level(uint32_t value) {
   
   _impl_.level_ = value;
 }
-inline void ReadPathRequest::set_level(uint32_t value) {
+inline void BulkLoadBucketMessage::set_level(uint32_t value) {
   _internal_set_level(value);
-  // @@protoc_insertion_point(field_set:oram_impl.ReadPathRequest.level)
+  // @@protoc_insertion_point(field_set:oram_impl.BulkLoadBucketMessage.level)
 }
 
-// -------------------------------------------------------------------
-
-// ReadPathResponse
+// uint32 offset = 2;
+inline void BulkLoadBucketMessage::clear_offset() {
+  _impl_.offset_ = 0u;
+}
+inline uint32_t BulkLoadBucketMessage::_internal_offset() const {
+  return _impl_.offset_;
+}
+inline uint32_t BulkLoadBucketMessage::offset() const {
+  // @@protoc_insertion_point(field_get:oram_impl.BulkLoadBucketMessage.offset)
+  return _internal_offset();
+}
+inline void BulkLoadBucketMessage::_internal_set_offset(uint32_t value) {
+  
+  _impl_.offset_ = value;
+}
+inline void BulkLoadBucketMessage::set_offset(uint32_t value) {
+  _internal_set_offset(value);
+  // @@protoc_insertion_point(field_set:oram_impl.BulkLoadBucketMessage.offset)
+}
 
-// repeated bytes bucket = 1;
-inline int ReadPathResponse::_internal_bucket_size() const {
+// repeated bytes bucket = 3;
+inline int BulkLoadBucketMessage::_internal_bucket_size() const {
   return _impl_.bucket_.size();
 }
-inline int ReadPathResponse::bucket_size() const {
+inline int BulkLoadBucketMessage::bucket_size() const {
   return _internal_bucket_size();
 }
-inline void ReadPathResponse::clear_bucket() {
+inline void BulkLoadBucketMessage::clear_bucket() {
   _impl_.bucket_.Clear();
 }
-inline std::string* ReadPathResponse::add_bucket() {
+inline std::string* BulkLoadBucketMessage::add_bucket() {
   std::string* _s = _internal_add_bucket();
-  // @@protoc_insertion_point(field_add_mutable:oram_impl.ReadPathResponse.bucket)
+  // @@protoc_insertion_point(field_add_mutable:oram_impl.BulkLoadBucketMessage.bucket)
   return _s;
 }
-inline const std::string& ReadPathResponse::_internal_bucket(int index) const {
+inline const std::string& BulkLoadBucketMessage::_internal_bucket(int index) const {
   return _impl_.bucket_.Get(index);
 }
-inline const std::string& ReadPathResponse::bucket(int index) const {
-  // @@protoc_insertion_point(field_get:oram_impl.ReadPathResponse.bucket)
+inline const std::string& BulkLoadBucketMessage::bucket(int index) const {
+  // @@protoc_insertion_point(field_get:oram_impl.BulkLoadBucketMessage.bucket)
   return _internal_bucket(index);
 }
-inline std::string* ReadPathResponse::mutable_bucket(int index) {
-  // @@protoc_insertion_point(field_mutable:oram_impl.ReadPathResponse.bucket)
+inline std::string* BulkLoadBucketMessage::mutable_bucket(int index) {
+  // @@protoc_insertion_point(field_mutable:oram_impl.BulkLoadBucketMessage.bucket)
   return _impl_.bucket_.Mutable(index);
 }
-inline void ReadPathResponse::set_bucket(int index, const std::string& value) {
+inline void BulkLoadBucketMessage::set_bucket(int index, const std::string& value) {
   _impl_.bucket_.Mutable(index)->assign(value);
-  // @@protoc_insertion_point(field_set:oram_impl.ReadPathResponse.bucket)
+  // @@protoc_insertion_point(field_set:oram_impl.BulkLoadBucketMessage.bucket)
 }
-inline void ReadPathResponse::set_bucket(int index, std::string&& value) {
+inline void BulkLoadBucketMessage::set_bucket(int index, std::string&& value) {
   _impl_.bucket_.Mutable(index)->assign(std::move(value));
-  // @@protoc_insertion_point(field_set:oram_impl.ReadPathResponse.bucket)
+  // @@protoc_insertion_point(field_set:oram_impl.BulkLoadBucketMessage.bucket)
 }
-inline void ReadPathResponse::set_bucket(int index, const char* value) {
+inline void BulkLoadBucketMessage::set_bucket(int index, const char* value) {
   GOOGLE_DCHECK(value != nullptr);
   _impl_.bucket_.Mutable(index)->assign(value);
-  // @@protoc_insertion_point(field_set_char:oram_impl.ReadPathResponse.bucket)
+  // @@protoc_insertion_point(field_set_char:oram_impl.BulkLoadBucketMessage.bucket)
 }
-inline void ReadPathResponse::set_bucket(int index, const void* value, size_t size) {
+inline void BulkLoadBucketMessage::set_bucket(int index, const void* value, size_t size) {
   _impl_.bucket_.Mutable(index)->assign(
     reinterpret_cast<const char*>(value), size);
-  // @@protoc_insertion_point(field_set_pointer:oram_impl.ReadPathResponse.bucket)
+  // @@protoc_insertion_point(field_set_pointer:oram_impl.BulkLoadBucketMessage.bucket)
 }
-inline std::string* ReadPathResponse::_internal_add_bucket() {
+inline std::string* BulkLoadBucketMessage::_internal_add_bucket() {
   return _impl_.bucket_.Add();
 }
-inline void ReadPathResponse::add_bucket(const std::string& value) {
+inline void BulkLoadBucketMessage::add_bucket(const std::string& value) {
   _impl_.bucket_.Add()->assign(value);
-  // @@protoc_insertion_point(field_add:oram_impl.ReadPathResponse.bucket)
+  // @@protoc_insertion_point(field_add:oram_impl.BulkLoadBucketMessage.bucket)
 }
-inline void ReadPathResponse::add_bucket(std::string&& value) {
+inline void BulkLoadBucketMessage::add_bucket(std::string&& value) {
   _impl_.bucket_.Add(std::move(value));
-  // @@protoc_insertion_point(field_add:oram_impl.ReadPathResponse.bucket)
+  // @@protoc_insertion_point(field_add:oram_impl.BulkLoadBucketMessage.bucket)
 }
-inline void ReadPathResponse::add_bucket(const char* value) {
+inline void BulkLoadBucketMessage::add_bucket(const char* value) {
   GOOGLE_DCHECK(value != nullptr);
   _impl_.bucket_.Add()->assign(value);
-  // @@protoc_insertion_point(field_add_char:oram_impl.ReadPathResponse.bucket)
+  // @@protoc_insertion_point(field_add_char:oram_impl.BulkLoadBucketMessage.bucket)
 }
-inline void ReadPathResponse::add_bucket(const void* value, size_t size) {
+inline void BulkLoadBucketMessage::add_bucket(const void* value, size_t size) {
   _impl_.bucket_.Add()->assign(reinterpret_cast<const char*>(value), size);
-  // @@protoc_insertion_point(field_add_pointer:oram_impl.ReadPathResponse.bucket)
+  // @@protoc_insertion_point(field_add_pointer:oram_impl.BulkLoadBucketMessage.bucket)
 }
 inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
-ReadPathResponse::bucket() const {
-  // @@protoc_insertion_point(field_list:oram_impl.ReadPathResponse.bucket)
+BulkLoadBucketMessage::bucket() const {
+  // @@protoc_insertion_point(field_list:oram_impl.BulkLoadBucketMessage.bucket)
   return _impl_.bucket_;
 }
 inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
-ReadPathResponse::mutable_bucket() {
-  // @@protoc_insertion_point(field_mutable_list:oram_impl.ReadPathResponse.bucket)
+BulkLoadBucketMessage::mutable_bucket() {
+  // @@protoc_insertion_point(field_mutable_list:oram_impl.BulkLoadBucketMessage.bucket)
   return &_impl_.bucket_;
 }
 
 // -------------------------------------------------------------------
 
-// WritePathRequest
+// BulkLoadRequest
 
 // .oram_impl.RequestHeader header = 1;
-inline bool WritePathRequest::_internal_has_header() const {
+inline bool BulkLoadRequest::_internal_has_header() const {
   return this != internal_default_instance() && _impl_.header_ != nullptr;
 }
-inline bool WritePathRequest::has_header() const {
+inline bool BulkLoadRequest::has_header() const {
   return _internal_has_header();
 }
-inline void WritePathRequest::clear_header() {
+inline void BulkLoadRequest::clear_header() {
   if (GetArenaForAllocation() == nullptr && _impl_.header_ != nullptr) {
     delete _impl_.header_;
   }
   _impl_.header_ = nullptr;
 }
-inline const ::oram_impl::RequestHeader& WritePathRequest::_internal_header() const {
+inline const ::oram_impl::RequestHeader& BulkLoadRequest::_internal_header() const {
   const ::oram_impl::RequestHeader* p = _impl_.header_;
   return p != nullptr ? *p : reinterpret_cast<const ::oram_impl::RequestHeader&>(
       ::oram_impl::_RequestHeader_default_instance_);
 }
-inline const ::oram_impl::RequestHeader& WritePathRequest::header() const {
-  // @@protoc_insertion_point(field_get:oram_impl.WritePathRequest.header)
+inline const ::oram_impl::RequestHeader& BulkLoadRequest::header() const {
+  // @@protoc_insertion_point(field_get:oram_impl.BulkLoadRequest.header)
   return _internal_header();
 }
-inline void WritePathRequest::unsafe_arena_set_allocated_header(
+inline void BulkLoadRequest::unsafe_arena_set_allocated_header(
     ::oram_impl::RequestHeader* header) {
   if (GetArenaForAllocation() == nullptr) {
     delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.header_);
@@ -5525,9 +8419,9 @@ inline void WritePathRequest::unsafe_arena_set_allocated_header(
   } else {
     
   }
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:oram_impl.WritePathRequest.header)
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:oram_impl.BulkLoadRequest.header)
 }
-inline ::oram_impl::RequestHeader* WritePathRequest::release_header() {
+inline ::oram_impl::RequestHeader* BulkLoadRequest::release_header() {
   
   ::oram_impl::RequestHeader* temp = _impl_.header_;
   _impl_.header_ = nullptr;
@@ -5542,14 +8436,14 @@ inline ::oram_impl::RequestHeader* WritePathRequest::release_header() {
 #endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
   return temp;
 }
-inline ::oram_impl::RequestHeader* WritePathRequest::unsafe_arena_release_header() {
-  // @@protoc_insertion_point(field_release:oram_impl.WritePathRequest.header)
+inline ::oram_impl::RequestHeader* BulkLoadRequest::unsafe_arena_release_header() {
+  // @@protoc_insertion_point(field_release:oram_impl.BulkLoadRequest.header)
   
   ::oram_impl::RequestHeader* temp = _impl_.header_;
   _impl_.header_ = nullptr;
   return temp;
 }
-inline ::oram_impl::RequestHeader* WritePathRequest::_internal_mutable_header() {
+inline ::oram_impl::RequestHeader* BulkLoadRequest::_internal_mutable_header() {
   
   if (_impl_.header_ == nullptr) {
     auto* p = CreateMaybeMessage<::oram_impl::RequestHeader>(GetArenaForAllocation());
@@ -5557,12 +8451,12 @@ inline ::oram_impl::RequestHeader* WritePathRequest::_internal_mutable_header()
   }
   return _impl_.header_;
 }
-inline ::oram_impl::RequestHeader* WritePathRequest::mutable_header() {
+inline ::oram_impl::RequestHeader* BulkLoadRequest::mutable_header() {
   ::oram_impl::RequestHeader* _msg = _internal_mutable_header();
-  // @@protoc_insertion_point(field_mutable:oram_impl.WritePathRequest.header)
+  // @@protoc_insertion_point(field_mutable:oram_impl.BulkLoadRequest.header)
   return _msg;
 }
-inline void WritePathRequest::set_allocated_header(::oram_impl::RequestHeader* header) {
+inline void BulkLoadRequest::set_allocated_header(::oram_impl::RequestHeader* header) {
   ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
   if (message_arena == nullptr) {
     delete _impl_.header_;
@@ -5579,178 +8473,122 @@ inline void WritePathRequest::set_allocated_header(::oram_impl::RequestHeader* h
     
   }
   _impl_.header_ = header;
-  // @@protoc_insertion_point(field_set_allocated:oram_impl.WritePathRequest.header)
+  // @@protoc_insertion_point(field_set_allocated:oram_impl.BulkLoadRequest.header)
 }
 
-// uint32 path = 2;
-inline void WritePathRequest::clear_path() {
-  _impl_.path_ = 0u;
+// repeated .oram_impl.BulkLoadBucketMessage buckets = 2;
+inline int BulkLoadRequest::_internal_buckets_size() const {
+  return _impl_.buckets_.size();
 }
-inline uint32_t WritePathRequest::_internal_path() const {
-  return _impl_.path_;
+inline int BulkLoadRequest::buckets_size() const {
+  return _internal_buckets_size();
 }
-inline uint32_t WritePathRequest::path() const {
-  // @@protoc_insertion_point(field_get:oram_impl.WritePathRequest.path)
-  return _internal_path();
+inline void BulkLoadRequest::clear_buckets() {
+  _impl_.buckets_.Clear();
 }
-inline void WritePathRequest::_internal_set_path(uint32_t value) {
-  
-  _impl_.path_ = value;
+inline ::oram_impl::BulkLoadBucketMessage* BulkLoadRequest::mutable_buckets(int index) {
+  // @@protoc_insertion_point(field_mutable:oram_impl.BulkLoadRequest.buckets)
+  return _impl_.buckets_.Mutable(index);
 }
-inline void WritePathRequest::set_path(uint32_t value) {
-  _internal_set_path(value);
-  // @@protoc_insertion_point(field_set:oram_impl.WritePathRequest.path)
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::oram_impl::BulkLoadBucketMessage >*
+BulkLoadRequest::mutable_buckets() {
+  // @@protoc_insertion_point(field_mutable_list:oram_impl.BulkLoadRequest.buckets)
+  return &_impl_.buckets_;
 }
-
-// uint32 level = 3;
-inline void WritePathRequest::clear_level() {
-  _impl_.level_ = 0u;
+inline const ::oram_impl::BulkLoadBucketMessage& BulkLoadRequest::_internal_buckets(int index) const {
+  return _impl_.buckets_.Get(index);
 }
-inline uint32_t WritePathRequest::_internal_level() const {
-  return _impl_.level_;
+inline const ::oram_impl::BulkLoadBucketMessage& BulkLoadRequest::buckets(int index) const {
+  // @@protoc_insertion_point(field_get:oram_impl.BulkLoadRequest.buckets)
+  return _internal_buckets(index);
 }
-inline uint32_t WritePathRequest::level() const {
-  // @@protoc_insertion_point(field_get:oram_impl.WritePathRequest.level)
-  return _internal_level();
+inline ::oram_impl::BulkLoadBucketMessage* BulkLoadRequest::_internal_add_buckets() {
+  return _impl_.buckets_.Add();
 }
-inline void WritePathRequest::_internal_set_level(uint32_t value) {
-  
-  _impl_.level_ = value;
+inline ::oram_impl::BulkLoadBucketMessage* BulkLoadRequest::add_buckets() {
+  ::oram_impl::BulkLoadBucketMessage* _add = _internal_add_buckets();
+  // @@protoc_insertion_point(field_add:oram_impl.BulkLoadRequest.buckets)
+  return _add;
 }
-inline void WritePathRequest::set_level(uint32_t value) {
-  _internal_set_level(value);
-  // @@protoc_insertion_point(field_set:oram_impl.WritePathRequest.level)
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::oram_impl::BulkLoadBucketMessage >&
+BulkLoadRequest::buckets() const {
+  // @@protoc_insertion_point(field_list:oram_impl.BulkLoadRequest.buckets)
+  return _impl_.buckets_;
 }
 
-// repeated bytes bucket = 4;
-inline int WritePathRequest::_internal_bucket_size() const {
-  return _impl_.bucket_.size();
+// repeated bytes blocks = 3;
+inline int BulkLoadRequest::_internal_blocks_size() const {
+  return _impl_.blocks_.size();
 }
-inline int WritePathRequest::bucket_size() const {
-  return _internal_bucket_size();
+inline int BulkLoadRequest::blocks_size() const {
+  return _internal_blocks_size();
 }
-inline void WritePathRequest::clear_bucket() {
-  _impl_.bucket_.Clear();
+inline void BulkLoadRequest::clear_blocks() {
+  _impl_.blocks_.Clear();
 }
-inline std::string* WritePathRequest::add_bucket() {
-  std::string* _s = _internal_add_bucket();
-  // @@protoc_insertion_point(field_add_mutable:oram_impl.WritePathRequest.bucket)
+inline std::string* BulkLoadRequest::add_blocks() {
+  std::string* _s = _internal_add_blocks();
+  // @@protoc_insertion_point(field_add_mutable:oram_impl.BulkLoadRequest.blocks)
   return _s;
 }
-inline const std::string& WritePathRequest::_internal_bucket(int index) const {
-  return _impl_.bucket_.Get(index);
+inline const std::string& BulkLoadRequest::_internal_blocks(int index) const {
+  return _impl_.blocks_.Get(index);
 }
-inline const std::string& WritePathRequest::bucket(int index) const {
-  // @@protoc_insertion_point(field_get:oram_impl.WritePathRequest.bucket)
-  return _internal_bucket(index);
+inline const std::string& BulkLoadRequest::blocks(int index) const {
+  // @@protoc_insertion_point(field_get:oram_impl.BulkLoadRequest.blocks)
+  return _internal_blocks(index);
 }
-inline std::string* WritePathRequest::mutable_bucket(int index) {
-  // @@protoc_insertion_point(field_mutable:oram_impl.WritePathRequest.bucket)
-  return _impl_.bucket_.Mutable(index);
+inline std::string* BulkLoadRequest::mutable_blocks(int index) {
+  // @@protoc_insertion_point(field_mutable:oram_impl.BulkLoadRequest.blocks)
+  return _impl_.blocks_.Mutable(index);
 }
-inline void WritePathRequest::set_bucket(int index, const std::string& value) {
-  _impl_.bucket_.Mutable(index)->assign(value);
-  // @@protoc_insertion_point(field_set:oram_impl.WritePathRequest.bucket)
+inline void BulkLoadRequest::set_blocks(int index, const std::string& value) {
+  _impl_.blocks_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set:oram_impl.BulkLoadRequest.blocks)
 }
-inline void WritePathRequest::set_bucket(int index, std::string&& value) {
-  _impl_.bucket_.Mutable(index)->assign(std::move(value));
-  // @@protoc_insertion_point(field_set:oram_impl.WritePathRequest.bucket)
+inline void BulkLoadRequest::set_blocks(int index, std::string&& value) {
+  _impl_.blocks_.Mutable(index)->assign(std::move(value));
+  // @@protoc_insertion_point(field_set:oram_impl.BulkLoadRequest.blocks)
 }
-inline void WritePathRequest::set_bucket(int index, const char* value) {
+inline void BulkLoadRequest::set_blocks(int index, const char* value) {
   GOOGLE_DCHECK(value != nullptr);
-  _impl_.bucket_.Mutable(index)->assign(value);
-  // @@protoc_insertion_point(field_set_char:oram_impl.WritePathRequest.bucket)
+  _impl_.blocks_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:oram_impl.BulkLoadRequest.blocks)
 }
-inline void WritePathRequest::set_bucket(int index, const void* value, size_t size) {
-  _impl_.bucket_.Mutable(index)->assign(
+inline void BulkLoadRequest::set_blocks(int index, const void* value, size_t size) {
+  _impl_.blocks_.Mutable(index)->assign(
     reinterpret_cast<const char*>(value), size);
-  // @@protoc_insertion_point(field_set_pointer:oram_impl.WritePathRequest.bucket)
+  // @@protoc_insertion_point(field_set_pointer:oram_impl.BulkLoadRequest.blocks)
 }
-inline std::string* WritePathRequest::_internal_add_bucket() {
-  return _impl_.bucket_.Add();
+inline std::string* BulkLoadRequest::_internal_add_blocks() {
+  return _impl_.blocks_.Add();
 }
-inline void WritePathRequest::add_bucket(const std::string& value) {
-  _impl_.bucket_.Add()->assign(value);
-  // @@protoc_insertion_point(field_add:oram_impl.WritePathRequest.bucket)
+inline void BulkLoadRequest::add_blocks(const std::string& value) {
+  _impl_.blocks_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:oram_impl.BulkLoadRequest.blocks)
 }
-inline void WritePathRequest::add_bucket(std::string&& value) {
-  _impl_.bucket_.Add(std::move(value));
-  // @@protoc_insertion_point(field_add:oram_impl.WritePathRequest.bucket)
+inline void BulkLoadRequest::add_blocks(std::string&& value) {
+  _impl_.blocks_.Add(std::move(value));
+  // @@protoc_insertion_point(field_add:oram_impl.BulkLoadRequest.blocks)
 }
-inline void WritePathRequest::add_bucket(const char* value) {
+inline void BulkLoadRequest::add_blocks(const char* value) {
   GOOGLE_DCHECK(value != nullptr);
-  _impl_.bucket_.Add()->assign(value);
-  // @@protoc_insertion_point(field_add_char:oram_impl.WritePathRequest.bucket)
+  _impl_.blocks_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:oram_impl.BulkLoadRequest.blocks)
 }
-inline void WritePathRequest::add_bucket(const void* value, size_t size) {
-  _impl_.bucket_.Add()->assign(reinterpret_cast<const char*>(value), size);
-  // @@protoc_insertion_point(field_add_pointer:oram_impl.WritePathRequest.bucket)
+inline void BulkLoadRequest::add_blocks(const void* value, size_t size) {
+  _impl_.blocks_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:oram_impl.BulkLoadRequest.blocks)
 }
 inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
-WritePathRequest::bucket() const {
-  // @@protoc_insertion_point(field_list:oram_impl.WritePathRequest.bucket)
-  return _impl_.bucket_;
+BulkLoadRequest::blocks() const {
+  // @@protoc_insertion_point(field_list:oram_impl.BulkLoadRequest.blocks)
+  return _impl_.blocks_;
 }
 inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
-WritePathRequest::mutable_bucket() {
-  // @@protoc_insertion_point(field_mutable_list:oram_impl.WritePathRequest.bucket)
-  return &_impl_.bucket_;
-}
-
-// optional .oram_impl.Type type = 5;
-inline bool WritePathRequest::_internal_has_type() const {
-  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
-  return value;
-}
-inline bool WritePathRequest::has_type() const {
-  return _internal_has_type();
-}
-inline void WritePathRequest::clear_type() {
-  _impl_.type_ = 0;
-  _impl_._has_bits_[0] &= ~0x00000001u;
-}
-inline ::oram_impl::Type WritePathRequest::_internal_type() const {
-  return static_cast< ::oram_impl::Type >(_impl_.type_);
-}
-inline ::oram_impl::Type WritePathRequest::type() const {
-  // @@protoc_insertion_point(field_get:oram_impl.WritePathRequest.type)
-  return _internal_type();
-}
-inline void WritePathRequest::_internal_set_type(::oram_impl::Type value) {
-  _impl_._has_bits_[0] |= 0x00000001u;
-  _impl_.type_ = value;
-}
-inline void WritePathRequest::set_type(::oram_impl::Type value) {
-  _internal_set_type(value);
-  // @@protoc_insertion_point(field_set:oram_impl.WritePathRequest.type)
-}
-
-// optional uint32 offset = 6;
-inline bool WritePathRequest::_internal_has_offset() const {
-  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
-  return value;
-}
-inline bool WritePathRequest::has_offset() const {
-  return _internal_has_offset();
-}
-inline void WritePathRequest::clear_offset() {
-  _impl_.offset_ = 0u;
-  _impl_._has_bits_[0] &= ~0x00000002u;
-}
-inline uint32_t WritePathRequest::_internal_offset() const {
-  return _impl_.offset_;
-}
-inline uint32_t WritePathRequest::offset() const {
-  // @@protoc_insertion_point(field_get:oram_impl.WritePathRequest.offset)
-  return _internal_offset();
-}
-inline void WritePathRequest::_internal_set_offset(uint32_t value) {
-  _impl_._has_bits_[0] |= 0x00000002u;
-  _impl_.offset_ = value;
-}
-inline void WritePathRequest::set_offset(uint32_t value) {
-  _internal_set_offset(value);
-  // @@protoc_insertion_point(field_set:oram_impl.WritePathRequest.offset)
+BulkLoadRequest::mutable_blocks() {
+  // @@protoc_insertion_point(field_mutable_list:oram_impl.BulkLoadRequest.blocks)
+  return &_impl_.blocks_;
 }
 
 // -------------------------------------------------------------------
@@ -5796,6 +8634,24 @@ inline void WritePathRequest::set_offset(uint32_t value) {
 
 // -------------------------------------------------------------------
 
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
 
 // @@protoc_insertion_point(namespace_scope)
 
@@ -18,6 +18,8 @@
 #define ORAM_IMPL_SERVER_BASE_ORAM_STORAGE_H_
 
 #include <cstdint>
+#include <shared_mutex>
+#include <string>
 
 #include "base/oram_defs.h"
 
@@ -34,6 +36,9 @@ class BaseOramServerStorage {
   const size_t block_size_;
   // The hash of the instance.
   const std::string instance_hash_;
+  // The requests that only read the storage share the lock, and the others
+  // hold it exclusively.
+  std::shared_mutex lock_;
 
  public:
   BaseOramServerStorage(uint32_t id, size_t capacity, size_t block_size,
@@ -53,6 +58,7 @@ class BaseOramServerStorage {
   virtual std::string GetInstanceHash(void) const { return instance_hash_; }
   virtual size_t GetBlockSize(void) const { return block_size_; }
   virtual float ReportStorage(void) const { return 0.0; }
+  std::shared_mutex& GetLock(void) { return lock_; }
 
   virtual ~BaseOramServerStorage() = 0;
 };
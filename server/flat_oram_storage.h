@@ -34,6 +34,7 @@ class FlatOramServerStorage : public BaseOramServerStorage {
   virtual void From(const server_flat_storage_t& storage) {
     storage_ = storage;
   }
+  virtual void Append(const std::string& block) { storage_.append(block); }
 };
 }  // namespace oram_impl
 
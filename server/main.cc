@@ -47,10 +47,19 @@ void handler(int sig) {
   exit(1);
 }
 
+// Asks the server to flush the memory-mapped storages to the disk.
+void sync_handler(int sig) { sync_requested = true; }
+
+// Asks the server to stop; the monitor thread then syncs the storages and
+// shuts the server down.
+void stop_handler(int sig) { server_running = false; }
+
 int main(int argc, char* argv[]) {
   signal(SIGSEGV, handler);
   signal(SIGABRT, handler);
-  signal(SIGINT, handler);
+  signal(SIGINT, stop_handler);
+  signal(SIGTERM, stop_handler);
+  signal(SIGUSR1, sync_handler);
 
   // Create a parser.
   oram_parse::YamlParser parser;
@@ -70,7 +79,7 @@ int main(int argc, char* argv[]) {
   std::unique_ptr<oram_impl::ServerRunner> server_runner =
       std::make_unique<oram_impl::ServerRunner>(
           config.server_address, config.server_port, config.key_path,
-          config.crt_path);
+          config.crt_path, config.storage_path, config.direct_io);
   server_runner->Run();
 
   return 0;
@@ -19,16 +19,86 @@
 #include <spdlog/fmt/bin_to_hex.h>
 
 #include <atomic>
+#include <filesystem>
 #include <thread>
 
 #include "base/oram_defs.h"
 #include "base/oram_utils.h"
 
 std::atomic_bool server_running;
+std::atomic_bool sync_requested;
 
 namespace oram_impl {
+std::shared_ptr<BaseOramServerStorage> OramService::GetStorage(uint32_t id) {
+  StorageShard& shard = ShardOf(id);
+  std::shared_lock<std::shared_mutex> lock(shard.lock);
+  auto iter = shard.storages.find(id);
+  return iter == shard.storages.end() ? nullptr : iter->second;
+}
+
+std::string OramService::StorageFileOf(uint32_t id) const {
+  return (std::filesystem::path(storage_path_) /
+          oram_utils::StrCat("tree-", id, ".oram"))
+      .string();
+}
+
+OramStatus OramService::AttachStorages(void) {
+  std::error_code error;
+  std::filesystem::create_directories(storage_path_, error);
+  if (error) {
+    return OramStatus(StatusCode::kFileIOError,
+                      oram_utils::StrCat("Cannot create ", storage_path_, ": ",
+                                         error.message()),
+                      __func__);
+  }
+
+  for (const auto& entry :
+       std::filesystem::directory_iterator(storage_path_, error)) {
+    if (entry.path().extension() != ".oram") {
+      continue;
+    }
+
+    // A file that cannot be attached is left alone.
+    std::unique_ptr<TreeOramServerStorage> storage;
+    OramStatus status =
+        TreeOramServerStorage::Attach(entry.path().string(), &storage);
+    if (!status.ok()) {
+      logger->warn("[!] {}", status.EmitString());
+      continue;
+    }
+
+    INFO(logger, "Tree ORAM attached from {}. ID = {}", entry.path().string(),
+         storage->GetId());
+    StorageShard& shard = ShardOf(storage->GetId());
+    std::unique_lock<std::shared_mutex> lock(shard.lock);
+    shard.storages[storage->GetId()] = std::move(storage);
+  }
+
+  return OramStatus::OK;
+}
+
+OramStatus OramService::SyncStorages(void) {
+  // Syncing leaves the content of a storage unchanged, so the storages are not
+  // locked themselves.
+  for (auto& shard : shards_) {
+    std::shared_lock<std::shared_mutex> lock(shard.lock);
+    for (const auto& storage : shard.storages) {
+      if (storage.second->GetOramStorageType() ==
+          OramStorageType::kTreeStorage) {
+        OramStatus status =
+            dynamic_cast<TreeOramServerStorage*>(storage.second.get())->Sync();
+        if (!status.ok()) {
+          return status;
+        }
+      }
+    }
+  }
+
+  return OramStatus::OK;
+}
+
 grpc::Status OramService::CheckInitRequest(uint32_t id) {
-  if (storages_.find(id) != storages_.end()) {
+  if (ShardOf(id).storages.count(id) != 0) {
     const std::string error_message =
         oram_utils::StrCat("ORAM id: ", id, " already exists.");
     return grpc::Status(grpc::StatusCode::ALREADY_EXISTS, error_message);
@@ -42,8 +112,9 @@ grpc::Status OramService::CheckInitRequest(uint32_t id) {
   return grpc::Status::OK;
 }
 
-grpc::Status OramService::CheckIdValid(uint32_t id) {
-  if (storages_.find(id) == storages_.end()) {
+grpc::Status OramService::CheckIdValid(
+    uint32_t id, std::shared_ptr<BaseOramServerStorage>* const storage) {
+  if ((*storage = GetStorage(id)) == nullptr) {
     const std::string error_message =
         oram_utils::StrCat("ORAM id: ", id, " does not exist.");
     return grpc::Status(grpc::StatusCode::NOT_FOUND, error_message);
@@ -64,15 +135,28 @@ grpc::Status OramService::InitTreeOram(grpc::ServerContext* context,
   const uint32_t bucket_num = request->bucket_num();
   const size_t block_size = request->block_size();
 
-  // Do check.
+  // The shard stays locked until the storage is registered, so that two
+  // requests for the same id cannot both create it.
+  StorageShard& shard = ShardOf(id);
+  std::unique_lock<std::shared_mutex> lock(shard.lock);
   grpc::Status status = CheckInitRequest(id);
   if (!status.ok()) {
     return status;
   }
 
-  // Create a new storage and initialize it.
-  storages_[id] = std::make_unique<TreeOramServerStorage>(
-      id, bucket_num, block_size, bucket_size, instance_hash);
+  std::unique_ptr<TreeOramServerStorage> storage;
+  if (storage_path_.empty()) {
+    storage = std::make_unique<TreeOramServerStorage>(
+        id, bucket_num, block_size, bucket_size, instance_hash);
+  } else {
+    OramStatus oram_status = TreeOramServerStorage::Create(
+        StorageFileOf(id), direct_io_, id, bucket_num, block_size, bucket_size,
+        instance_hash, &storage);
+    if (!oram_status.ok()) {
+      return grpc::Status(grpc::StatusCode::INTERNAL, oram_status.EmitString());
+    }
+  }
+  shard.storages[id] = std::move(storage);
 
   INFO(logger, "Tree ORAM successfully created. ID = {}", id);
 
@@ -92,13 +176,16 @@ grpc::Status OramService::InitFlatOram(grpc::ServerContext* context,
   const size_t block_size = request->block_size();
 
   // Do check.
+  StorageShard& shard = ShardOf(id);
+  std::unique_lock<std::shared_mutex> lock(shard.lock);
   grpc::Status status = CheckInitRequest(id);
   if (!status.ok()) {
     return status;
   }
 
-  storages_[id] = std::make_unique<FlatOramServerStorage>(
+  auto storage = std::make_unique<FlatOramServerStorage>(
       id, capacity, block_size, instance_hash);
+  shard.storages[id] = std::move(storage);
 
   INFO(logger, "Flat ORAM successfully created. ID = {}", id);
 
@@ -117,13 +204,16 @@ grpc::Status OramService::InitSqrtOram(grpc::ServerContext* context,
   const size_t block_size = request->block_size();
   const size_t squared_m = request->squared_m();
 
+  StorageShard& shard = ShardOf(id);
+  std::unique_lock<std::shared_mutex> lock(shard.lock);
   grpc::Status status = CheckInitRequest(id);
   if (!status.ok()) {
     return status;
   }
 
-  storages_[id] = std::make_unique<SqrtOramServerStorage>(
+  auto storage = std::make_unique<SqrtOramServerStorage>(
       id, capacity, block_size, squared_m, instance_hash);
+  shard.storages[id] = std::move(storage);
 
   INFO(logger, "Sqrt Oram successfully created. ID = {}", id);
 
@@ -139,17 +229,19 @@ grpc::Status OramService::ReadSqrtMemory(grpc::ServerContext* context,
   const uint32_t id = request->header().id();
   const std::string instance_hash = request->header().instance_hash();
 
+  std::shared_ptr<BaseOramServerStorage> oram_storage;
   grpc::Status status = grpc::Status::OK;
-  if (!(status = CheckIdValid(id)).ok()) {
+  if (!(status = CheckIdValid(id, &oram_storage)).ok()) {
     return status;
   }
 
   SqrtOramServerStorage* storage = nullptr;
-  status = CheckStorage(storages_[id].get(), instance_hash,
+  status = CheckStorage(oram_storage.get(), instance_hash,
                         OramStorageType::kSqrtStorage, storage);
   if (!status.ok()) {
     return status;
   }
+  std::unique_lock<std::shared_mutex> storage_lock(storage->GetLock());
 
   // Explanation:
   // 0 => shelter;
@@ -195,17 +287,19 @@ grpc::Status OramService::WriteSqrtMemory(grpc::ServerContext* context,
   const uint32_t id = request->header().id();
   const std::string instance_hash = request->header().instance_hash();
 
+  std::shared_ptr<BaseOramServerStorage> oram_storage;
   grpc::Status status = grpc::Status::OK;
-  if (!(status = CheckIdValid(id)).ok()) {
+  if (!(status = CheckIdValid(id, &oram_storage)).ok()) {
     return status;
   }
 
   SqrtOramServerStorage* storage = nullptr;
-  status = CheckStorage(storages_[id].get(), instance_hash,
+  status = CheckStorage(oram_storage.get(), instance_hash,
                         OramStorageType::kSqrtStorage, storage);
   if (!status.ok()) {
     return status;
   }
+  std::unique_lock<std::shared_mutex> storage_lock(storage->GetLock());
 
   const std::string content = request->content();
   const uint32_t tag = request->pos();
@@ -223,17 +317,19 @@ grpc::Status OramService::SqrtPermute(grpc::ServerContext* context,
   const uint32_t id = request->header().id();
   const std::string instance_hash = request->header().instance_hash();
 
+  std::shared_ptr<BaseOramServerStorage> oram_storage;
   grpc::Status status = grpc::Status::OK;
-  if (!(status = CheckIdValid(id)).ok()) {
+  if (!(status = CheckIdValid(id, &oram_storage)).ok()) {
     return status;
   }
 
   SqrtOramServerStorage* storage = nullptr;
-  status = CheckStorage(storages_[id].get(), instance_hash,
+  status = CheckStorage(oram_storage.get(), instance_hash,
                         OramStorageType::kSqrtStorage, storage);
   if (!status.ok()) {
     return status;
   }
+  std::unique_lock<std::shared_mutex> storage_lock(storage->GetLock());
 
   const std::vector<uint32_t> perm(request->perms().cbegin(),
                                    request->perms().cend());
@@ -251,17 +347,19 @@ grpc::Status OramService::LoadSqrtOram(grpc::ServerContext* context,
   const uint32_t id = request->header().id();
   const std::string instance_hash = request->header().instance_hash();
 
+  std::shared_ptr<BaseOramServerStorage> oram_storage;
   grpc::Status status = grpc::Status::OK;
-  if (!(status = CheckIdValid(id)).ok()) {
+  if (!(status = CheckIdValid(id, &oram_storage)).ok()) {
     return status;
   }
 
   SqrtOramServerStorage* storage = nullptr;
-  status = CheckStorage(storages_[id].get(), instance_hash,
+  status = CheckStorage(oram_storage.get(), instance_hash,
                         OramStorageType::kSqrtStorage, storage);
   if (!status.ok()) {
     return status;
   }
+  std::unique_lock<std::shared_mutex> storage_lock(storage->GetLock());
 
   const std::vector<std::string> content(request->contents().cbegin(),
                                          request->contents().cend());
@@ -271,6 +369,118 @@ grpc::Status OramService::LoadSqrtOram(grpc::ServerContext* context,
   return grpc::Status::OK;
 }
 
+grpc::Status OramService::LoadChunk(BaseOramServerStorage* const storage,
+                                    const BulkLoadRequest& chunk) {
+  const std::string instance_hash = chunk.header().instance_hash();
+  grpc::Status status = grpc::Status::OK;
+
+  switch (storage->GetOramStorageType()) {
+    case OramStorageType::kTreeStorage: {
+      TreeOramServerStorage* tree_storage = nullptr;
+      status = CheckStorage(storage, instance_hash,
+                            OramStorageType::kTreeStorage, tree_storage);
+      if (!status.ok()) {
+        return status;
+      }
+
+      for (const auto& message : chunk.buckets()) {
+        const p_oram_bucket_t bucket =
+            oram_utils::DeserializeFromStringVector(std::vector<std::string>(
+                message.bucket().begin(), message.bucket().end()));
+        OramStatus oram_status = tree_storage->AccurateWritePath(
+            message.level(), message.offset(), bucket, Type::kInit);
+        if (!oram_status.ok()) {
+          return grpc::Status(grpc::StatusCode::INTERNAL,
+                              oram_status.EmitString());
+        }
+      }
+      break;
+    }
+    case OramStorageType::kFlatStorage: {
+      FlatOramServerStorage* flat_storage = nullptr;
+      status = CheckStorage(storage, instance_hash,
+                            OramStorageType::kFlatStorage, flat_storage);
+      if (!status.ok()) {
+        return status;
+      }
+
+      for (const auto& block : chunk.blocks()) {
+        flat_storage->Append(block);
+      }
+      break;
+    }
+    case OramStorageType::kSqrtStorage: {
+      SqrtOramServerStorage* sqrt_storage = nullptr;
+      status = CheckStorage(storage, instance_hash,
+                            OramStorageType::kSqrtStorage, sqrt_storage);
+      if (!status.ok()) {
+        return status;
+      }
+
+      sqrt_storage->Fill(std::vector<std::string>(chunk.blocks().begin(),
+                                                  chunk.blocks().end()));
+      break;
+    }
+    default: {
+      return grpc::Status(grpc::StatusCode::INVALID_ARGUMENT,
+                          "Unknown ORAM storage type.");
+    }
+  }
+
+  return status;
+}
+
+grpc::Status OramService::BulkLoad(grpc::ServerContext* context,
+                                   grpc::ServerReader<BulkLoadRequest>* reader,
+                                   google::protobuf::Empty* empty) {
+  INFO(logger, "From peer: {}, BulkLoad request received.", context->peer());
+
+  BulkLoadRequest chunk;
+  if (!reader->Read(&chunk)) {
+    return grpc::Status(grpc::StatusCode::INVALID_ARGUMENT,
+                        "The BulkLoad stream is empty.");
+  }
+
+  const uint32_t id = chunk.header().id();
+  std::shared_ptr<BaseOramServerStorage> storage;
+  grpc::Status status = grpc::Status::OK;
+  if (!(status = CheckIdValid(id, &storage)).ok()) {
+    return status;
+  }
+
+  // The flat storage is overwritten as a whole, as in WriteFlatMemory.
+  if (storage->GetOramStorageType() == OramStorageType::kFlatStorage) {
+    FlatOramServerStorage* flat_storage = nullptr;
+    status = CheckStorage(storage.get(), chunk.header().instance_hash(),
+                          OramStorageType::kFlatStorage, flat_storage);
+    if (!status.ok()) {
+      return status;
+    }
+    std::unique_lock<std::shared_mutex> storage_lock(storage->GetLock());
+    flat_storage->ResetStorage();
+  }
+
+  size_t chunk_num = 0;
+  do {
+    if (chunk.header().id() != id) {
+      return grpc::Status(grpc::StatusCode::INVALID_ARGUMENT,
+                          "A BulkLoad stream can only fill one ORAM.");
+    }
+
+    // The storage is only locked for one chunk at a time, so that a long
+    // stream does not hold up the other requests to it.
+    std::unique_lock<std::shared_mutex> storage_lock(storage->GetLock());
+    if (!(status = LoadChunk(storage.get(), chunk)).ok()) {
+      return status;
+    }
+    chunk_num++;
+  } while (reader->Read(&chunk));
+
+  INFO(logger, "BulkLoad received {} chunks for ORAM id {}.", chunk_num, id);
+
+  return grpc::Status::OK;
+}
+
 grpc::Status OramService::ReadFlatMemory(grpc::ServerContext* context,
                                          const ReadFlatRequest* request,
                                          FlatVectorMessage* response) {
@@ -280,17 +490,19 @@ grpc::Status OramService::ReadFlatMemory(grpc::ServerContext* context,
   const uint32_t id = request->header().id();
   const std::string instance_hash = request->header().instance_hash();
 
+  std::shared_ptr<BaseOramServerStorage> oram_storage;
   grpc::Status status = grpc::Status::OK;
-  if (!(status = CheckIdValid(id)).ok()) {
+  if (!(status = CheckIdValid(id, &oram_storage)).ok()) {
     return status;
   }
 
   FlatOramServerStorage* storage = nullptr;
-  status = CheckStorage(storages_[id].get(), instance_hash,
+  status = CheckStorage(oram_storage.get(), instance_hash,
                         OramStorageType::kFlatStorage, storage);
   if (!status.ok()) {
     return status;
   }
+  std::shared_lock<std::shared_mutex> storage_lock(storage->GetLock());
 
   const server_flat_storage_t blocks = storage->GetStorage();
   response->set_content(blocks);
@@ -307,17 +519,19 @@ grpc::Status OramService::WriteFlatMemory(grpc::ServerContext* context,
   const uint32_t id = request->header().id();
   const std::string instance_hash = request->header().instance_hash();
 
+  std::shared_ptr<BaseOramServerStorage> oram_storage;
   grpc::Status status = grpc::Status::OK;
-  if (!(status = CheckIdValid(id)).ok()) {
+  if (!(status = CheckIdValid(id, &oram_storage)).ok()) {
     return status;
   }
 
   FlatOramServerStorage* storage = nullptr;
-  status = CheckStorage(storages_[id].get(), instance_hash,
+  status = CheckStorage(oram_storage.get(), instance_hash,
                         OramStorageType::kFlatStorage, storage);
   if (!status.ok()) {
     return status;
   }
+  std::unique_lock<std::shared_mutex> storage_lock(storage->GetLock());
 
   storage->ResetStorage();
   storage->From(request->content());
@@ -330,7 +544,24 @@ grpc::Status OramService::ResetServer(grpc::ServerContext* context,
                                       google::protobuf::Empty* response) {
   INFO(logger, "From peer: {}, Reset server.", context->peer());
 
-  storages_.clear();
+  // The files of the storages go with them. A storage that is still in use
+  // by a request is freed once the request is done.
+  for (auto& shard : shards_) {
+    std::unique_lock<std::shared_mutex> lock(shard.lock);
+    for (const auto& storage : shard.storages) {
+      if (storage.second->GetOramStorageType() ==
+          OramStorageType::kTreeStorage) {
+        const std::string file_path =
+            dynamic_cast<TreeOramServerStorage*>(storage.second.get())
+                ->GetFilePath();
+        std::error_code error;
+        if (!file_path.empty()) {
+          std::filesystem::remove(file_path, error);
+        }
+      }
+    }
+    shard.storages.clear();
+  }
   cryptor_.reset();
 
   return grpc::Status::OK;
@@ -344,20 +575,22 @@ grpc::Status OramService::PrintOramTree(grpc::ServerContext* context,
 
   const uint32_t id = request->id();
 
+  std::shared_ptr<BaseOramServerStorage> oram_storage;
   grpc::Status status = grpc::Status::OK;
-  if (!(status = CheckIdValid(id)).ok()) {
+  if (!(status = CheckIdValid(id, &oram_storage)).ok()) {
     return status;
   }
 
   // Check if the storage is tree ORAM.
   TreeOramServerStorage* const storage =
-      dynamic_cast<TreeOramServerStorage* const>(storages_[id].get());
+      dynamic_cast<TreeOramServerStorage* const>(oram_storage.get());
   if (storage == nullptr ||
       storage->GetOramStorageType() != OramStorageType::kTreeStorage) {
     return grpc::Status(grpc::StatusCode::UNAVAILABLE, oram_type_mismatch_err);
   }
 
-  oram_utils::PrintOramTree(std::move(storage->GetStorage()));
+  std::shared_lock<std::shared_mutex> storage_lock(storage->GetLock());
+  storage->PrintTree();
 
   return status;
 }
@@ -374,18 +607,20 @@ grpc::Status OramService::ReadPath(grpc::ServerContext* context,
 
   INFO(logger, "PathORAM id: {}, path: {}, level: {}", id, path, level);
 
+  std::shared_ptr<BaseOramServerStorage> oram_storage;
   grpc::Status status = grpc::Status::OK;
-  if (!(status = CheckIdValid(id)).ok()) {
+  if (!(status = CheckIdValid(id, &oram_storage)).ok()) {
     return status;
   }
 
   // Check if the storage is tree ORAM.
   TreeOramServerStorage* storage = nullptr;
-  status = CheckStorage(storages_[id].get(), instance_hash,
+  status = CheckStorage(oram_storage.get(), instance_hash,
                         OramStorageType::kTreeStorage, storage);
   if (!status.ok()) {
     return status;
   }
+  std::unique_lock<std::shared_mutex> storage_lock(storage->GetLock());
 
   // Read the path and record the time it used.
   auto begin = std::chrono::high_resolution_clock::now();
@@ -428,14 +663,15 @@ grpc::Status OramService::WritePath(grpc::ServerContext* context,
   const uint32_t path = request->path();
   const uint32_t offset = request->offset();
 
+  std::shared_ptr<BaseOramServerStorage> oram_storage;
   grpc::Status server_status = grpc::Status::OK;
-  if (!(server_status = CheckIdValid(id)).ok()) {
+  if (!(server_status = CheckIdValid(id, &oram_storage)).ok()) {
     return server_status;
   }
 
   // Check if the storage is tree ORAM.
   TreeOramServerStorage* storage = nullptr;
-  server_status = CheckStorage(storages_[id].get(), instance_hash,
+  server_status = CheckStorage(oram_storage.get(), instance_hash,
                                OramStorageType::kTreeStorage, storage);
   if (!server_status.ok()) {
     return server_status;
@@ -449,6 +685,7 @@ grpc::Status OramService::WritePath(grpc::ServerContext* context,
   DBG(logger, "After deserialize:");
   oram_utils::PrintStash(bucket);
 
+  std::unique_lock<std::shared_mutex> storage_lock(storage->GetLock());
   // Write the path.
   OramStatus status =
       type == Type::kInit
@@ -465,6 +702,199 @@ grpc::Status OramService::WritePath(grpc::ServerContext* context,
   return server_status;
 }
 
+grpc::Status OramService::ReadFullPath(grpc::ServerContext* context,
+                                       const ReadFullPathRequest* request,
+                                       ReadFullPathResponse* response) {
+  INFO(logger, "From peer: {}, ReadFullPath request received.",
+       context->peer());
+
+  const uint32_t id = request->header().id();
+  const std::string instance_hash = request->header().instance_hash();
+  const uint32_t path = request->path();
+
+  std::shared_ptr<BaseOramServerStorage> oram_storage;
+  grpc::Status status = grpc::Status::OK;
+  if (!(status = CheckIdValid(id, &oram_storage)).ok()) {
+    return status;
+  }
+
+  // Check if the storage is tree ORAM.
+  TreeOramServerStorage* storage = nullptr;
+  status = CheckStorage(oram_storage.get(), instance_hash,
+                        OramStorageType::kTreeStorage, storage);
+  if (!status.ok()) {
+    return status;
+  }
+  std::unique_lock<std::shared_mutex> storage_lock(storage->GetLock());
+
+  auto begin = std::chrono::high_resolution_clock::now();
+
+  p_oram_path_t buckets;
+  OramStatus oram_status =
+      storage->ReadFullPath(path, request->start_level(), &buckets);
+  if (!oram_status.ok()) {
+    const std::string error_message =
+        oram_utils::StrCat("Failed to read path: ", path, " in PathORAM id: ",
+                           id, ":\n ", oram_status.EmitString());
+    return grpc::Status(grpc::StatusCode::INTERNAL, error_message);
+  }
+  auto end = std::chrono::high_resolution_clock::now();
+  INFO(logger, "Elapsed time when reading a full path: {} us",
+       std::chrono::duration_cast<std::chrono::microseconds>(end - begin)
+           .count());
+
+  // Serialize the buckets level by level.
+  for (const auto& bucket : buckets) {
+    BucketMessage* const message = response->add_buckets();
+    for (const auto& block : oram_utils::SerializeToStringVector(bucket)) {
+      message->add_bucket(block);
+    }
+  }
+
+  return status;
+}
+
+grpc::Status OramService::WriteFullPath(grpc::ServerContext* context,
+                                        const WriteFullPathRequest* request,
+                                        WritePathResponse* response) {
+  INFO(logger, "From peer: {}, WriteFullPath request received.",
+       context->peer());
+
+  const uint32_t id = request->header().id();
+  const std::string instance_hash = request->header().instance_hash();
+  const uint32_t path = request->path();
+
+  std::shared_ptr<BaseOramServerStorage> oram_storage;
+  grpc::Status server_status = grpc::Status::OK;
+  if (!(server_status = CheckIdValid(id, &oram_storage)).ok()) {
+    return server_status;
+  }
+
+  // Check if the storage is tree ORAM.
+  TreeOramServerStorage* storage = nullptr;
+  server_status = CheckStorage(oram_storage.get(), instance_hash,
+                               OramStorageType::kTreeStorage, storage);
+  if (!server_status.ok()) {
+    return server_status;
+  }
+
+  // Deserialize the buckets from the strings.
+  p_oram_path_t buckets;
+  for (const auto& message : request->buckets()) {
+    buckets.emplace_back(
+        oram_utils::DeserializeFromStringVector(std::vector<std::string>(
+            message.bucket().begin(), message.bucket().end())));
+  }
+
+  std::unique_lock<std::shared_mutex> storage_lock(storage->GetLock());
+  OramStatus status =
+      storage->WriteFullPath(path, request->start_level(), buckets);
+  if (!status.ok()) {
+    const std::string error_message =
+        oram_utils::StrCat("Failed to write path: ", path, " in PathORAM id: ",
+                           id, ":\n ", status.EmitString());
+    return grpc::Status(grpc::StatusCode::INTERNAL, error_message);
+  }
+
+  return server_status;
+}
+
+static std::vector<std::vector<uint32_t>> ParseSlots(
+    const google::protobuf::RepeatedPtrField<SlotListMessage>& messages) {
+  std::vector<std::vector<uint32_t>> slots;
+  for (const auto& message : messages) {
+    slots.emplace_back(message.slot().begin(), message.slot().end());
+  }
+  return slots;
+}
+
+grpc::Status OramService::ReadSlots(grpc::ServerContext* context,
+                                    const ReadSlotsRequest* request,
+                                    ReadFullPathResponse* response) {
+  INFO(logger, "From peer: {}, ReadSlots request received.", context->peer());
+
+  const uint32_t id = request->header().id();
+  const std::string instance_hash = request->header().instance_hash();
+  const uint32_t path = request->path();
+
+  std::shared_ptr<BaseOramServerStorage> oram_storage;
+  grpc::Status status = grpc::Status::OK;
+  if (!(status = CheckIdValid(id, &oram_storage)).ok()) {
+    return status;
+  }
+
+  // Check if the storage is tree ORAM.
+  TreeOramServerStorage* storage = nullptr;
+  status = CheckStorage(oram_storage.get(), instance_hash,
+                        OramStorageType::kTreeStorage, storage);
+  if (!status.ok()) {
+    return status;
+  }
+  std::shared_lock<std::shared_mutex> storage_lock(storage->GetLock());
+
+  p_oram_path_t buckets;
+  OramStatus oram_status =
+      storage->ReadSlots(path, ParseSlots(request->slots()), &buckets);
+  if (!oram_status.ok()) {
+    const std::string error_message = oram_utils::StrCat(
+        "Failed to read slots on path: ", path, " in ORAM id: ", id, ":\n ",
+        oram_status.EmitString());
+    return grpc::Status(grpc::StatusCode::INTERNAL, error_message);
+  }
+
+  for (const auto& bucket : buckets) {
+    BucketMessage* const message = response->add_buckets();
+    for (const auto& block : oram_utils::SerializeToStringVector(bucket)) {
+      message->add_bucket(block);
+    }
+  }
+
+  return status;
+}
+
+grpc::Status OramService::WriteSlots(grpc::ServerContext* context,
+                                     const WriteSlotsRequest* request,
+                                     WritePathResponse* response) {
+  INFO(logger, "From peer: {}, WriteSlots request received.", context->peer());
+
+  const uint32_t id = request->header().id();
+  const std::string instance_hash = request->header().instance_hash();
+  const uint32_t path = request->path();
+
+  std::shared_ptr<BaseOramServerStorage> oram_storage;
+  grpc::Status server_status = grpc::Status::OK;
+  if (!(server_status = CheckIdValid(id, &oram_storage)).ok()) {
+    return server_status;
+  }
+
+  // Check if the storage is tree ORAM.
+  TreeOramServerStorage* storage = nullptr;
+  server_status = CheckStorage(oram_storage.get(), instance_hash,
+                               OramStorageType::kTreeStorage, storage);
+  if (!server_status.ok()) {
+    return server_status;
+  }
+
+  p_oram_path_t buckets;
+  for (const auto& message : request->buckets()) {
+    buckets.emplace_back(
+        oram_utils::DeserializeFromStringVector(std::vector<std::string>(
+            message.bucket().begin(), message.bucket().end())));
+  }
+
+  std::unique_lock<std::shared_mutex> storage_lock(storage->GetLock());
+  OramStatus status =
+      storage->WriteSlots(path, ParseSlots(request->slots()), buckets);
+  if (!status.ok()) {
+    const std::string error_message = oram_utils::StrCat(
+        "Failed to write slots on path: ", path, " in ORAM id: ", id, ":\n ",
+        status.EmitString());
+    return grpc::Status(grpc::StatusCode::INTERNAL, error_message);
+  }
+
+  return server_status;
+}
+
 grpc::Status OramService::KeyExchange(grpc::ServerContext* context,
                                       const KeyExchangeRequest* request,
                                       KeyExchangeResponse* response) {
@@ -532,8 +962,13 @@ grpc::Status OramService::ReportServerInformation(
   INFO(logger, "Report server information...");
 
   double storage_size = 0;
-  for (const auto& storage : storages_) {
-    storage_size += storage.second->ReportStorage();
+  for (auto& shard : shards_) {
+    std::shared_lock<std::shared_mutex> lock(shard.lock);
+    for (const auto& storage : shard.storages) {
+      std::shared_lock<std::shared_mutex> storage_lock(
+          storage.second->GetLock());
+      storage_size += storage.second->ReportStorage();
+    }
   }
 
   INFO(logger, "The total storage size is {} MB.", storage_size);
@@ -543,7 +978,9 @@ grpc::Status OramService::ReportServerInformation(
 
 ServerRunner::ServerRunner(const std::string& address, uint32_t port,
                            const std::string& key_path,
-                           const std::string& crt_path)
+                           const std::string& crt_path,
+                           const std::string& storage_path,
+                           bool direct_io)
     : address_(address), port_(port) {
   const std::string key_file = oram_utils::ReadKeyCrtFile(key_path);
   const std::string crt_file = oram_utils::ReadKeyCrtFile(crt_path);
@@ -566,6 +1003,8 @@ ServerRunner::ServerRunner(const std::string& address, uint32_t port,
   creds_ = grpc::SslServerCredentials(ssl_opts);
 
   service_ = std::make_unique<OramService>();
+  service_->storage_path_ = storage_path;
+  service_->direct_io_ = direct_io;
   is_initialized = true;
 }
 
@@ -577,6 +1016,15 @@ void ServerRunner::Run(void) {
     exit(1);
   }
 
+  if (!service_->storage_path_.empty()) {
+    OramStatus status = service_->AttachStorages();
+    if (!status.ok()) {
+      ERRS(logger, "[-] Unable to attach the storages. {}",
+           status.EmitString());
+      exit(1);
+    }
+  }
+
   grpc::ServerBuilder builder;
   const std::string address = oram_utils::StrCat(address_, ":", port_);
   builder.AddListeningPort(address, creds_);
@@ -595,6 +1043,21 @@ void ServerRunner::Run(void) {
       // Wake up every 100 miliseconds and check if the server is still
       // running.
       std::this_thread::sleep_for(std::chrono::milliseconds(100));
+
+      if (sync_requested.exchange(false)) {
+        OramStatus status = service_->SyncStorages();
+        if (!status.ok()) {
+          ERRS(logger, "[-] Unable to sync the storages. {}",
+               status.EmitString());
+        } else {
+          INFO(logger, "The storages are synced to the disk.");
+        }
+      }
+    }
+
+    OramStatus status = service_->SyncStorages();
+    if (!status.ok()) {
+      ERRS(logger, "[-] Unable to sync the storages. {}", status.EmitString());
     }
     server->Shutdown();
   });
@@ -20,7 +20,10 @@
 #include <grpc++/grpc++.h>
 #include <spdlog/spdlog.h>
 
+#include <array>
+#include <atomic>
 #include <memory>
+#include <shared_mutex>
 #include <string>
 #include <vector>
 #include <unordered_map>
@@ -32,6 +35,10 @@
 #include "protos/messages.pb.h"
 
 extern std::shared_ptr<spdlog::logger> logger;
+// Cleared (e.g., by a signal) to sync the storages and shut the server down.
+extern std::atomic_bool server_running;
+// Set (e.g., by a signal) to flush the file-backed storages to the disk.
+extern std::atomic_bool sync_requested;
 
 namespace oram_impl {
 class OramService final : public oram_server::Service {
@@ -39,11 +46,40 @@ class OramService final : public oram_server::Service {
   friend class ServerRunner;
 
   std::shared_ptr<oram_crypto::Cryptor> cryptor_;
-  std::unordered_map<uint32_t, std::unique_ptr<BaseOramServerStorage>>
-      storages_;
-
+  // gRPC serves requests on several threads, e.g., for the partitions of
+  // Partition ORAM, so the registry is sharded and each shard is guarded. A
+  // request holds a reference to its storage, which thus outlives a reset
+  // of the server, and then takes the lock of the storage itself.
+  struct StorageShard {
+    std::shared_mutex lock;
+    std::unordered_map<uint32_t, std::shared_ptr<BaseOramServerStorage>>
+        storages;
+  };
+  std::array<StorageShard, kStorageShardNum> shards_;
+  // The directory of the memory-mapped tree storages; empty if they are kept
+  // in memory only.
+  std::string storage_path_;
+  // Whether the new tree storages are accessed with direct I/O.
+  bool direct_io_;
+
+  StorageShard& ShardOf(uint32_t id) { return shards_[id % kStorageShardNum]; }
+  // Returns nullptr if there is no storage with the given id.
+  std::shared_ptr<BaseOramServerStorage> GetStorage(uint32_t id);
+
+  // The caller holds the lock of the shard of `id`.
   grpc::Status CheckInitRequest(uint32_t id);
-  grpc::Status CheckIdValid(uint32_t id);
+  // Also hands out the storage with the given id.
+  grpc::Status CheckIdValid(
+      uint32_t id, std::shared_ptr<BaseOramServerStorage>* const storage);
+  // Writes a chunk of BulkLoad into the storage according to its type.
+  grpc::Status LoadChunk(BaseOramServerStorage* const storage,
+                         const BulkLoadRequest& chunk);
+  // The file that backs the tree storage with the given id.
+  std::string StorageFileOf(uint32_t id) const;
+  // Attaches to the tree storages left in `storage_path_` by an earlier run.
+  OramStatus AttachStorages(void);
+  // Flushes the file-backed tree storages to the disk.
+  OramStatus SyncStorages(void);
 
  public:
   grpc::Status InitTreeOram(grpc::ServerContext* context,
@@ -62,6 +98,10 @@ class OramService final : public oram_server::Service {
                             const LoadSqrtOramRequest* request,
                             google::protobuf::Empty* empty) override;
 
+  grpc::Status BulkLoad(grpc::ServerContext* context,
+                        grpc::ServerReader<BulkLoadRequest>* reader,
+                        google::protobuf::Empty* empty) override;
+
   grpc::Status PrintOramTree(grpc::ServerContext* context,
                              const PrintOramTreeRequest* request,
                              google::protobuf::Empty* response) override;
@@ -74,6 +114,22 @@ class OramService final : public oram_server::Service {
                          const WritePathRequest* request,
                          WritePathResponse* response) override;
 
+  grpc::Status ReadFullPath(grpc::ServerContext* context,
+                            const ReadFullPathRequest* request,
+                            ReadFullPathResponse* response) override;
+
+  grpc::Status WriteFullPath(grpc::ServerContext* context,
+                             const WriteFullPathRequest* request,
+                             WritePathResponse* response) override;
+
+  grpc::Status ReadSlots(grpc::ServerContext* context,
+                         const ReadSlotsRequest* request,
+                         ReadFullPathResponse* response) override;
+
+  grpc::Status WriteSlots(grpc::ServerContext* context,
+                          const WriteSlotsRequest* request,
+                          WritePathResponse* response) override;
+
   grpc::Status ReadFlatMemory(grpc::ServerContext* context,
                               const ReadFlatRequest* request,
                               FlatVectorMessage* response) override;
@@ -128,7 +184,9 @@ class ServerRunner {
 
  public:
   ServerRunner(const std::string& address, uint32_t port,
-               const std::string& key_path, const std::string& crt_path);
+               const std::string& key_path, const std::string& crt_path,
+               const std::string& storage_path = "",
+               bool direct_io = false);
 
   void Run(void);
 };
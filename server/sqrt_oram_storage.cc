@@ -120,8 +120,10 @@ std::string SqrtOramServerStorage::ReadBlockFromDummy(uint32_t pos) {
 }
 
 void SqrtOramServerStorage::Fill(const std::vector<std::string>& data) {
+  // The data may arrive in several chunks, so it is appended after the blocks
+  // that are already there.
   for (size_t i = 0; i < data.size(); i++) {
-    if (i < capacity_) {
+    if (main_memory_.size() < capacity_) {
       main_memory_.emplace_back(data[i]);
     } else {
       dummy_.emplace_back(data[i]);
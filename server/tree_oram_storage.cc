@@ -16,142 +16,758 @@
  */
 #include "tree_oram_storage.h"
 
+#include <fcntl.h>
+#include <liburing.h>
 #include <spdlog/logger.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <cstring>
 
 #include "base/oram_utils.h"
 
 extern std::shared_ptr<spdlog::logger> logger;
 
 namespace oram_impl {
+static const size_t kPageSize = 4096;
+// The buckets in memory are only aligned for the copies.
+static const size_t kSlotAlignment = 8;
+// A path has far fewer buckets, so it is submitted at once.
+static const unsigned kRingEntries = 64;
+static const char kTreeStorageMagic[8] = {'O', 'R', 'A', 'M',
+                                          'T', 'R', 'E', 'E'};
+
+// The first page of a file that backs a tree storage.
+struct TreeStorageHeader {
+  char magic[8];
+  uint32_t id;
+  uint32_t hash_size;
+  uint64_t capacity;
+  uint64_t block_size;
+  uint64_t bucket_size;
+  uint64_t bucket_stride;
+  uint32_t direct_io;
+  uint8_t instance_hash[64];
+};
+
+static size_t AlignTo(size_t size, size_t alignment) {
+  return (size + alignment - 1) / alignment * alignment;
+}
+
+static OramStatus FileError(const std::string& what,
+                            const std::string& file_path) {
+  return OramStatus(
+      StatusCode::kFileIOError,
+      oram_utils::StrCat("Cannot ", what, " ", file_path, ": ",
+                         strerror(errno)),
+      __func__);
+}
+
 TreeOramServerStorage::TreeOramServerStorage(uint32_t id, size_t capacity,
                                              size_t block_size,
                                              size_t bucket_size,
-                                             const std::string& instance_hash)
+                                             const std::string& instance_hash,
+                                             size_t alignment)
     : BaseOramServerStorage(id, capacity, block_size, instance_hash,
                             OramStorageType::kTreeStorage),
-      bucket_size_(bucket_size) {
+      bucket_size_(bucket_size),
+      backend_(Backend::kHeap),
+      heap_(nullptr, &free),
+      region_(nullptr),
+      slab_(nullptr),
+      fd_(-1) {
   level_ = std::ceil(LOG_BASE(capacity_ + 1, 2)) - 1;
+  bucket_num_ = POW2(level_ + 1) - 1;
 
   DBG(logger, "level = {}, capacity = {}", level_, capacity);
+  PANIC_IF(block_size_ < ORAM_BLOCK_SIZE,
+           "The slots of the tree storage are too small for a block.");
 
-  for (uint32_t i = 0; i <= level_; i++) {
-    // Initialize dummy blocks into the storage.
-    const uint32_t cur_size = POW2(i);
+  bucket_stride_ =
+      AlignTo(SlotsOffset() + bucket_size_ * block_size_, alignment);
+  region_size_ = kPageSize + bucket_num_ * bucket_stride_;
+}
 
-    for (uint32_t j = 0; j < cur_size; j++) {
-      const server_storage_tag_t tag = std::make_pair(i, j);
-      server_storage_data data;
-      storage_[tag] = data;
+TreeOramServerStorage::TreeOramServerStorage(uint32_t id, size_t capacity,
+                                             size_t block_size,
+                                             size_t bucket_size,
+                                             const std::string& instance_hash)
+    : TreeOramServerStorage(id, capacity, block_size, bucket_size,
+                            instance_hash, kSlotAlignment) {
+  // The allocator maps a region this large lazily and zero-filled, so the
+  // flags read as zero and only the pages that are written are committed.
+  heap_.reset(reinterpret_cast<uint8_t*>(calloc(1, region_size_)));
+  PANIC_IF(heap_ == nullptr, "Cannot allocate the tree storage.");
+  region_ = heap_.get();
+  slab_ = region_ + kPageSize;
+}
+
+TreeOramServerStorage::~TreeOramServerStorage() {
+  if (backend_ == Backend::kMappedFile) {
+    munmap(region_, region_size_);
+  } else if (backend_ == Backend::kDirectFile) {
+    io_uring_queue_exit(ring_.get());
+    close(fd_);
+  }
+}
+
+size_t TreeOramServerStorage::SlotsOffset(void) const {
+  return AlignTo(bucket_size_, kSlotAlignment);
+}
+
+OramStatus TreeOramServerStorage::MapFile(int fd,
+                                          const std::string& file_path) {
+  void* const region = mmap(nullptr, region_size_, PROT_READ | PROT_WRITE,
+                            MAP_SHARED, fd, 0);
+  if (region == MAP_FAILED) {
+    OramStatus status = FileError("map", file_path);
+    close(fd);
+    return status;
+  }
+  // The mapping keeps the file open.
+  close(fd);
+
+  backend_ = Backend::kMappedFile;
+  file_path_ = file_path;
+  region_ = reinterpret_cast<uint8_t*>(region);
+  slab_ = region_ + kPageSize;
+
+  return OramStatus::OK;
+}
+
+OramStatus TreeOramServerStorage::OpenDirect(int fd,
+                                             const std::string& file_path) {
+  auto ring = std::make_unique<io_uring>();
+  const int ret = io_uring_queue_init(kRingEntries, ring.get(), 0);
+  if (ret < 0) {
+    errno = -ret;
+    OramStatus status = FileError("set up the ring for", file_path);
+    close(fd);
+    return status;
+  }
+
+  backend_ = Backend::kDirectFile;
+  file_path_ = file_path;
+  fd_ = fd;
+  ring_ = std::move(ring);
+
+  return OramStatus::OK;
+}
+
+OramStatus TreeOramServerStorage::Create(
+    const std::string& file_path, bool direct_io, uint32_t id,
+    size_t capacity, size_t block_size, size_t bucket_size,
+    const std::string& instance_hash,
+    std::unique_ptr<TreeOramServerStorage>* const storage) {
+  TreeStorageHeader header;
+  memset(&header, 0, sizeof(TreeStorageHeader));
+  if (instance_hash.size() > sizeof(header.instance_hash)) {
+    return OramStatus(StatusCode::kInvalidArgument,
+                      "The instance hash is too long to be stored.", __func__);
+  }
+
+  std::unique_ptr<TreeOramServerStorage> created(new TreeOramServerStorage(
+      id, capacity, block_size, bucket_size, instance_hash,
+      direct_io ? kPageSize : kSlotAlignment));
+  memcpy(header.magic, kTreeStorageMagic, sizeof(header.magic));
+  header.id = id;
+  header.hash_size = instance_hash.size();
+  header.capacity = capacity;
+  header.block_size = block_size;
+  header.bucket_size = bucket_size;
+  header.bucket_stride = created->bucket_stride_;
+  header.direct_io = direct_io;
+  memcpy(header.instance_hash, instance_hash.data(), instance_hash.size());
+
+  // The file is sparse, so the flags read as zero and only the pages that
+  // are written take up space on the disk.
+  const int fd = open(file_path.c_str(),
+                      O_RDWR | O_CREAT | O_TRUNC | (direct_io ? O_DIRECT : 0),
+                      0600);
+  if (fd < 0) {
+    return FileError("create", file_path);
+  }
+  if (ftruncate(fd, created->region_size_) != 0) {
+    OramStatus status = FileError("resize", file_path);
+    close(fd);
+    return status;
+  }
+
+  if (!direct_io) {
+    OramStatus status = created->MapFile(fd, file_path);
+    if (!status.ok()) {
+      return status;
+    }
+    memcpy(created->region_, &header, sizeof(TreeStorageHeader));
+  } else {
+    // Direct I/O needs an aligned buffer.
+    std::unique_ptr<uint8_t, decltype(&free)> page(
+        reinterpret_cast<uint8_t*>(aligned_alloc(kPageSize, kPageSize)),
+        &free);
+    memset(page.get(), 0, kPageSize);
+    memcpy(page.get(), &header, sizeof(TreeStorageHeader));
+    if (pwrite(fd, page.get(), kPageSize, 0) != (ssize_t)kPageSize) {
+      OramStatus status = FileError("write the header of", file_path);
+      close(fd);
+      return status;
+    }
+
+    OramStatus status = created->OpenDirect(fd, file_path);
+    if (!status.ok()) {
+      return status;
     }
   }
+
+  *storage = std::move(created);
+  return OramStatus::OK;
+}
+
+OramStatus TreeOramServerStorage::Attach(
+    const std::string& file_path,
+    std::unique_ptr<TreeOramServerStorage>* const storage) {
+  int fd = open(file_path.c_str(), O_RDWR);
+  if (fd < 0) {
+    return FileError("open", file_path);
+  }
+
+  TreeStorageHeader header;
+  if (pread(fd, &header, sizeof(TreeStorageHeader), 0) !=
+          sizeof(TreeStorageHeader) ||
+      memcmp(header.magic, kTreeStorageMagic, sizeof(header.magic)) != 0 ||
+      header.hash_size > sizeof(header.instance_hash)) {
+    close(fd);
+    return OramStatus(
+        StatusCode::kInvalidArgument,
+        oram_utils::StrCat(file_path, " does not hold a tree storage."),
+        __func__);
+  }
+
+  std::unique_ptr<TreeOramServerStorage> attached(new TreeOramServerStorage(
+      header.id, header.capacity, header.block_size, header.bucket_size,
+      std::string(reinterpret_cast<const char*>(header.instance_hash),
+                  header.hash_size),
+      header.direct_io ? kPageSize : kSlotAlignment));
+
+  struct stat file_stat;
+  if (attached->bucket_stride_ != header.bucket_stride ||
+      fstat(fd, &file_stat) != 0 ||
+      (size_t)file_stat.st_size != attached->region_size_) {
+    close(fd);
+    return OramStatus(
+        StatusCode::kInvalidArgument,
+        oram_utils::StrCat(file_path, " does not match its header."),
+        __func__);
+  }
+
+  OramStatus status;
+  if (!header.direct_io) {
+    status = attached->MapFile(fd, file_path);
+  } else {
+    close(fd);
+    fd = open(file_path.c_str(), O_RDWR | O_DIRECT);
+    status = fd < 0 ? FileError("open", file_path)
+                    : attached->OpenDirect(fd, file_path);
+  }
+  if (!status.ok()) {
+    return status;
+  }
+
+  *storage = std::move(attached);
+  return OramStatus::OK;
+}
+
+OramStatus TreeOramServerStorage::Sync(void) {
+  if (backend_ == Backend::kMappedFile &&
+      msync(region_, region_size_, MS_SYNC) != 0) {
+    return FileError("sync", file_path_);
+  } else if (backend_ == Backend::kDirectFile && fdatasync(fd_) != 0) {
+    // Direct I/O bypasses the page cache, but not the cache of the device.
+    return FileError("sync", file_path_);
+  }
+
+  return OramStatus::OK;
+}
+
+bool TreeOramServerStorage::BucketIndex(uint32_t level, uint32_t offset,
+                                        size_t* const index) const {
+  if (level > level_ || offset >= (uint32_t)POW2(level)) {
+    return false;
+  }
+
+  *index = POW2(level) - 1 + offset;
+  return true;
+}
+
+void TreeOramServerStorage::LoadSlot(const uint8_t* bucket, size_t slot,
+                                     oram_block_t* const block) const {
+  memcpy(block, bucket + SlotsOffset() + slot * block_size_, ORAM_BLOCK_SIZE);
+}
+
+void TreeOramServerStorage::StoreSlot(uint8_t* bucket, size_t slot,
+                                      const oram_block_t& block) {
+  memcpy(bucket + SlotsOffset() + slot * block_size_, &block, ORAM_BLOCK_SIZE);
+  bucket[slot] = 1;
+}
+
+void TreeOramServerStorage::TakeBucket(uint8_t* bucket,
+                                       p_oram_bucket_t* const out_bucket) {
+  for (size_t i = 0; i < bucket_size_; i++) {
+    if (bucket[i]) {
+      oram_block_t block;
+      LoadSlot(bucket, i, &block);
+      out_bucket->emplace_back(block);
+
+      // Clear the data.
+      bucket[i] = 0;
+    }
+  }
+}
+
+OramStatus TreeOramServerStorage::PutBucket(uint8_t* bucket,
+                                            const p_oram_bucket_t& in_bucket,
+                                            oram_impl::Type type) {
+  // The initial data is appended to the bucket, and a normal write replaces
+  // its content.
+  size_t slot = 0;
+  if (type == oram_impl::Type::kInit) {
+    while (slot < bucket_size_ && bucket[slot]) {
+      slot++;
+    }
+  }
+
+  if (slot + in_bucket.size() > bucket_size_) {
+    return OramStatus(
+        StatusCode::kOutOfRange,
+        oram_utils::StrCat("The bucket can hold ", bucket_size_,
+                           " blocks, but ", slot + in_bucket.size(),
+                           " are written"),
+        __func__);
+  }
+
+  for (size_t i = 0; i < in_bucket.size(); i++, slot++) {
+    StoreSlot(bucket, slot, in_bucket[i]);
+  }
+  for (; type != oram_impl::Type::kInit && slot < bucket_size_; slot++) {
+    bucket[slot] = 0;
+  }
+
+  return OramStatus::OK;
+}
+
+OramStatus TreeOramServerStorage::PathBatch(uint32_t path,
+                                            uint32_t start_level,
+                                            BucketBatch* const batch) const {
+  for (uint32_t i = start_level; i <= level_; i++) {
+    size_t index;
+    if (!BucketIndex(i, OffsetOf(i, path), &index)) {
+      // Not found.
+      return OramStatus(
+          StatusCode::kObjectNotFound,
+          oram_utils::StrCat("Cannot find level ", i, " of path ", path),
+          __func__);
+    }
+
+    batch->indices.emplace_back(index);
+  }
+
+  return OramStatus::OK;
+}
+
+OramStatus TreeOramServerStorage::FetchBuckets(BucketBatch* const batch,
+                                               bool load) const {
+  batch->buckets.clear();
+  if (backend_ != Backend::kDirectFile) {
+    for (const size_t index : batch->indices) {
+      batch->buckets.emplace_back(slab_ + index * bucket_stride_);
+    }
+
+    return OramStatus::OK;
+  }
+
+  const size_t buffer_size = batch->indices.size() * bucket_stride_;
+  batch->buffer.reset(
+      reinterpret_cast<uint8_t*>(aligned_alloc(kPageSize, buffer_size)));
+  if (batch->buffer == nullptr) {
+    return OramStatus(StatusCode::kOutOfMemory,
+                      "Cannot allocate the buffer for direct I/O.", __func__);
+  }
+  for (size_t i = 0; i < batch->indices.size(); i++) {
+    batch->buckets.emplace_back(batch->buffer.get() + i * bucket_stride_);
+  }
+
+  if (!load) {
+    memset(batch->buffer.get(), 0, buffer_size);
+    return OramStatus::OK;
+  }
+  return SubmitIo(false, *batch, bucket_stride_);
+}
+
+OramStatus TreeOramServerStorage::FlushBuckets(const BucketBatch& batch,
+                                               bool flags_only) {
+  if (backend_ != Backend::kDirectFile) {
+    return OramStatus::OK;
+  }
+
+  // The flags are at the start of a bucket, well within its first page.
+  return SubmitIo(true, batch, flags_only ? kPageSize : bucket_stride_);
+}
+
+OramStatus TreeOramServerStorage::SubmitIo(bool write,
+                                           const BucketBatch& batch,
+                                           size_t length) const {
+  // The ring is shared by all the requests to this storage.
+  std::lock_guard<std::mutex> lock(ring_lock_);
+
+  // Waits for one request and records its failure, if any.
+  int error = 0;
+  auto reap = [&]() {
+    io_uring_cqe* cqe;
+    const int ret = io_uring_wait_cqe(ring_.get(), &cqe);
+    if (ret < 0) {
+      return ret;
+    }
+
+    if (cqe->res < 0) {
+      error = -cqe->res;
+    } else if ((size_t)cqe->res != length) {
+      error = EIO;
+    }
+    io_uring_cqe_seen(ring_.get(), cqe);
+    return 0;
+  };
+
+  for (size_t begin = 0; begin < batch.indices.size();
+       begin += kRingEntries) {
+    const size_t end =
+        std::min(batch.indices.size(), begin + (size_t)kRingEntries);
+    for (size_t i = begin; i < end; i++) {
+      io_uring_sqe* const sqe = io_uring_get_sqe(ring_.get());
+      const uint64_t offset = kPageSize + batch.indices[i] * bucket_stride_;
+      if (write) {
+        io_uring_prep_write(sqe, fd_, batch.buckets[i], length, offset);
+      } else {
+        io_uring_prep_read(sqe, fd_, batch.buckets[i], length, offset);
+      }
+    }
+
+    // A request left in the queue would go out with the next batch, so the
+    // submission is repeated until the kernel has taken all of them, making
+    // room by reaping completions when it is busy.
+    const size_t queued = end - begin;
+    size_t submitted = 0;
+    size_t completed = 0;
+    while (submitted < queued) {
+      const int ret = io_uring_submit(ring_.get());
+      if (ret > 0) {
+        submitted += ret;
+        continue;
+      } else if (ret == -EINTR) {
+        continue;
+      }
+
+      const bool busy = ret == 0 || ret == -EAGAIN || ret == -EBUSY;
+      if (!busy || completed == submitted) {
+        error = ret < 0 ? -ret : EIO;
+        break;
+      }
+
+      const int reaped = reap();
+      if (reaped < 0) {
+        errno = -reaped;
+        return FileError("complete the requests to", file_path_);
+      }
+      completed++;
+    }
+
+    // Every request that went out is reaped before returning, even on
+    // failure, because the kernel may still be using the buffer.
+    for (; completed < submitted; completed++) {
+      const int reaped = reap();
+      if (reaped < 0) {
+        errno = -reaped;
+        return FileError("complete the requests to", file_path_);
+      }
+    }
+
+    // The kernel refused the rest of the queue; start over with an empty ring
+    // rather than leave them for the next batch. The old ring is only dropped
+    // once the new one is set up.
+    if (submitted < queued) {
+      io_uring ring;
+      const int ret = io_uring_queue_init(kRingEntries, &ring, 0);
+      if (ret < 0) {
+        errno = -ret;
+        return FileError("reset the ring of", file_path_);
+      }
+      io_uring_queue_exit(ring_.get());
+      *ring_ = ring;
+    }
+
+    if (error != 0) {
+      errno = error;
+      return FileError(write ? "write" : "read", file_path_);
+    }
+  }
+
+  return OramStatus::OK;
 }
 
 OramStatus TreeOramServerStorage::ReadPath(uint32_t level, uint32_t path,
                                            p_oram_bucket_t* const out_bucket) {
+  // The level comes from the client, and OffsetOf() cannot shift by it if it
+  // exceeds the tree.
+  if (level > level_) {
+    return OramStatus(StatusCode::kInvalidArgument,
+                      "The level exceeds the tree.", __func__);
+  }
+
   // The offset should be calculated by the level and path.
-  const uint32_t offset = std::floor(path * 1. / POW2(level_ - level));
-  const server_storage_tag_t tag = std::make_pair(level, offset);
+  const uint32_t offset = OffsetOf(level, path);
   INFO(logger, "Read offset {} at level {} for path {}.", offset, level, path);
 
-  auto iter = storage_.find(tag);
-  if (iter == storage_.end()) {
+  BucketBatch batch;
+  batch.indices.emplace_back();
+  if (!BucketIndex(level, offset, &batch.indices[0])) {
     // Not found.
     return OramStatus(StatusCode::kObjectNotFound, "Cannot find the bucket.",
                       __func__);
-  } else {
-    for (auto& data : iter->second) {
-      if (!data.empty()) {
-        // Decompress the data.
-        oram_block_t block;
-        size_t size;
-
-        OramStatus status = oram_utils::DataDecompress(
-            reinterpret_cast<const uint8_t*>(data.data()), data.size(),
-            reinterpret_cast<uint8_t*>(&block), &size);
-        if (!status.ok()) {
-          return status.Append(OramStatus(StatusCode::kInvalidOperation,
-                                          "Cannot Read from the server",
-                                          __func__));
-        }
-
-        out_bucket->emplace_back(block);
-
-        // Clear the data.
-        data.clear();
-      }
-    }
+  }
 
-    return OramStatus::OK;
+  OramStatus status = FetchBuckets(&batch, true);
+  if (!status.ok()) {
+    return status;
   }
+  TakeBucket(batch.buckets[0], out_bucket);
+
+  return FlushBuckets(batch, true);
 }
 
 OramStatus TreeOramServerStorage::WritePath(uint32_t level, uint32_t path,
                                             const p_oram_bucket_t& in_bucket) {
-  const uint32_t offset = std::floor(path * 1. / POW2(level_ - level));
+  if (level > level_) {
+    return OramStatus(StatusCode::kInvalidArgument,
+                      "The level exceeds the tree.", __func__);
+  }
 
-  return AccurateWritePath(level, offset, in_bucket, oram_impl::Type::kNormal);
+  return AccurateWritePath(level, OffsetOf(level, path), in_bucket,
+                           oram_impl::Type::kNormal);
 }
 
 OramStatus TreeOramServerStorage::AccurateWritePath(
     uint32_t level, uint32_t offset, const p_oram_bucket_t& in_bucket,
     oram_impl::Type type) {
   INFO(logger, "Write offset {} at level {}. ", offset, level);
-  const server_storage_tag_t tag = std::make_pair(level, offset);
 
-  auto iter = storage_.find(tag);
-  uint8_t buf[DEFAULT_COMPRESSED_BUF_SIZE];
+  BucketBatch batch;
+  batch.indices.emplace_back();
+  if (!BucketIndex(level, offset, &batch.indices[0])) {
+    // Not found.
+    return OramStatus(StatusCode::kObjectNotFound, "Cannot find the bucket.",
+                      __func__);
+  }
 
-  if (type == oram_impl::Type::kInit) {
-    for (size_t i = 0; i < in_bucket.size(); i++) {
-      size_t compressed_size;
-      OramStatus status = oram_utils::DataCompress(
-          (uint8_t*)(&in_bucket[i]), ORAM_BLOCK_SIZE, buf, &compressed_size);
-
-      if (!status.ok()) {
-        return status.Append(OramStatus(StatusCode::kInvalidOperation,
-                                        "Cannot write to the server",
-                                        __func__));
+  // Only the initial data needs the old content of the bucket.
+  OramStatus status = FetchBuckets(&batch, type == oram_impl::Type::kInit);
+  if (!status.ok()) {
+    return status;
+  }
+  status = PutBucket(batch.buckets[0], in_bucket, type);
+  if (!status.ok()) {
+    return status;
+  }
+
+  return FlushBuckets(batch, false);
+}
+
+OramStatus TreeOramServerStorage::ReadFullPath(uint32_t path,
+                                               uint32_t start_level,
+                                               p_oram_path_t* const out_path) {
+  BucketBatch batch;
+  OramStatus status = PathBatch(path, start_level, &batch);
+  if (!status.ok()) {
+    return status;
+  }
+  status = FetchBuckets(&batch, true);
+  if (!status.ok()) {
+    return status.Append(OramStatus(
+        StatusCode::kInvalidOperation,
+        oram_utils::StrCat("Cannot read path ", path), __func__));
+  }
+
+  for (uint8_t* const bucket : batch.buckets) {
+    p_oram_bucket_t out_bucket;
+    TakeBucket(bucket, &out_bucket);
+    out_path->emplace_back(std::move(out_bucket));
+  }
+
+  return FlushBuckets(batch, true);
+}
+
+OramStatus TreeOramServerStorage::WriteFullPath(uint32_t path,
+                                                uint32_t start_level,
+                                                const p_oram_path_t& in_path) {
+  if (start_level > level_ + 1 || in_path.size() != level_ + 1 - start_level) {
+    return OramStatus(
+        StatusCode::kInvalidArgument,
+        oram_utils::StrCat("The path should contain ",
+                           level_ + 1 - std::min(start_level, level_ + 1),
+                           " buckets, but ", in_path.size(), " are given"),
+        __func__);
+  }
+
+  // The whole path is overwritten, so nothing is read.
+  BucketBatch batch;
+  OramStatus status = PathBatch(path, start_level, &batch);
+  if (!status.ok()) {
+    return status;
+  }
+  status = FetchBuckets(&batch, false);
+  if (!status.ok()) {
+    return status;
+  }
+
+  for (uint32_t i = start_level; i <= level_; i++) {
+    status = PutBucket(batch.buckets[i - start_level], in_path[i - start_level],
+                       oram_impl::Type::kNormal);
+    if (!status.ok()) {
+      return status.Append(OramStatus(
+          StatusCode::kInvalidOperation,
+          oram_utils::StrCat("Cannot write level ", i, " of path ", path),
+          __func__));
+    }
+  }
+
+  return FlushBuckets(batch, false);
+}
+
+OramStatus TreeOramServerStorage::ReadSlots(
+    uint32_t path, const std::vector<std::vector<uint32_t>>& slots,
+    p_oram_path_t* const out_path) {
+  if (slots.size() != level_ + 1) {
+    return OramStatus(
+        StatusCode::kInvalidArgument,
+        oram_utils::StrCat("The path should contain ", level_ + 1,
+                           " slot lists, but ", slots.size(), " are given"),
+        __func__);
+  }
+
+  BucketBatch batch;
+  OramStatus status = PathBatch(path, 0, &batch);
+  if (!status.ok()) {
+    return status;
+  }
+  status = FetchBuckets(&batch, true);
+  if (!status.ok()) {
+    return status;
+  }
+
+  for (uint32_t i = 0; i <= level_; i++) {
+    const uint8_t* const bucket = batch.buckets[i];
+    p_oram_bucket_t out_bucket;
+    for (const uint32_t slot : slots[i]) {
+      if (slot >= bucket_size_ || !bucket[slot]) {
+        return OramStatus(
+            StatusCode::kObjectNotFound,
+            oram_utils::StrCat("Cannot find slot ", slot, " at level ", i),
+            __func__);
       }
 
-      iter->second.emplace_back(
-          std::string(reinterpret_cast<const char*>(buf), compressed_size));
+      oram_block_t block;
+      LoadSlot(bucket, slot, &block);
+      out_bucket.emplace_back(block);
     }
 
-    return OramStatus::OK;
+    out_path->emplace_back(std::move(out_bucket));
   }
 
-  if (iter == storage_.end() && type == oram_impl::Type::kNormal) {
-    // Not found.
-    return OramStatus(StatusCode::kObjectNotFound, "Cannot find the bucket.",
-                      __func__);
-  } else {
-    iter->second.clear();
-
-    for (size_t i = 0; i < in_bucket.size(); i++) {
-      size_t compressed_size;
-      OramStatus status = oram_utils::DataCompress(
-          (uint8_t*)(&in_bucket[i]), ORAM_BLOCK_SIZE, buf, &compressed_size);
-      if (!status.ok()) {
-        return status.Append(OramStatus(StatusCode::kInvalidOperation,
-                                        "Cannot write to the server",
-                                        __func__));
+  return OramStatus::OK;
+}
+
+OramStatus TreeOramServerStorage::WriteSlots(
+    uint32_t path, const std::vector<std::vector<uint32_t>>& slots,
+    const p_oram_path_t& in_path) {
+  if (slots.size() != level_ + 1 || in_path.size() != level_ + 1) {
+    return OramStatus(
+        StatusCode::kInvalidArgument,
+        oram_utils::StrCat("The path should contain ", level_ + 1,
+                           " slot lists and buckets"),
+        __func__);
+  }
+
+  for (uint32_t i = 0; i <= level_; i++) {
+    if (slots[i].size() != in_path[i].size()) {
+      return OramStatus(StatusCode::kInvalidArgument,
+                        "The slots and the blocks do not match", __func__);
+    }
+
+    for (const uint32_t slot : slots[i]) {
+      if (slot >= bucket_size_) {
+        return OramStatus(
+            StatusCode::kOutOfRange,
+            oram_utils::StrCat("Slot ", slot, " is out of the bucket of ",
+                               bucket_size_, " slots"),
+            __func__);
       }
+    }
+  }
+
+  // The other slots of the buckets are kept.
+  BucketBatch batch;
+  OramStatus status = PathBatch(path, 0, &batch);
+  if (!status.ok()) {
+    return status;
+  }
+  status = FetchBuckets(&batch, true);
+  if (!status.ok()) {
+    return status;
+  }
+
+  for (uint32_t i = 0; i <= level_; i++) {
+    for (size_t j = 0; j < slots[i].size(); j++) {
+      StoreSlot(batch.buckets[i], slots[i][j], in_path[i][j]);
+    }
+  }
+
+  return FlushBuckets(batch, false);
+}
 
-      iter->second.emplace_back(
-          std::string(reinterpret_cast<const char*>(buf), compressed_size));
+void TreeOramServerStorage::PrintTree(void) const {
+  DBG(logger, "The size of the ORAM tree is {}", bucket_num_);
+
+  for (uint32_t i = 0; i <= level_; i++) {
+    const uint32_t level_size = POW2(i);
+    BucketBatch batch;
+    for (uint32_t j = 0; j < level_size; j++) {
+      batch.indices.emplace_back(level_size - 1 + j);
+    }
+    OramStatus status = FetchBuckets(&batch, true);
+    if (!status.ok()) {
+      DBG(logger, "Cannot read level {}: {}", i, status.EmitString());
+      continue;
     }
 
-    return OramStatus::OK;
+    for (uint32_t j = 0; j < level_size; j++) {
+      DBG(logger, "Tag {}, {}: ", i, j);
+
+      const uint8_t* const bucket = batch.buckets[j];
+      for (size_t k = 0; k < bucket_size_; k++) {
+        if (bucket[k]) {
+          oram_block_t block;
+          LoadSlot(bucket, k, &block);
+          DBG(logger, "id: {}, type: {}", block.header.block_id,
+              (int)block.header.type);
+        }
+      }
+    }
   }
 }
 
 float TreeOramServerStorage::ReportStorage(void) const {
   // Calculate the overall size of the storage in Megabytes.
-  uint64_t storage_size = 0;
-  for (const auto& iter : storage_) {
-    storage_size += iter.second.size() * sizeof(oram_block_t);
-  }
+  const uint64_t storage_size = region_size_;
 
   return storage_size * 1. / POW2(20);
 }
-}  // namespace oram_impl
\ No newline at end of file
+}  // namespace oram_impl
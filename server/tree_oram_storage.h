@@ -17,23 +17,129 @@
 #ifndef ORAM_IMPL_SERVER_TREE_ORAM_STORAGE_H_
 #define ORAM_IMPL_SERVER_TREE_ORAM_STORAGE_H_
 
+#include <cstdlib>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
 #include "base_oram_storage.h"
 
 #include "base/oram_status.h"
 #include "protos/messages.pb.h"
 
+struct io_uring;
+
 namespace oram_impl {
+// The tree is kept in one contiguous slab of fixed-size buckets. The bucket at
+// (level, offset) is at the heap position 2^level - 1 + offset and holds a
+// flag per slot, telling whether the slot holds a block, followed by
+// `bucket_size_` slots of `block_size_` bytes each. A path is thus read and
+// written by copying over contiguous memory with no allocation, hashing or
+// compression.
+//
+// The slab follows a header page. The two live either on the heap, in a
+// shared mapping of a file, which the kernel pages in and out as needed, or
+// in a file that is read and written with O_DIRECT through io_uring. The
+// buckets of a direct-I/O file are padded to whole pages, so that all the
+// buckets of a path are read or written by one batch of page-aligned requests
+// that bypass the page cache. A restarted server can attach to either file.
 class TreeOramServerStorage : public BaseOramServerStorage {
-  server_tree_storage_t storage_;
+  enum class Backend { kHeap, kMappedFile, kDirectFile };
+
+  // The buckets touched by one request. On a direct-I/O file they are staged
+  // in a page-aligned buffer; otherwise they point into the slab.
+  struct BucketBatch {
+    std::vector<size_t> indices;
+    std::vector<uint8_t*> buckets;
+    std::unique_ptr<uint8_t, decltype(&free)> buffer{nullptr, &free};
+  };
+
   // The level of the oram tree.
   uint32_t level_;
   // The size of each bucket.
   size_t bucket_size_;
+  // The number of buckets, i.e., 2^(level_ + 1) - 1.
+  size_t bucket_num_;
+  // The distance between two buckets in the slab.
+  size_t bucket_stride_;
+  Backend backend_;
+  std::unique_ptr<uint8_t, decltype(&free)> heap_;
+  // The backing file; empty if the region is on the heap.
+  std::string file_path_;
+  // The header page and the slab; nullptr on a direct-I/O file.
+  uint8_t* region_;
+  size_t region_size_;
+  uint8_t* slab_;
+  // The direct-I/O file and the ring that its requests are submitted to.
+  int fd_;
+  std::unique_ptr<io_uring> ring_;
+  mutable std::mutex ring_lock_;
+
+  // Only sets up the geometry; the buckets are padded to `alignment` bytes.
+  TreeOramServerStorage(uint32_t id, size_t capacity, size_t block_size,
+                        size_t bucket_size, const std::string& instance_hash,
+                        size_t alignment);
+
+  // Maps the file, which must already have the size of the region.
+  OramStatus MapFile(int fd, const std::string& file_path);
+  // Sets up the ring for the file, which must be opened with O_DIRECT.
+  OramStatus OpenDirect(int fd, const std::string& file_path);
+
+  // Returns false if the bucket is not in the tree.
+  bool BucketIndex(uint32_t level, uint32_t offset, size_t* const index) const;
+  // The level must not exceed `level_`.
+  uint32_t OffsetOf(uint32_t level, uint32_t path) const {
+    return path >> (level_ - level);
+  }
+  // The flags come first in a bucket, and the slots follow.
+  size_t SlotsOffset(void) const;
+  // Copies the block out of / into the slot of the bucket.
+  void LoadSlot(const uint8_t* bucket, size_t slot,
+                oram_block_t* const block) const;
+  void StoreSlot(uint8_t* bucket, size_t slot, const oram_block_t& block);
+  // Moves the blocks out of the bucket, which is left empty.
+  void TakeBucket(uint8_t* bucket, p_oram_bucket_t* const out_bucket);
+  // Appends the blocks to the bucket, or replaces its content, by `type`.
+  OramStatus PutBucket(uint8_t* bucket, const p_oram_bucket_t& in_bucket,
+                       oram_impl::Type type);
+
+  // Collects the buckets on P(path) from `start_level` down to the leaf.
+  OramStatus PathBatch(uint32_t path, uint32_t start_level,
+                       BucketBatch* const batch) const;
+  // Makes the buckets of the batch accessible. On a direct-I/O file they are
+  // read in one submission if `load` is set, and are empty otherwise.
+  OramStatus FetchBuckets(BucketBatch* const batch, bool load) const;
+  // Writes the buckets of the batch back to a direct-I/O file in one
+  // submission. If only the flags have changed, only the first page of each
+  // bucket is written.
+  OramStatus FlushBuckets(const BucketBatch& batch, bool flags_only);
+  // Reads or writes the first `length` bytes of each bucket of the batch.
+  OramStatus SubmitIo(bool write, const BucketBatch& batch,
+                      size_t length) const;
 
  public:
+  // The tree is on the heap.
   TreeOramServerStorage(uint32_t id, size_t capacity, size_t block_size,
                         size_t bucket_size, const std::string& instance_hash);
 
+  // Creates an empty tree in the file at `file_path`, which is truncated if
+  // it exists. The file is mapped, or accessed with direct I/O if `direct_io`
+  // is set.
+  static OramStatus Create(
+      const std::string& file_path, bool direct_io, uint32_t id,
+      size_t capacity, size_t block_size, size_t bucket_size,
+      const std::string& instance_hash,
+      std::unique_ptr<TreeOramServerStorage>* const storage);
+  // Attaches to the tree left in the file by Create() of an earlier run.
+  static OramStatus Attach(
+      const std::string& file_path,
+      std::unique_ptr<TreeOramServerStorage>* const storage);
+  // Flushes the file to the disk. Without it, the kernel still writes the
+  // pages back on its own, but a crash of the machine may lose them.
+  OramStatus Sync(void);
+  const std::string& GetFilePath(void) const { return file_path_; }
+
   OramStatus ReadPath(uint32_t level, uint32_t path,
                       p_oram_bucket_t* const out_bucket);
   OramStatus WritePath(uint32_t level, uint32_t path,
@@ -41,10 +147,28 @@ class TreeOramServerStorage : public BaseOramServerStorage {
   OramStatus AccurateWritePath(uint32_t level, uint32_t offset,
                                const p_oram_bucket_t& in_bucket,
                                oram_impl::Type type);
+  // Reads / writes all the buckets on a given path from `start_level` down to
+  // the leaf. The path is ordered from the top (level `start_level`) to the
+  // leaf.
+  OramStatus ReadFullPath(uint32_t path, uint32_t start_level,
+                          p_oram_path_t* const out_path);
+  OramStatus WriteFullPath(uint32_t path, uint32_t start_level,
+                           const p_oram_path_t& in_path);
+  // Reads / overwrites the given slots of each bucket on a path, from the root
+  // to the leaf. Unlike ReadPath, reading a slot does not clear the bucket.
+  OramStatus ReadSlots(uint32_t path,
+                       const std::vector<std::vector<uint32_t>>& slots,
+                       p_oram_path_t* const out_path);
+  OramStatus WriteSlots(uint32_t path,
+                        const std::vector<std::vector<uint32_t>>& slots,
+                        const p_oram_path_t& in_path);
 
-  server_tree_storage_t GetStorage(void) const { return storage_; }
+  // Logs the blocks in every bucket for debugging.
+  void PrintTree(void) const;
 
   virtual float ReportStorage(void) const;
+
+  virtual ~TreeOramServerStorage();
 };
 }  // namespace oram_impl
 
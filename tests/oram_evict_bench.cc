@@ -0,0 +1,67 @@
+/*
+ Copyright (c) 2022 Haobin Chen
+
+ This program is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include <spdlog/spdlog.h>
+#include <spdlog/sinks/stdout_color_sinks.h>
+
+#include "client/oram_client.h"
+#include "core/oram.h"
+#include "parse/oram_parse.h"
+
+std::shared_ptr<spdlog::logger> logger = spdlog::stdout_color_mt("oram_client");
+
+// Compares the slot occupancy and the bandwidth of sequential and random
+// eviction in Partition ORAM with the same \nu. Each policy runs `block_num`
+// random reads.
+int main(int argc, char* argv[]) {
+  // Create a parser.
+  oram_parse::YamlParser parser;
+  oram_impl::OramConfig config;
+  // Try configuration file.
+  oram_impl::OramStatus status = parser.Parse(config);
+  if (status.error_code() == oram_impl::StatusCode::kFileNotFound &&
+      !parser.IgnoreCommandLineArgs()) {
+    status = parser.FromCommandLine(argc, argv, config);
+
+    if (!status.ok()) {
+      logger->warn(status.EmitString());
+    }
+  }
+  config.oram_type = oram_impl::OramType::kPartitionOram;
+
+  // Control the log level.
+  logger->set_level(static_cast<spdlog::level::level_enum>(config.log_level));
+  spdlog::set_default_logger(logger);
+
+  // Create the controller.
+  std::unique_ptr<oram_impl::OramClient> client =
+      std::make_unique<oram_impl::OramClient>(config);
+  client->Ready();
+
+  status = client->FillWithData();
+  if (!status.ok()) {
+    ERRS(logger, "FillWithData failed. {}", status.EmitString());
+    abort();
+  }
+
+  status = client->BenchmarkEviction(config.block_num);
+  if (!status.ok()) {
+    ERRS(logger, "BenchmarkEviction failed. {}", status.EmitString());
+    abort();
+  }
+
+  return 0;
+}